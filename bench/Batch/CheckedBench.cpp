@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+#include <cstdint>
+
+#include "../../include/Batch/Checked.hpp"
+#include "../../include/Batch/Arithmetic.hpp"
+
+// Overflow-checked arithmetic against the unchecked loops it replaces:
+// - the sum of 4K (in cache) and 4M (in memory) values of Option<int64_t>, the argument:
+//   the unchecked branch-free loop, the fold with the scalar `checked_add` and `batch::checked_sum`,
+//   the same for OptionColumn<int64_t>;
+// - element-wise `a + b` and `a * b` over 64K Option<int32_t>: batch::add / mul against checked_add / mul;
+
+namespace {
+
+constexpr std::size_t kCount = 1 << 16;
+
+template <typename T>
+std::vector<tmn::Option<T>> make_options(std::size_t count, std::uint32_t seed) {
+  std::vector<tmn::Option<T>> options(count);
+  std::uint32_t state = seed;
+  for (auto& opt : options) {
+    state = state * 1664525u + 1013904223u;
+    opt = tmn::Option<T>(static_cast<T>(state >> 12) - static_cast<T>(1 << 19));
+  }
+  return options;
+}
+
+// The loop of today: the total and "every element is Some", without overflow checks;
+void BM_UncheckedSum(benchmark::State& state) {
+  const auto options = make_options<std::int64_t>(static_cast<std::size_t>(state.range(0)), 1);
+  for (auto _ : state) {
+    std::int64_t total = 0;
+    bool all = true;
+    for (const auto& opt : options) {
+      all &= opt.has_value();
+      total += opt.has_value() ? opt.value_unchecked() : 0;
+    }
+    auto sum = all ? tmn::Option<std::int64_t>(total) : tmn::Option<std::int64_t>();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ScalarCheckedFold(benchmark::State& state) {
+  const auto options = make_options<std::int64_t>(static_cast<std::size_t>(state.range(0)), 1);
+  for (auto _ : state) {
+    tmn::Option<std::int64_t> sum(0);
+    for (const auto& opt : options) sum = tmn::checked_add(sum, opt);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CheckedSum(benchmark::State& state) {
+  const auto options = make_options<std::int64_t>(static_cast<std::size_t>(state.range(0)), 1);
+  for (auto _ : state) {
+    auto sum = tmn::batch::checked_sum(options);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ColumnUncheckedSum(benchmark::State& state) {
+  const tmn::OptionColumn<std::int64_t> column(make_options<std::int64_t>(static_cast<std::size_t>(state.range(0)), 1));
+  for (auto _ : state) {
+    std::int64_t total = 0;
+    for (const std::int64_t value : column.values()) total += value;
+    auto sum = column.count_some() == column.size() ? tmn::Option<std::int64_t>(total) : tmn::Option<std::int64_t>();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ColumnCheckedSum(benchmark::State& state) {
+  const tmn::OptionColumn<std::int64_t> column(make_options<std::int64_t>(static_cast<std::size_t>(state.range(0)), 1));
+  for (auto _ : state) {
+    auto sum = tmn::batch::checked_sum(column);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ArrayAdd(benchmark::State& state) {
+  const auto lhs = make_options<std::int32_t>(kCount, 1);
+  const auto rhs = make_options<std::int32_t>(kCount, 2);
+  std::vector<tmn::Option<std::int32_t>> out(kCount);
+  for (auto _ : state) {
+    tmn::batch::add(lhs, rhs, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ArrayCheckedAdd(benchmark::State& state) {
+  const auto lhs = make_options<std::int32_t>(kCount, 1);
+  const auto rhs = make_options<std::int32_t>(kCount, 2);
+  std::vector<tmn::Option<std::int32_t>> out(kCount);
+  for (auto _ : state) {
+    tmn::batch::checked_add(lhs, rhs, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ArrayMul(benchmark::State& state) {
+  const auto lhs = make_options<std::int32_t>(kCount, 1);
+  const auto rhs = make_options<std::int32_t>(kCount, 2);
+  std::vector<tmn::Option<std::int32_t>> out(kCount);
+  for (auto _ : state) {
+    tmn::batch::mul(lhs, rhs, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ArrayCheckedMul(benchmark::State& state) {
+  const auto lhs = make_options<std::int32_t>(kCount, 1);
+  const auto rhs = make_options<std::int32_t>(kCount, 2);
+  std::vector<tmn::Option<std::int32_t>> out(kCount);
+  for (auto _ : state) {
+    tmn::batch::checked_mul(lhs, rhs, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_UncheckedSum)->Arg(1 << 12)->Arg(1 << 22);
+BENCHMARK(BM_ScalarCheckedFold)->Arg(1 << 12)->Arg(1 << 22);
+BENCHMARK(BM_CheckedSum)->Arg(1 << 12)->Arg(1 << 22);
+BENCHMARK(BM_ColumnUncheckedSum)->Arg(1 << 12)->Arg(1 << 22);
+BENCHMARK(BM_ColumnCheckedSum)->Arg(1 << 12)->Arg(1 << 22);
+BENCHMARK(BM_ArrayAdd);
+BENCHMARK(BM_ArrayCheckedAdd);
+BENCHMARK(BM_ArrayMul);
+BENCHMARK(BM_ArrayCheckedMul);
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "../../include/Batch/Reduce.hpp"
+
+// Sum of 4M optional values: the sequential fold with `+=` against parallel_reduce /
+// try_reduce on 1..32 threads (the argument); the *EarlyNone / *EarlyErr variants have
+// a failure in the first chunk and measure the cancellation of the other chunks;
+
+namespace {
+
+constexpr std::size_t kCount = 1 << 22;
+
+struct CodeErr {
+  int code = 0;
+
+  std::string err_msg() const { return "Error code: " + std::to_string(code); }
+  const char* what() const noexcept { return "CodeErr"; }
+
+  bool operator==(const CodeErr& oth) const noexcept = default;
+};
+
+std::vector<tmn::Option<long>> make_options() {
+  std::vector<tmn::Option<long>> options;
+  options.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) options.emplace_back(static_cast<long>(i % 1000));
+  return options;
+}
+
+std::vector<tmn::Result<long, CodeErr>> make_results() {
+  std::vector<tmn::Result<long, CodeErr>> results;
+  results.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) results.push_back(tmn::Result<long, CodeErr>::Ok(static_cast<long>(i % 1000)));
+  return results;
+}
+
+void BM_SequentialFold(benchmark::State& state) {
+  const auto options = make_options();
+  for (auto _ : state) {
+    tmn::Option<long> sum(0L);
+    for (const auto& opt : options) sum += opt;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ParallelReduce(benchmark::State& state) {
+  const auto options = make_options();
+  const tmn::batch::ParallelConfig config{.threads = static_cast<std::size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto sum = tmn::batch::parallel_reduce(options, std::plus<>{}, config);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ParallelReduceEarlyNone(benchmark::State& state) {
+  auto options = make_options();
+  options[100] = tmn::Option<long>();
+  const tmn::batch::ParallelConfig config{.threads = static_cast<std::size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto sum = tmn::batch::parallel_reduce(options, std::plus<>{}, config);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_TryReduce(benchmark::State& state) {
+  const auto results = make_results();
+  const tmn::batch::ParallelConfig config{.threads = static_cast<std::size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto sum = tmn::batch::try_reduce(results, 0L, std::plus<>{}, config);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_TryReduceEarlyErr(benchmark::State& state) {
+  auto results = make_results();
+  results[100] = tmn::Result<long, CodeErr>::Err(CodeErr{100});
+  const tmn::batch::ParallelConfig config{.threads = static_cast<std::size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto sum = tmn::batch::try_reduce(results, 0L, std::plus<>{}, config);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_SequentialFold);
+BENCHMARK(BM_ParallelReduce)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK(BM_ParallelReduceEarlyNone)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK(BM_TryReduce)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK(BM_TryReduceEarlyErr)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../../include/Batch/Select.hpp"
+
+// Compaction of 64K optional values: the naive loop (branch + push_back per element),
+// compact_some over an array of Option<T>, compact_some over OptionColumn<T> on every
+// SIMD level (argument 1: level 0..2) and partition_results against the naive loop;
+// argument 0 is the share of Some / Ok in percent, at pseudo-random positions;
+
+namespace {
+
+constexpr std::size_t kCount = 1 << 16;
+
+std::vector<bool> make_presence(std::int64_t percent) {
+  std::vector<bool> presence(kCount);
+  std::uint32_t state = 7;
+  for (std::size_t i = 0; i < kCount; ++i) {
+    state = state * 1664525u + 1013904223u;
+    presence[i] = static_cast<std::int64_t>((state >> 8) % 100) < percent;
+  }
+  return presence;
+}
+
+template <typename T>
+std::vector<tmn::Option<T>> make_options(std::int64_t percent) {
+  const auto presence = make_presence(percent);
+  std::vector<tmn::Option<T>> options(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (presence[i]) options[i] = tmn::Option<T>(static_cast<T>(i));
+  }
+  return options;
+}
+
+struct CodeErr {
+  int code = 0;
+
+  std::string err_msg() const { return "Error code: " + std::to_string(code); }
+  const char* what() const noexcept { return "CodeErr"; }
+
+  bool operator==(const CodeErr& oth) const noexcept = default;
+};
+
+std::vector<tmn::Result<double, CodeErr>> make_results(std::int64_t percent) {
+  const auto presence = make_presence(percent);
+  std::vector<tmn::Result<double, CodeErr>> results;
+  results.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (presence[i]) results.push_back(tmn::Result<double, CodeErr>::Ok(static_cast<double>(i)));
+    else results.push_back(tmn::Result<double, CodeErr>::Err(CodeErr{static_cast<int>(i)}));
+  }
+  return results;
+}
+
+template <typename T>
+void BM_NaiveCompact(benchmark::State& state) {
+  const auto options = make_options<T>(state.range(0));
+  for (auto _ : state) {
+    std::vector<T> out;
+    for (const auto& opt : options) {
+      if (opt.has_value()) out.push_back(opt.value());
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <typename T>
+void BM_ArrayCompact(benchmark::State& state) {
+  const auto options = make_options<T>(state.range(0));
+  for (auto _ : state) {
+    auto out = tmn::batch::compact_some(options);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <typename T>
+void BM_ColumnCompact(benchmark::State& state) {
+  const tmn::OptionColumn<T> column(make_options<T>(state.range(0)));
+  const auto previous = tmn::batch::set_simd_level(static_cast<tmn::batch::SimdLevel>(state.range(1)));
+  for (auto _ : state) {
+    auto out = tmn::batch::compact_some(column);
+    benchmark::DoNotOptimize(out.data());
+  }
+  tmn::batch::set_simd_level(previous);
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_NaivePartition(benchmark::State& state) {
+  const auto results = make_results(state.range(0));
+  for (auto _ : state) {
+    std::vector<double> oks;
+    std::vector<CodeErr> errs;
+    for (const auto& res : results) {
+      if (res.is_ok()) oks.push_back(res.unwrap_value());
+      else errs.push_back(res.unwrap_err());
+    }
+    benchmark::DoNotOptimize(oks.data());
+    benchmark::DoNotOptimize(errs.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_PartitionResults(benchmark::State& state) {
+  const auto results = make_results(state.range(0));
+  for (auto _ : state) {
+    auto parts = tmn::batch::partition_results(results);
+    benchmark::DoNotOptimize(parts.oks.data());
+    benchmark::DoNotOptimize(parts.errs.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_NaiveCompact<double>)->Arg(50)->Arg(90);
+BENCHMARK(BM_ArrayCompact<double>)->Arg(50)->Arg(90);
+BENCHMARK(BM_ColumnCompact<double>)->ArgsProduct({{50, 90}, {0, 1, 2}});
+BENCHMARK(BM_NaiveCompact<int>)->Arg(50)->Arg(90);
+BENCHMARK(BM_ArrayCompact<int>)->Arg(50)->Arg(90);
+BENCHMARK(BM_ColumnCompact<int>)->ArgsProduct({{50, 90}, {0, 1, 2}});
+BENCHMARK(BM_NaivePartition)->Arg(50)->Arg(99);
+BENCHMARK(BM_PartitionResults)->Arg(50)->Arg(99);
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "../../include/Batch/Transform.hpp"
+
+// Parsing of 1M decimal strings: the sequential loop over Result against try_transform
+// on 1..32 threads (the argument); *EarlyErr has an invalid record at index 1000
+// and measures the cancellation of the remaining chunks;
+
+namespace {
+
+constexpr std::size_t kCount = 1 << 20;
+
+struct ParseErr {
+  std::size_t position = 0;
+
+  std::string err_msg() const { return "bad digit at " + std::to_string(position); }
+  const char* what() const noexcept { return "ParseErr"; }
+
+  bool operator==(const ParseErr& oth) const noexcept = default;
+};
+
+tmn::Result<long, ParseErr> parse(const std::string& text) {
+  long value = 0;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    if (text[i] < '0' || text[i] > '9') return tmn::Result<long, ParseErr>::Err(ParseErr{i});
+    value = value * 10 + (text[i] - '0');
+  }
+  return tmn::Result<long, ParseErr>::Ok(value);
+}
+
+std::vector<std::string> make_lines() {
+  std::vector<std::string> lines;
+  lines.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) lines.push_back(std::to_string(i * 7919));
+  return lines;
+}
+
+void BM_SequentialLoop(benchmark::State& state) {
+  const auto lines = make_lines();
+  std::vector<long> out(kCount);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kCount; ++i) {
+      auto res = parse(lines[i]);
+      if (res.is_err()) break;
+      out[i] = res.unwrap_value();
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_TryTransform(benchmark::State& state) {
+  const auto lines = make_lines();
+  std::vector<long> out(kCount);
+  const tmn::batch::ParallelConfig config{.threads = static_cast<std::size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto status = tmn::batch::try_transform(config, lines, out, parse);
+    benchmark::DoNotOptimize(status);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_TryTransformEarlyErr(benchmark::State& state) {
+  auto lines = make_lines();
+  lines[1000] = "12x";
+  std::vector<long> out(kCount);
+  const tmn::batch::ParallelConfig config{.threads = static_cast<std::size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto status = tmn::batch::try_transform(config, lines, out, parse);
+    benchmark::DoNotOptimize(status);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_SequentialLoop);
+BENCHMARK(BM_TryTransform)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK(BM_TryTransformEarlyErr)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
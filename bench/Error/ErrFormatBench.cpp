@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <stdexcept>
+
+#include "../../include/Format/Format.hpp"
+#include "../../include/Error/Error.hpp"
+
+// Logger-like rendering of errors: `err_msg()` builds a new string on every call,
+// `write_msg()` / `format_to()` write into a buffer owned (and reused) by the caller;
+
+namespace {
+
+const tmn::err::NullPtrErr& null_ptr_err() {
+  static const tmn::err::NullPtrErr err("Deleter");
+  return err;
+}
+
+const tmn::err::GeneralExceptionErr& exception_err() {
+  static const tmn::err::GeneralExceptionErr err(std::runtime_error("Connection reset by peer"));
+  return err;
+}
+
+template <const auto& (*Get)()>
+void BM_ErrMsgString(benchmark::State& state) {
+  const auto& err = Get();
+  for (auto _ : state) {
+    std::string msg = err.err_msg();
+    benchmark::DoNotOptimize(msg);
+  }
+}
+
+template <const auto& (*Get)()>
+void BM_WriteMsgBuffer(benchmark::State& state) {
+  const auto& err = Get();
+  char buffer[256];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(err.write_msg(buffer));
+    benchmark::ClobberMemory();
+  }
+}
+
+template <const auto& (*Get)()>
+void BM_FormatToReusedString(benchmark::State& state) {
+  const auto& err = Get();
+  std::string line;
+  line.reserve(256);
+  for (auto _ : state) {
+    line.clear();
+    tmn::err::format_to(line, err);
+    benchmark::DoNotOptimize(line.data());
+  }
+}
+
+void BM_FormatToResult(benchmark::State& state) {
+  const auto result = tmn::Result<int, tmn::err::OutOfRangeErr>::Err(std::size_t{1024}, std::size_t{16});
+  std::string line;
+  line.reserve(256);
+  for (auto _ : state) {
+    line.clear();
+    tmn::format_to(line, result);
+    benchmark::DoNotOptimize(line.data());
+  }
+}
+
+} // namespace;
+
+BENCHMARK(BM_ErrMsgString<null_ptr_err>);
+BENCHMARK(BM_WriteMsgBuffer<null_ptr_err>);
+BENCHMARK(BM_FormatToReusedString<null_ptr_err>);
+BENCHMARK(BM_ErrMsgString<exception_err>);
+BENCHMARK(BM_WriteMsgBuffer<exception_err>);
+BENCHMARK(BM_FormatToReusedString<exception_err>);
+BENCHMARK(BM_FormatToResult);
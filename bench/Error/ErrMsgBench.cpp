@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+
+// Construction of failed Results on a validation path where the message is
+// never read: lazy / static messages against eagerly built std::string ones;
+
+namespace {
+
+constexpr std::size_t kArraySize = 1024;
+
+// The message as OutOfRangeErr built it before: std::to_string + concatenation;
+tmn::err::StrErr eager_out_of_range(std::size_t index, std::size_t size) {
+  return tmn::err::StrErr("Index " + std::to_string(index) + " out of range in [0, " + std::to_string(size) + ")");
+}
+
+void BM_OutOfRangeErrLazy(benchmark::State& state) {
+  std::size_t index = kArraySize;
+  for (auto _ : state) {
+    auto result = tmn::Result<int, tmn::err::OutOfRangeErr>::Err(index++, kArraySize);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+void BM_OutOfRangeErrEager(benchmark::State& state) {
+  std::size_t index = kArraySize;
+  for (auto _ : state) {
+    auto result = tmn::Result<int, tmn::err::StrErr>::Err(eager_out_of_range(index++, kArraySize));
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// Lazy construction plus reading the message: the formatting cost is paid on demand;
+void BM_OutOfRangeErrLazyRead(benchmark::State& state) {
+  std::size_t index = kArraySize;
+  for (auto _ : state) {
+    auto result = tmn::Result<int, tmn::err::OutOfRangeErr>::Err(index++, kArraySize);
+    benchmark::DoNotOptimize(result.unwrap_err().what());
+  }
+}
+
+void BM_StrErrStaticMsg(benchmark::State& state) {
+  for (auto _ : state) {
+    auto result = tmn::Result<int, tmn::err::StrErr>::Err(tmn::err::StaticMsg("Port must be in range 1-65535"));
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+void BM_StrErrCopiedMsg(benchmark::State& state) {
+  for (auto _ : state) {
+    auto result = tmn::Result<int, tmn::err::StrErr>::Err("Port must be in range 1-65535");
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// Err passed through a pipeline: every stage copies the error (fmap on an lvalue);
+// an owned message is shared between the copies, so a stage costs a refcount bump;
+constexpr int kPipelineStages = 8;
+
+void BM_ErrThroughPipeline(benchmark::State& state) {
+  const auto failed = tmn::Result<int, tmn::err::StrErr>::Err(std::string("Runtime message that does not fit into SSO"));
+  for (auto _ : state) {
+    auto result = failed;
+    for (int stage = 0; stage < kPipelineStages; ++stage) {
+      auto next = result.fmap([](int value) { return value + 1; });
+      benchmark::DoNotOptimize(next);
+      result = next;
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+} // namespace;
+
+BENCHMARK(BM_OutOfRangeErrLazy);
+BENCHMARK(BM_OutOfRangeErrEager);
+BENCHMARK(BM_OutOfRangeErrLazyRead);
+BENCHMARK(BM_StrErrStaticMsg);
+BENCHMARK(BM_StrErrCopiedMsg);
+BENCHMARK(BM_ErrThroughPipeline);
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "../../include/Error/Error.hpp"
+
+// Matching a base reference against a concrete error type: `AnyErr::as<E>()`
+// (record compare / parent chain walk) against dynamic_cast and typeid;
+
+namespace {
+
+constexpr std::size_t kErrorCount = 1024;
+
+// Mix of error types behind AnyErr pointers, so the branch on the type is not predictable:
+const std::vector<std::unique_ptr<tmn::err::AnyErr>>& mixed_errors() {
+  static const std::vector<std::unique_ptr<tmn::err::AnyErr>> errors = [] {
+    std::vector<std::unique_ptr<tmn::err::AnyErr>> result;
+    result.reserve(kErrorCount);
+    std::uint32_t seed = 42;
+    for (std::size_t i = 0; i < kErrorCount; ++i) {
+      seed = seed * 1664525u + 1013904223u;
+      switch ((seed >> 16) % 4) {
+        case 0: result.push_back(std::make_unique<tmn::err::OutOfRangeErr>(i, kErrorCount)); break;
+        case 1: result.push_back(std::make_unique<tmn::err::StrErr>(tmn::err::StaticMsg("str"))); break;
+        case 2: result.push_back(std::make_unique<tmn::err::BadAllocErr>()); break;
+        default: result.push_back(std::make_unique<tmn::err::InvalidArgErr>()); break;
+      }
+    }
+    return result;
+  }();
+  return errors;
+}
+
+void BM_MatchAs(benchmark::State& state) {
+  const auto& errors = mixed_errors();
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& err : errors) {
+      if (const auto* range_err = err->as<tmn::err::OutOfRangeErr>()) sum += range_err->index();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kErrorCount);
+}
+
+void BM_MatchDynamicCast(benchmark::State& state) {
+  const auto& errors = mixed_errors();
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& err : errors) {
+      if (const auto* range_err = dynamic_cast<const tmn::err::OutOfRangeErr*>(err.get())) sum += range_err->index();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kErrorCount);
+}
+
+void BM_MatchTypeid(benchmark::State& state) {
+  const auto& errors = mixed_errors();
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& err : errors) {
+      if (typeid(*err) == typeid(tmn::err::OutOfRangeErr)) {
+        sum += static_cast<const tmn::err::OutOfRangeErr&>(*err).index();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kErrorCount);
+}
+
+// Check against an intermediate base class of a custom hierarchy:
+// parent chain walk for `is<E>()`, hierarchy traversal for dynamic_cast;
+struct NetErr : tmn::err::StrErr {
+  using parent_error = tmn::err::StrErr;
+  const tmn::err::ErrTypeInfo& type_info() const noexcept override { return tmn::err::err_type_info<NetErr>; }
+};
+
+struct TimeoutErr : NetErr {
+  using parent_error = NetErr;
+  const tmn::err::ErrTypeInfo& type_info() const noexcept override { return tmn::err::err_type_info<TimeoutErr>; }
+};
+
+const std::vector<std::unique_ptr<tmn::err::AnyErr>>& hierarchy_errors() {
+  static const std::vector<std::unique_ptr<tmn::err::AnyErr>> errors = [] {
+    std::vector<std::unique_ptr<tmn::err::AnyErr>> result;
+    result.reserve(kErrorCount);
+    std::uint32_t seed = 7;
+    for (std::size_t i = 0; i < kErrorCount; ++i) {
+      seed = seed * 1664525u + 1013904223u;
+      switch ((seed >> 16) % 3) {
+        case 0: result.push_back(std::make_unique<TimeoutErr>()); break;
+        case 1: result.push_back(std::make_unique<NetErr>()); break;
+        default: result.push_back(std::make_unique<tmn::err::StrErr>()); break;
+      }
+    }
+    return result;
+  }();
+  return errors;
+}
+
+void BM_IsBaseAs(benchmark::State& state) {
+  const auto& errors = hierarchy_errors();
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (const auto& err : errors) count += err->is<NetErr>();
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kErrorCount);
+}
+
+void BM_IsBaseDynamicCast(benchmark::State& state) {
+  const auto& errors = hierarchy_errors();
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (const auto& err : errors) count += dynamic_cast<const NetErr*>(err.get()) != nullptr;
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kErrorCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_MatchAs);
+BENCHMARK(BM_MatchDynamicCast);
+BENCHMARK(BM_MatchTypeid);
+BENCHMARK(BM_IsBaseAs);
+BENCHMARK(BM_IsBaseDynamicCast);
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../../include/Match/Match.hpp"
+
+// Consuming Results with `match` against a hand-written `if` (the target: same cost)
+// and against `unwrap_value()` + catch (the exception path);
+// dispatch over base error references against a dynamic_cast chain;
+
+namespace {
+
+using IntResult = tmn::Result<int, tmn::err::StrErr>;
+
+constexpr std::size_t kCount = 1024;
+
+// Every `error_every`-th Result is an error:
+std::vector<IntResult> make_results(std::size_t error_every) {
+  std::vector<IntResult> results;
+  results.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (i % error_every == 0) results.push_back(IntResult::Err(tmn::err::StaticMsg("bad value")));
+    else results.push_back(IntResult::Ok(static_cast<int>(i)));
+  }
+  return results;
+}
+
+void BM_ResultMatch(benchmark::State& state) {
+  const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& res : results) {
+      sum += tmn::match(res, [](int v) { return v; }, [](const tmn::err::StrErr&) { return -1; });
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ResultIf(benchmark::State& state) {
+  const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& res : results) {
+      if (res.is_ok()) sum += res.unwrap_value();
+      else sum -= 1;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+void BM_ResultUnwrapCatch(benchmark::State& state) {
+  const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& res : results) {
+      try {
+        sum += res.unwrap_value();
+      } catch (const std::runtime_error&) {
+        sum -= 1;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+#endif
+
+const std::vector<std::unique_ptr<tmn::err::AnyErr>>& mixed_errors() {
+  static const std::vector<std::unique_ptr<tmn::err::AnyErr>> errors = [] {
+    std::vector<std::unique_ptr<tmn::err::AnyErr>> result;
+    result.reserve(kCount);
+    for (std::size_t i = 0; i < kCount; ++i) {
+      switch (i % 3) {
+        case 0: result.push_back(std::make_unique<tmn::err::OutOfRangeErr>(i, kCount)); break;
+        case 1: result.push_back(std::make_unique<tmn::err::NullPtrErr>("int")); break;
+        default: result.push_back(std::make_unique<tmn::err::StrErr>(tmn::err::StaticMsg("str"))); break;
+      }
+    }
+    return result;
+  }();
+  return errors;
+}
+
+void BM_ErrorMatch(benchmark::State& state) {
+  const auto& errors = mixed_errors();
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& err : errors) {
+      sum += tmn::match(*err,
+        tmn::handler<tmn::err::OutOfRangeErr>([](const tmn::err::OutOfRangeErr& e) { return e.index(); }),
+        tmn::handler<tmn::err::NullPtrErr>([] { return std::size_t{1}; }),
+        tmn::otherwise([] { return std::size_t{0}; }));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ErrorDynamicCastChain(benchmark::State& state) {
+  const auto& errors = mixed_errors();
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& err : errors) {
+      if (const auto* range_err = dynamic_cast<const tmn::err::OutOfRangeErr*>(err.get())) sum += range_err->index();
+      else if (dynamic_cast<const tmn::err::NullPtrErr*>(err.get()) != nullptr) sum += 1;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_ResultMatch)->Arg(2)->Arg(64);
+BENCHMARK(BM_ResultIf)->Arg(2)->Arg(64);
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+BENCHMARK(BM_ResultUnwrapCatch)->Arg(2)->Arg(64);
+#endif
+BENCHMARK(BM_ErrorMatch);
+BENCHMARK(BM_ErrorDynamicCastChain);
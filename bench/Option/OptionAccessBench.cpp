@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "../../include/Option/Option.hpp"
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+
+// Tight loops over arrays of Option<int> / Result<int, E> that check the state first:
+// checked access (`value()`, `unwrap_value()`) repeats the check and keeps the failure
+// call in the loop, unchecked access (`*opt`, `unwrap_unchecked()`) is a plain load;
+// build with -DCMAKE_BUILD_TYPE=Release (NDEBUG), otherwise the unchecked tier is asserted;
+
+namespace {
+
+using IntResult = tmn::Result<int, tmn::err::StrErr>;
+
+constexpr std::size_t kCount = 4096;
+
+// Every `none_every`-th Option is None:
+std::vector<tmn::Option<int>> make_options(std::size_t none_every) {
+  std::vector<tmn::Option<int>> options(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (i % none_every != 0) options[i] = tmn::Option<int>(static_cast<int>(i));
+  }
+  return options;
+}
+
+std::vector<IntResult> make_results(std::size_t err_every) {
+  std::vector<IntResult> results;
+  results.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (i % err_every == 0) results.push_back(IntResult::Err(tmn::err::StaticMsg("bad value")));
+    else results.push_back(IntResult::Ok(static_cast<int>(i)));
+  }
+  return results;
+}
+
+void BM_OptionSumChecked(benchmark::State& state) {
+  const auto options = make_options(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& opt : options) {
+      if (opt.has_value()) sum += opt.value();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_OptionSumUnchecked(benchmark::State& state) {
+  const auto options = make_options(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& opt : options) {
+      if (opt.has_value()) sum += *opt;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ResultSumChecked(benchmark::State& state) {
+  const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& res : results) {
+      if (res.is_ok()) sum += res.unwrap_value();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_ResultSumUnchecked(benchmark::State& state) {
+  const auto results = make_results(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& res : results) {
+      if (res.is_ok()) sum += res.unwrap_unchecked();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_OptionSumChecked)->Arg(2)->Arg(64);
+BENCHMARK(BM_OptionSumUnchecked)->Arg(2)->Arg(64);
+BENCHMARK(BM_ResultSumChecked)->Arg(2)->Arg(64);
+BENCHMARK(BM_ResultSumUnchecked)->Arg(2)->Arg(64);
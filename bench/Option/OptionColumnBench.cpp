@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "../../include/Option/OptionColumn.hpp"
+
+// Scans over 1M optional samples: array of Option<double> (16 bytes per element)
+// against OptionColumn<double> (8 bytes + 1 bit per element);
+
+namespace {
+
+constexpr std::size_t kCount = 1 << 20;
+
+// Every `none_every`-th sample is None:
+std::vector<tmn::Option<double>> make_samples(std::size_t none_every) {
+  std::vector<tmn::Option<double>> samples(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (i % none_every != 0) samples[i] = tmn::Option<double>(static_cast<double>(i) * 0.5);
+  }
+  return samples;
+}
+
+void BM_OptionArrayCountSome(benchmark::State& state) {
+  const auto samples = make_samples(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (const auto& opt : samples) count += opt.has_value() ? 1 : 0;
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+  state.counters["bytes"] = static_cast<double>(samples.size() * sizeof(tmn::Option<double>));
+}
+
+void BM_OptionColumnCountSome(benchmark::State& state) {
+  const tmn::OptionColumn<double> column(make_samples(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(column.count_some());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+  state.counters["bytes"] = static_cast<double>(column.values().size_bytes() + column.validity().size_bytes());
+}
+
+void BM_OptionArraySum(benchmark::State& state) {
+  const auto samples = make_samples(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& opt : samples) {
+      if (opt.has_value()) sum += *opt;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+// None slots hold 0.0, so the sum needs no branch on the bitmap:
+void BM_OptionColumnSum(benchmark::State& state) {
+  const tmn::OptionColumn<double> column(make_samples(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const double value : column.values()) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_OptionColumnAppend(benchmark::State& state) {
+  const auto samples = make_samples(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    tmn::OptionColumn<double> column;
+    column.append(samples);
+    benchmark::DoNotOptimize(column.size());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_OptionArrayCountSome)->Arg(2)->Arg(64);
+BENCHMARK(BM_OptionColumnCountSome)->Arg(2)->Arg(64);
+BENCHMARK(BM_OptionArraySum)->Arg(2)->Arg(64);
+BENCHMARK(BM_OptionColumnSum)->Arg(2)->Arg(64);
+BENCHMARK(BM_OptionColumnAppend)->Arg(2)->Arg(64);
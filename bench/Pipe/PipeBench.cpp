@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "../../include/Pipe/Pipe.hpp"
+
+// Chains of 4 and 8 stages over 4K Option<std::string> (1/8 None, 48-char strings,
+// out of the small-string buffer): the eager `opt.fmap(f).fmap(g)...` against the fused
+// `opt | fmap(f) | fmap(g) | ... | eval()`; the stages take the string by value (sinks),
+// so the eager chain copies the payload out of every intermediate Option, the fused one
+// moves it; the `Inspect` variants take `const std::string&` and return a new value,
+// so the two chains differ only by the intermediate Options; one Result chain with
+// and_then stages;
+
+namespace {
+
+using tmn::pipe::fmap;
+using tmn::pipe::and_then;
+using tmn::pipe::eval;
+
+constexpr std::size_t kCount = 1 << 12;
+
+struct TooLong {
+  std::size_t size = 0;
+
+  std::string err_msg() const { return "too long: " + std::to_string(size); }
+  const char* what() const noexcept { return "TooLong"; }
+
+  bool operator==(const TooLong& oth) const noexcept = default;
+};
+
+std::string upper(std::string s) { for (char& c : s) c = static_cast<char>(c & ~0x20); return s; }
+std::string tagged(std::string s) { s.push_back('#'); return s; }
+std::string rotated(std::string s) { if (!s.empty()) s.front() ^= 1; return s; }
+std::string trimmed(std::string s) { if (!s.empty()) s.pop_back(); return s; }
+
+std::size_t weight(const std::string& s) { return s.size() * 31 + static_cast<unsigned char>(s[0]); }
+std::size_t mixed(std::size_t x) { return x ^ (x >> 7); }
+std::string rendered(std::size_t x) { return std::string(40, static_cast<char>('a' + x % 26)); }
+
+tmn::Result<std::string, TooLong> checked(std::string s) {
+  if (s.size() > 64) return tmn::Result<std::string, TooLong>::Err(TooLong{s.size()});
+  return tmn::Result<std::string, TooLong>::Ok(std::move(s));
+}
+
+std::vector<tmn::Option<std::string>> make_options() {
+  std::vector<tmn::Option<std::string>> options;
+  options.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    options.push_back(i % 8 == 5 ? tmn::Option<std::string>() : tmn::Option<std::string>(std::string(48, static_cast<char>('a' + i % 26))));
+  }
+  return options;
+}
+
+// The chains, out of line (their code is compared with objdump):
+[[gnu::noinline]] tmn::Option<std::string> eager4(tmn::Option<std::string>& opt) {
+  return opt.fmap(upper).fmap(tagged).fmap(rotated).fmap(trimmed);
+}
+
+[[gnu::noinline]] tmn::Option<std::string> fused4(tmn::Option<std::string>& opt) {
+  return opt | fmap(upper) | fmap(tagged) | fmap(rotated) | fmap(trimmed) | eval();
+}
+
+[[gnu::noinline]] tmn::Option<std::string> eager8(tmn::Option<std::string>& opt) {
+  return opt.fmap(upper).fmap(tagged).fmap(rotated).fmap(trimmed).fmap(tagged).fmap(rotated).fmap(tagged).fmap(upper);
+}
+
+[[gnu::noinline]] tmn::Option<std::string> fused8(tmn::Option<std::string>& opt) {
+  return opt | fmap(upper) | fmap(tagged) | fmap(rotated) | fmap(trimmed) | fmap(tagged) | fmap(rotated) | fmap(tagged) | fmap(upper) | eval();
+}
+
+[[gnu::noinline]] tmn::Option<std::string> eager_inspect(tmn::Option<std::string>& opt) {
+  return opt.fmap(weight).fmap(mixed).fmap(rendered).fmap(weight).fmap(mixed).fmap(rendered);
+}
+
+[[gnu::noinline]] tmn::Option<std::string> fused_inspect(tmn::Option<std::string>& opt) {
+  return opt | fmap(weight) | fmap(mixed) | fmap(rendered) | fmap(weight) | fmap(mixed) | fmap(rendered) | eval();
+}
+
+[[gnu::noinline]] tmn::Result<std::string, TooLong> eager_result(tmn::Result<std::string, TooLong>& res) {
+  return res.fmap(upper).and_then(checked).fmap(tagged).and_then(checked);
+}
+
+[[gnu::noinline]] tmn::Result<std::string, TooLong> fused_result(tmn::Result<std::string, TooLong>& res) {
+  return res | fmap(upper) | and_then(checked) | fmap(tagged) | and_then(checked) | eval();
+}
+
+template <auto Chain>
+void run_options(benchmark::State& state) {
+  auto options = make_options();
+  for (auto _ : state) {
+    std::size_t total = 0;
+    for (auto& opt : options) {
+      const auto out = Chain(opt);
+      if (out.has_value()) total += out.value_unchecked().size();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <auto Chain>
+void run_results(benchmark::State& state) {
+  std::vector<tmn::Result<std::string, TooLong>> results;
+  for (const auto& opt : make_options()) {
+    results.push_back(opt.has_value() ? tmn::Result<std::string, TooLong>::Ok(opt.value()) : tmn::Result<std::string, TooLong>::Err(TooLong{}));
+  }
+  for (auto _ : state) {
+    std::size_t total = 0;
+    for (auto& res : results) {
+      const auto out = Chain(res);
+      if (out.is_ok()) total += out.unwrap_unchecked().size();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_Eager4(benchmark::State& state) { run_options<eager4>(state); }
+void BM_Fused4(benchmark::State& state) { run_options<fused4>(state); }
+void BM_Eager8(benchmark::State& state) { run_options<eager8>(state); }
+void BM_Fused8(benchmark::State& state) { run_options<fused8>(state); }
+void BM_EagerInspect6(benchmark::State& state) { run_options<eager_inspect>(state); }
+void BM_FusedInspect6(benchmark::State& state) { run_options<fused_inspect>(state); }
+void BM_EagerResult4(benchmark::State& state) { run_results<eager_result>(state); }
+void BM_FusedResult4(benchmark::State& state) { run_results<fused_result>(state); }
+
+} // namespace;
+
+BENCHMARK(BM_Eager4);
+BENCHMARK(BM_Fused4);
+BENCHMARK(BM_Eager8);
+BENCHMARK(BM_Fused8);
+BENCHMARK(BM_EagerInspect6);
+BENCHMARK(BM_FusedInspect6);
+BENCHMARK(BM_EagerResult4);
+BENCHMARK(BM_FusedResult4);
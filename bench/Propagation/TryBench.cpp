@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Error/TryOrConvert.hpp"
+#include "../../include/Propagation/Try.hpp"
+#include "../../include/Propagation/Coroutine.hpp"
+
+// Three-step pipeline where the first step fails for a given share of inputs
+// (state.range(0) = error rate in percent): compares exception-based
+// `try_or_convert`, the TMN_TRY macro, `co_await` and hand-written early returns;
+
+namespace {
+
+constexpr std::size_t kBatchSize = 1024;
+
+using StepResult = tmn::Result<int, tmn::err::StrErr>;
+
+std::vector<std::uint8_t> make_failure_mask(int error_rate_percent) {
+  std::vector<std::uint8_t> mask(kBatchSize);
+  std::uint32_t seed = 12345;
+  for (auto& failed : mask) {
+    seed = seed * 1664525u + 1013904223u;
+    failed = (seed >> 16) % 100 < static_cast<std::uint32_t>(error_rate_percent);
+  }
+  return mask;
+}
+
+[[gnu::noinline]] StepResult step(int x, bool fail) {
+  if (fail) return StepResult::Err("bad input");
+  return StepResult::Ok(x * 3 + 1);
+}
+
+StepResult pipeline_manual(int x, bool fail) {
+  auto a = step(x, fail);
+  if (a.is_err()) return a;
+  auto b = step(a.unwrap_value(), false);
+  if (b.is_err()) return b;
+  return step(b.unwrap_value(), false);
+}
+
+StepResult pipeline_try_macro(int x, bool fail) {
+  int a = TMN_TRY(step(x, fail));
+  int b = TMN_TRY(step(a, false));
+  return step(b, false);
+}
+
+StepResult pipeline_coroutine(int x, bool fail) {
+  int a = co_await step(x, fail);
+  int b = co_await step(a, false);
+  co_return co_await step(b, false);
+}
+
+auto pipeline_try_or_convert(int x, bool fail) {
+  return tmn::try_or_convert([&]() {
+    int a = step(x, fail).unwrap_value();
+    int b = step(a, false).unwrap_value();
+    return step(b, false).unwrap_value();
+  });
+}
+
+template <typename Pipeline>
+void run_pipeline(benchmark::State& state, Pipeline pipeline) {
+  const auto mask = make_failure_mask(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    long long ok_sum = 0;
+    for (std::size_t i = 0; i < kBatchSize; ++i) {
+      auto result = pipeline(static_cast<int>(i), mask[i] != 0);
+      if (result.is_ok()) ok_sum += result.unwrap_value();
+    }
+    benchmark::DoNotOptimize(ok_sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+void BM_Manual(benchmark::State& state) { run_pipeline(state, pipeline_manual); }
+void BM_TryMacro(benchmark::State& state) { run_pipeline(state, pipeline_try_macro); }
+void BM_Coroutine(benchmark::State& state) { run_pipeline(state, pipeline_coroutine); }
+void BM_TryOrConvert(benchmark::State& state) { run_pipeline(state, pipeline_try_or_convert); }
+
+} // namespace;
+
+BENCHMARK(BM_Manual)->Arg(0)->Arg(1)->Arg(50);
+BENCHMARK(BM_TryMacro)->Arg(0)->Arg(1)->Arg(50);
+BENCHMARK(BM_Coroutine)->Arg(0)->Arg(1)->Arg(50);
+BENCHMARK(BM_TryOrConvert)->Arg(0)->Arg(1)->Arg(50);
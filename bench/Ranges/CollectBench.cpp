@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+#include <ranges>
+
+#include "../../include/Ranges/Collect.hpp"
+
+// Result<std::string, E> x 64K into Result<std::vector<std::string>, E>: the hand-written
+// loop (push_back of copies, no reserve) against collect over the vector (copies, one
+// reservation), over the expiring vector (moves) and over a lazy view (no intermediate vector);
+
+namespace {
+
+constexpr std::size_t kCount = 1 << 16;
+
+struct CodeErr {
+  int code = 0;
+
+  std::string err_msg() const { return "Error code: " + std::to_string(code); }
+  const char* what() const noexcept { return "CodeErr"; }
+
+  bool operator==(const CodeErr& oth) const noexcept = default;
+};
+
+using StrResult = tmn::Result<std::string, CodeErr>;
+
+// Long enough to be allocated on the heap (no small string optimization):
+StrResult make_result(std::size_t i) { return StrResult::Ok("record-" + std::to_string(i) + "-with-a-heap-allocated-payload"); }
+
+std::vector<StrResult> make_results() {
+  std::vector<StrResult> results;
+  results.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) results.push_back(make_result(i));
+  return results;
+}
+
+void BM_HandWrittenLoop(benchmark::State& state) {
+  const auto results = make_results();
+  for (auto _ : state) {
+    std::vector<std::string> out;
+    for (const auto& res : results) {
+      if (res.is_err()) break;
+      out.push_back(res.unwrap_value());
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_CollectCopy(benchmark::State& state) {
+  const auto results = make_results();
+  for (auto _ : state) {
+    auto out = tmn::collect<std::vector>(results);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+// Materialize the Results, then collect: copies against moves out of the temporary vector;
+void BM_MaterializeThenCopy(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<StrResult> results;
+    for (std::size_t i = 0; i < kCount; ++i) results.push_back(make_result(i));
+    std::vector<std::string> out;
+    for (const auto& res : results) out.push_back(res.unwrap_value());
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_MaterializeThenCollectMove(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<StrResult> results;
+    results.reserve(kCount);
+    for (std::size_t i = 0; i < kCount; ++i) results.push_back(make_result(i));
+    auto out = tmn::collect<std::vector>(std::move(results));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_CollectLazyView(benchmark::State& state) {
+  for (auto _ : state) {
+    auto out = tmn::collect<std::vector>(std::views::iota(std::size_t{0}, kCount) | std::views::transform(make_result));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_HandWrittenLoop);
+BENCHMARK(BM_CollectCopy);
+BENCHMARK(BM_MaterializeThenCopy);
+BENCHMARK(BM_MaterializeThenCollectMove);
+BENCHMARK(BM_CollectLazyView);
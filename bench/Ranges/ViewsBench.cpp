@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+#include <ranges>
+
+#include "../../include/Ranges/Views.hpp"
+
+// Sum of the valid numbers of 64K decimal strings (1/8 invalid): the multi-pass
+// pipeline (vector of Results, vector of the Ok values, then the sum) against one
+// fused pass with views::ok / views::and_then; and the sum of the present values
+// of 64K Options: a copy into a vector against views::some;
+
+namespace {
+
+constexpr std::size_t kCount = 1 << 16;
+
+struct ParseErr {
+  std::size_t position = 0;
+
+  std::string err_msg() const { return "bad digit at " + std::to_string(position); }
+  const char* what() const noexcept { return "ParseErr"; }
+
+  bool operator==(const ParseErr& oth) const noexcept = default;
+};
+
+tmn::Result<long, ParseErr> parse(const std::string& text) {
+  long value = 0;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    if (text[i] < '0' || text[i] > '9') return tmn::Result<long, ParseErr>::Err(ParseErr{i});
+    value = value * 10 + (text[i] - '0');
+  }
+  return tmn::Result<long, ParseErr>::Ok(value);
+}
+
+tmn::Option<long> parse_opt(const std::string& text) {
+  auto res = parse(text);
+  return res.is_ok() ? tmn::Option<long>(res.unwrap_value()) : tmn::Option<long>();
+}
+
+std::vector<std::string> make_lines() {
+  std::vector<std::string> lines;
+  lines.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) lines.push_back(i % 8 == 3 ? "12x" : std::to_string(i * 7919));
+  return lines;
+}
+
+void BM_MultiPassPipeline(benchmark::State& state) {
+  const auto lines = make_lines();
+  for (auto _ : state) {
+    std::vector<tmn::Result<long, ParseErr>> results;
+    for (const auto& line : lines) results.push_back(parse(line));
+    std::vector<long> values;
+    for (const auto& res : results) {
+      if (res.is_ok()) values.push_back(res.unwrap_value());
+    }
+    long sum = 0;
+    for (long value : values) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_FusedOkView(benchmark::State& state) {
+  const auto lines = make_lines();
+  for (auto _ : state) {
+    long sum = 0;
+    for (long value : lines | std::views::transform(parse) | tmn::views::ok) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_FusedAndThenView(benchmark::State& state) {
+  const auto lines = make_lines();
+  for (auto _ : state) {
+    long sum = 0;
+    for (long value : lines | tmn::views::and_then(parse_opt)) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+std::vector<tmn::Option<long>> make_options() {
+  std::vector<tmn::Option<long>> options(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (i % 8 != 3) options[i] = tmn::Option<long>(static_cast<long>(i));
+  }
+  return options;
+}
+
+void BM_CopyPresentValues(benchmark::State& state) {
+  const auto options = make_options();
+  for (auto _ : state) {
+    std::vector<long> values;
+    for (const auto& opt : options) {
+      if (opt.has_value()) values.push_back(opt.value());
+    }
+    long sum = 0;
+    for (long value : values) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_SomeView(benchmark::State& state) {
+  const auto options = make_options();
+  for (auto _ : state) {
+    long sum = 0;
+    for (long value : options | tmn::views::some) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace;
+
+BENCHMARK(BM_MultiPassPipeline);
+BENCHMARK(BM_FusedOkView);
+BENCHMARK(BM_FusedAndThenView);
+BENCHMARK(BM_CopyPresentValues);
+BENCHMARK(BM_SomeView);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Error/Boxed.hpp"
+
+// Deep call chain where every frame returns Result<int, E> and forwards
+// the result of the next frame: measures the cost of returning the Result
+// object itself (size, copies) on the hot, successful path;
+
+namespace {
+
+constexpr int kChainDepth = 32;
+
+template <typename E>
+[[gnu::noinline]] tmn::Result<int, E> chain(int depth, int value, bool fail) {
+  if (depth == 0) {
+    if (fail) return tmn::Result<int, E>::Err("failure at the bottom of the chain");
+    return tmn::Result<int, E>::Ok(value);
+  }
+
+  auto next = chain<E>(depth - 1, value + 1, fail);
+  if (next.is_err()) return next;
+  return tmn::Result<int, E>::Ok(next.unwrap_value() ^ depth);
+}
+
+template <typename E>
+void BM_DeepChainOk(benchmark::State& state) {
+  int value = 0;
+  for (auto _ : state) {
+    auto result = chain<E>(kChainDepth, value++, false);
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["sizeof(Result)"] = sizeof(tmn::Result<int, E>);
+}
+
+template <typename E>
+void BM_DeepChainErr(benchmark::State& state) {
+  int value = 0;
+  for (auto _ : state) {
+    auto result = chain<E>(kChainDepth, value++, true);
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["sizeof(Result)"] = sizeof(tmn::Result<int, E>);
+}
+
+} // namespace;
+
+BENCHMARK(BM_DeepChainOk<tmn::err::AnyErr>);
+BENCHMARK(BM_DeepChainOk<tmn::err::Boxed<tmn::err::AnyErr>>);
+BENCHMARK(BM_DeepChainErr<tmn::err::AnyErr>);
+BENCHMARK(BM_DeepChainErr<tmn::err::Boxed<tmn::err::AnyErr>>);
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+#include "../../include/Validation/Validation.hpp"
+#include "../../include/Error/Error.hpp"
+
+// Validation of a record of 50 numeric fields given as strings, with every field
+// error reported: the current approach (a Result per field, the errors collected into
+// a vector of AnyErr with their messages) against `combine` of 50 Validations
+// (errors accumulated in the arena, converted to Result<Record, ErrList<FieldErr>>);
+// for 0, 3 and 50 invalid fields;
+
+namespace {
+
+constexpr std::size_t kFields = 50;
+
+struct FieldErr {
+  std::uint16_t field = 0;
+  std::uint16_t position = 0;
+
+  std::string err_msg() const { return "field " + std::to_string(field) + ": bad digit at " + std::to_string(position); }
+  const char* what() const noexcept { return "FieldErr"; }
+
+  bool operator==(const FieldErr& oth) const noexcept = default;
+};
+
+struct Record {
+  std::array<long, kFields> values{};
+};
+
+tmn::Result<long, FieldErr> parse(std::size_t field, const std::string& text) {
+  long value = 0;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    if (text[i] < '0' || text[i] > '9') {
+      return tmn::Result<long, FieldErr>::Err(FieldErr{static_cast<std::uint16_t>(field), static_cast<std::uint16_t>(i)});
+    }
+    value = value * 10 + (text[i] - '0');
+  }
+  return tmn::Result<long, FieldErr>::Ok(value);
+}
+
+std::array<std::string, kFields> make_input(std::size_t invalid) {
+  std::array<std::string, kFields> input;
+  for (std::size_t i = 0; i < kFields; ++i) {
+    input[i] = (i * 17) % kFields < invalid ? "12x4" : std::to_string(1000 + i * 37);
+  }
+  return input;
+}
+
+// Today: every field parsed, the messages of the errors collected (one statement
+// per field, as the code written for a record of distinct fields);
+struct Checked {
+  Record record;
+  std::vector<tmn::err::AnyErr> errors;
+};
+
+template <std::size_t... I>
+Checked validate_with_vector(const std::array<std::string, kFields>& input, std::index_sequence<I...>) {
+  Checked checked;
+  const auto field = [&](std::size_t i, tmn::Result<long, FieldErr>&& res) {
+    if (res.is_ok()) checked.record.values[i] = res.unwrap_unchecked();
+    else checked.errors.emplace_back(res.unwrap_err_unchecked().err_msg());
+  };
+  (field(I, parse(I, input[I])), ...);
+  return checked;
+}
+
+template <std::size_t... I>
+tmn::Result<Record, tmn::err::ErrList<FieldErr>> validate_with_combine(const std::array<std::string, kFields>& input, std::index_sequence<I...>) {
+  using Field = tmn::Validation<long, FieldErr>;
+  return combine([](auto... values) { return Record{{values...}}; }, Field::from_result(parse(I, input[I]))...).to_result();
+}
+
+void run_vector(benchmark::State& state) {
+  const auto input = make_input(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto res = validate_with_vector(input, std::make_index_sequence<kFields>{});
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void run_combine(benchmark::State& state) {
+  const auto input = make_input(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto res = validate_with_combine(input, std::make_index_sequence<kFields>{});
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_VectorOfAnyErr(benchmark::State& state) { run_vector(state); }
+void BM_ValidationCombine(benchmark::State& state) { run_combine(state); }
+
+} // namespace;
+
+BENCHMARK(BM_VectorOfAnyErr)->Arg(0)->Arg(3)->Arg(50);
+BENCHMARK(BM_ValidationCombine)->Arg(0)->Arg(3)->Arg(50);
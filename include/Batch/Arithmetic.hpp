@@ -0,0 +1,206 @@
+#ifndef TMN_THROWLESS_BATCH_ARITHMETIC_HPP
+#define TMN_THROWLESS_BATCH_ARITHMETIC_HPP
+
+#include <span>
+#include <vector>
+#include <ranges> // for: contiguous_range, range_value_t, data, size;
+#include <cstddef> // for: size_t;
+#include <cstdint> // for: uint64_t;
+#include <algorithm> // for: min;
+#include <concepts> // for: same_as, integral;
+#include <type_traits> // for: is_signed_v;
+
+#include "../Option/Option.hpp"
+#include "../Option/OptionColumn.hpp"
+#include "../../src/Option/OptionStorage.hpp"
+#include "../../src/Batch/SimdDispatch.hpp"
+#include "../../src/Batch/BatchTraits.hpp"
+
+namespace tmn::batch {
+
+//* <--- Null-propagating arithmetic over whole arrays of optional values --->
+
+// Element-wise versions of the Option operators (src/Option/CoproductOperations.hpp)
+// for arithmetic types, with the same semantics: the result is None if any operand
+// is None, integer division by zero gives None;
+//
+// Arrays of Option<T> (spans, vectors, ...): `out[i] = lhs[i] op rhs[i]` for the
+// first min(sizes) elements, the number of written elements is returned:
+//   std::vector<Option<double>> a, b, sum(a.size());
+//   tmn::batch::add(a, b, sum);
+// the loop is branch-free (selects instead of a branch per element), but the
+// interleaved layout (value, flag, padding) does not map onto vector registers;
+//
+// OptionColumn<T> (values and validity bitmap in separate arrays):
+//   OptionColumn<double> sum = tmn::batch::add(column_a, column_b);
+// the values are combined with AVX2 / AVX-512 (selected at runtime, see SimdDispatch.hpp)
+// and the bitmaps are combined a word (64 elements) at a time;
+
+namespace detail {
+
+struct AddOp {
+  template <typename T, typename U>
+  static constexpr auto apply(T lhs, U rhs) noexcept { return lhs + rhs; }
+};
+
+struct SubOp {
+  template <typename T, typename U>
+  static constexpr auto apply(T lhs, U rhs) noexcept { return lhs - rhs; }
+};
+
+struct MulOp {
+  template <typename T, typename U>
+  static constexpr auto apply(T lhs, U rhs) noexcept { return lhs * rhs; }
+};
+
+struct DivOp {
+  template <typename T, typename U>
+  static constexpr auto apply(T lhs, U rhs) noexcept { return lhs / rhs; }
+};
+
+// Division of integers by zero gives None (the divisor is replaced by 1 before the operation):
+template <typename Op, typename T, typename U>
+inline constexpr bool checks_zero_divisor = std::same_as<Op, DivOp> && std::integral<T> && std::integral<U>;
+
+template <typename Op, typename T, typename U>
+using op_result_t = decltype(Op::apply(T{}, U{}));
+
+// Integers of up to 32 bits (of the same signedness, so the usual arithmetic conversions
+// do not change the values) are divided through double: the quotient is exact and
+// truncated toward zero like the integer division, and unlike it the loop vectorizes:
+template <typename T, typename U>
+inline constexpr bool divides_through_double = std::integral<T> && std::integral<U> &&
+  sizeof(T) <= 4 && sizeof(U) <= 4 && std::is_signed_v<T> == std::is_signed_v<U>;
+
+template <typename Op, typename R, typename T, typename U>
+R compute(T lhs, U rhs) noexcept {
+  if constexpr (std::same_as<Op, DivOp> && divides_through_double<T, U>) {
+    return static_cast<R>(static_cast<double>(lhs) / static_cast<double>(rhs));
+  }
+  else {
+    return static_cast<R>(Op::apply(lhs, rhs));
+  }
+}
+
+template <typename Range>
+concept ArithmeticOptionRange = std::ranges::contiguous_range<Range> && BatchArithmetic<option_payload_t<Range>>;
+
+template <typename Op, typename L, typename R, typename Out>
+concept OptionKernelArgs = ArithmeticOptionRange<L> && ArithmeticOptionRange<R> && ArithmeticOptionRange<Out> &&
+  std::same_as<option_payload_t<Out>, op_result_t<Op, option_payload_t<L>, option_payload_t<R>>>;
+
+//*   <--- arrays of Option<T> --->
+
+// Operands of None are replaced by neutral values with select_bits (see BatchTraits.hpp):
+template <typename Op, typename T, typename U, typename R>
+void option_array_kernel(const Option<T>* lhs, const Option<U>* rhs, Option<R>* out, std::size_t count) noexcept {
+  constexpr U neutral_rhs = std::same_as<Op, DivOp> ? U{1} : U{0};
+  for (std::size_t i = 0; i < count; ++i) {
+    const bool lhs_some = lhs[i].has_value();
+    const bool rhs_some = rhs[i].has_value();
+    const T x = select_bits(lhs_some, tmn::detail::OptionStorage::load_raw(lhs[i]), T{0});
+    U y = select_bits(rhs_some, tmn::detail::OptionStorage::load_raw(rhs[i]), neutral_rhs);
+    bool is_some = lhs_some & rhs_some;
+    if constexpr (checks_zero_divisor<Op, T, U>) {
+      is_some &= (y != U{0});
+      y = static_cast<U>(y + static_cast<U>(y == U{0}));
+    }
+    tmn::detail::OptionStorage::store(out[i], compute<Op, R>(x, y), is_some);
+  }
+}
+
+template <typename Op, typename L, typename R, typename Out>
+std::size_t apply_to_arrays(const L& lhs, const R& rhs, Out& out) noexcept {
+  const std::size_t count = std::min({std::ranges::size(lhs), std::ranges::size(rhs), std::ranges::size(out)});
+  option_array_kernel<Op>(std::ranges::data(lhs), std::ranges::data(rhs), std::ranges::data(out), count);
+  return count;
+}
+
+//*   <--- OptionColumn<T> --->
+
+// Values of the result and the bits of the zero divisors (when division checks them):
+template <typename Op, typename T, typename U, typename R>
+struct ColumnKernel {
+  [[TMN_THROWLESS_KERNEL_INLINE]] static void run(const T* lhs, const U* rhs, R* out, std::uint64_t* zero_bits, std::size_t count) noexcept {
+    if constexpr (checks_zero_divisor<Op, T, U>) {
+      for (std::size_t word = 0; word * 64 < count; ++word) {
+        const std::size_t first = word * 64;
+        const std::size_t last = std::min(count, first + 64);
+        std::uint64_t bits = 0;
+        for (std::size_t i = first; i < last; ++i) {
+          bits |= static_cast<std::uint64_t>(rhs[i] == U{0}) << (i - first);
+        }
+        zero_bits[word] = bits;
+      }
+
+      for (std::size_t i = 0; i < count; ++i) {
+        const U divisor = static_cast<U>(rhs[i] + static_cast<U>(rhs[i] == U{0})); // zero -> 1 without a branch;
+        out[i] = compute<Op, R>(lhs[i], divisor);
+      }
+    }
+    else {
+      for (std::size_t i = 0; i < count; ++i) {
+        out[i] = compute<Op, R>(lhs[i], rhs[i]);
+      }
+    }
+  }
+};
+
+template <typename Op, typename T, typename U>
+auto apply_to_columns(const OptionColumn<T>& lhs, const OptionColumn<U>& rhs) {
+  using R = op_result_t<Op, T, U>;
+  const std::size_t count = std::min(lhs.size(), rhs.size());
+  const std::size_t words = (count + 63) / 64;
+
+  std::vector<R> values(count);
+  std::vector<std::uint64_t> validity(words);
+  if constexpr (checks_zero_divisor<Op, T, U>) {
+    std::vector<std::uint64_t> zero_bits(words);
+    tmn::detail::dispatch_simd<ColumnKernel<Op, T, U, R>>(lhs.values().data(), rhs.values().data(), values.data(), zero_bits.data(), count);
+    for (std::size_t w = 0; w < words; ++w) validity[w] = lhs.validity()[w] & rhs.validity()[w] & ~zero_bits[w];
+  }
+  else {
+    tmn::detail::dispatch_simd<ColumnKernel<Op, T, U, R>>(lhs.values().data(), rhs.values().data(), values.data(), static_cast<std::uint64_t*>(nullptr), count);
+    for (std::size_t w = 0; w < words; ++w) validity[w] = lhs.validity()[w] & rhs.validity()[w];
+  }
+
+  // bits of the longer column past `count` are cleared by from_parts:
+  return OptionColumn<R>::from_parts(std::move(values), std::move(validity));
+}
+
+template <typename T, typename U>
+concept ArithmeticColumns = BatchArithmetic<T> && BatchArithmetic<U>;
+
+} // namespace tmn::batch::detail;
+
+//*   <--- arrays of Option<T> --->
+
+template <typename L, typename R, typename Out> requires detail::OptionKernelArgs<detail::AddOp, L, R, Out>
+std::size_t add(const L& lhs, const R& rhs, Out&& out) noexcept { return detail::apply_to_arrays<detail::AddOp>(lhs, rhs, out); }
+
+template <typename L, typename R, typename Out> requires detail::OptionKernelArgs<detail::SubOp, L, R, Out>
+std::size_t sub(const L& lhs, const R& rhs, Out&& out) noexcept { return detail::apply_to_arrays<detail::SubOp>(lhs, rhs, out); }
+
+template <typename L, typename R, typename Out> requires detail::OptionKernelArgs<detail::MulOp, L, R, Out>
+std::size_t mul(const L& lhs, const R& rhs, Out&& out) noexcept { return detail::apply_to_arrays<detail::MulOp>(lhs, rhs, out); }
+
+template <typename L, typename R, typename Out> requires detail::OptionKernelArgs<detail::DivOp, L, R, Out>
+std::size_t div(const L& lhs, const R& rhs, Out&& out) noexcept { return detail::apply_to_arrays<detail::DivOp>(lhs, rhs, out); }
+
+//*   <--- OptionColumn<T> (the result has min(sizes) elements) --->
+
+template <typename T, typename U> requires detail::ArithmeticColumns<T, U>
+auto add(const OptionColumn<T>& lhs, const OptionColumn<U>& rhs) { return detail::apply_to_columns<detail::AddOp>(lhs, rhs); }
+
+template <typename T, typename U> requires detail::ArithmeticColumns<T, U>
+auto sub(const OptionColumn<T>& lhs, const OptionColumn<U>& rhs) { return detail::apply_to_columns<detail::SubOp>(lhs, rhs); }
+
+template <typename T, typename U> requires detail::ArithmeticColumns<T, U>
+auto mul(const OptionColumn<T>& lhs, const OptionColumn<U>& rhs) { return detail::apply_to_columns<detail::MulOp>(lhs, rhs); }
+
+template <typename T, typename U> requires detail::ArithmeticColumns<T, U>
+auto div(const OptionColumn<T>& lhs, const OptionColumn<U>& rhs) { return detail::apply_to_columns<detail::DivOp>(lhs, rhs); }
+
+} // namespace tmn::batch;
+
+#endif // TMN_THROWLESS_BATCH_ARITHMETIC_HPP
@@ -0,0 +1,330 @@
+#ifndef TMN_THROWLESS_BATCH_CHECKED_HPP
+#define TMN_THROWLESS_BATCH_CHECKED_HPP
+
+#include <vector>
+#include <ranges> // for: contiguous_range, data, size;
+#include <cstddef> // for: size_t;
+#include <limits> // for: numeric_limits;
+#include <cstdint> // for: uint64_t, int64_t;
+#include <bit> // for: bit_width;
+#include <algorithm> // for: min;
+#include <concepts> // for: same_as, integral;
+#include <type_traits> // for: is_signed_v, make_unsigned_t, conditional_t;
+
+#include "../Option/Option.hpp"
+#include "../Option/OptionColumn.hpp"
+#include "../../src/Option/OptionStorage.hpp"
+#include "../../src/Option/Overflow.hpp"
+#include "../../src/Batch/SimdDispatch.hpp"
+#include "../../src/Batch/BatchTraits.hpp"
+
+namespace tmn::batch {
+
+//* <--- Overflow-checked integer arithmetic over whole arrays of optional values --->
+
+// Element-wise versions of tmn::checked_add / checked_sub / checked_mul (src/Option/CoproductOperations.hpp):
+// the element of the result is None if an operand is None or the exact result does not fit T;
+// the operands and the result have the same integer type:
+//   tmn::batch::checked_mul(prices, quantities, amounts);          // arrays of Option<int64_t>
+//   OptionColumn<int32_t> sums = tmn::batch::checked_add(col_a, col_b);
+// checked_sum(values) -> Option<T>: the sum of all elements, None if an element is None
+// or the exact sum does not fit T (intermediate sums may leave the range of T, the result is
+// the same for any order of the elements):
+//   Option<int64_t> total = tmn::batch::checked_sum(amounts);
+//
+// The kernels over arrays of Option<T> are scalar and check with __builtin_*_overflow (the
+// flag of the instruction, see src/Option/Overflow.hpp); the builtins keep a loop scalar (GCC / Clang do not vectorize them),
+// so the kernels over OptionColumn<T> compute the same predicates with bit operations on the
+// wrapped results: signed a + b overflows iff a and b have the same sign and the sign of the sum
+// differs; the products of integers of up to 32 bits are computed in 64 bits (the products of
+// 64-bit integers are checked with __builtin_mul_overflow element by element);
+// checked_sum adds blocks of elements in 64 bits: the array kernel leaves the block at the first
+// None or overflowed partial sum, the column kernel bounds the magnitude of the values (OR of the
+// values, exact when `count * 2^bits(magnitude)` fits); such blocks are summed again in 128 bits
+// (two 64-bit words, ExactSum);
+
+namespace detail {
+
+template <typename T>
+concept CheckedBatchInteger = std::integral<T> && !std::same_as<T, bool> && sizeof(T) <= 8;
+
+// `result = lhs op rhs` wrapped to T, returns true if the exact result does not fit T;
+// `scalar` for the array kernels, `apply` (vectorizable) for the column kernels:
+struct CheckedAddOp {
+  template <typename T>
+  static bool scalar(T lhs, T rhs, T& result) noexcept { return tmn::detail::add_overflow(lhs, rhs, &result); }
+
+  template <typename T>
+  static bool apply(T lhs, T rhs, T& result) noexcept {
+    using Bits = std::make_unsigned_t<T>;
+    result = static_cast<T>(static_cast<Bits>(static_cast<Bits>(lhs) + static_cast<Bits>(rhs)));
+    if constexpr (std::is_signed_v<T>) return static_cast<T>((lhs ^ result) & (rhs ^ result)) < 0;
+    else return result < lhs;
+  }
+};
+
+struct CheckedSubOp {
+  template <typename T>
+  static bool scalar(T lhs, T rhs, T& result) noexcept { return tmn::detail::sub_overflow(lhs, rhs, &result); }
+
+  template <typename T>
+  static bool apply(T lhs, T rhs, T& result) noexcept {
+    using Bits = std::make_unsigned_t<T>;
+    result = static_cast<T>(static_cast<Bits>(static_cast<Bits>(lhs) - static_cast<Bits>(rhs)));
+    if constexpr (std::is_signed_v<T>) return static_cast<T>((lhs ^ rhs) & (lhs ^ result)) < 0;
+    else return lhs < rhs;
+  }
+};
+
+struct CheckedMulOp {
+  template <typename T>
+  static bool scalar(T lhs, T rhs, T& result) noexcept { return tmn::detail::mul_overflow(lhs, rhs, &result); }
+
+  template <typename T>
+  static bool apply(T lhs, T rhs, T& result) noexcept {
+    if constexpr (sizeof(T) <= 4) {
+      using Wide = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+      const Wide product = static_cast<Wide>(lhs) * static_cast<Wide>(rhs);
+      result = static_cast<T>(product);
+      return static_cast<Wide>(result) != product;
+    }
+    else {
+      return tmn::detail::mul_overflow(lhs, rhs, &result);
+    }
+  }
+};
+
+template <typename Range>
+concept CheckedOptionRange = std::ranges::contiguous_range<Range> && CheckedBatchInteger<option_payload_t<Range>>;
+
+template <typename L, typename R, typename Out>
+concept CheckedKernelArgs = CheckedOptionRange<L> && std::same_as<option_payload_t<L>, option_payload_t<R>> &&
+  std::same_as<option_payload_t<L>, option_payload_t<Out>> && std::ranges::contiguous_range<R> && std::ranges::contiguous_range<Out>;
+
+//*   <--- arrays of Option<T> --->
+
+template <typename Op, typename T>
+void checked_array_kernel(const Option<T>* lhs, const Option<T>* rhs, Option<T>* out, std::size_t count) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    const bool lhs_some = lhs[i].has_value();
+    const bool rhs_some = rhs[i].has_value();
+    const T x = select_bits(lhs_some, tmn::detail::OptionStorage::load_raw(lhs[i]), T{0});
+    const T y = select_bits(rhs_some, tmn::detail::OptionStorage::load_raw(rhs[i]), T{0});
+    T result;
+    const bool overflow = Op::scalar(x, y, result);
+    tmn::detail::OptionStorage::store(out[i], result, lhs_some & rhs_some & !overflow);
+  }
+}
+
+template <typename Op, typename L, typename R, typename Out>
+std::size_t apply_checked_to_arrays(const L& lhs, const R& rhs, Out& out) noexcept {
+  const std::size_t count = std::min({std::ranges::size(lhs), std::ranges::size(rhs), std::ranges::size(out)});
+  checked_array_kernel<Op>(std::ranges::data(lhs), std::ranges::data(rhs), std::ranges::data(out), count);
+  return count;
+}
+
+//*   <--- OptionColumn<T> --->
+
+// Values of the result and the bits of the overflowed elements:
+template <typename Op, typename T>
+struct CheckedColumnKernel {
+  [[TMN_THROWLESS_KERNEL_INLINE]] static void run(const T* lhs, const T* rhs, T* out, std::uint64_t* overflow_bits, std::size_t count) noexcept {
+    for (std::size_t word = 0; word * 64 < count; ++word) {
+      const std::size_t first = word * 64;
+      const std::size_t last = std::min(count, first + 64);
+      std::uint64_t bits = 0;
+      for (std::size_t i = first; i < last; ++i) {
+        bits |= static_cast<std::uint64_t>(Op::apply(lhs[i], rhs[i], out[i])) << (i - first);
+      }
+      overflow_bits[word] = bits;
+    }
+  }
+};
+
+template <typename Op, typename T>
+OptionColumn<T> apply_checked_to_columns(const OptionColumn<T>& lhs, const OptionColumn<T>& rhs) {
+  const std::size_t count = std::min(lhs.size(), rhs.size());
+  const std::size_t words = (count + 63) / 64;
+
+  std::vector<T> values(count);
+  std::vector<std::uint64_t> validity(words);
+  tmn::detail::dispatch_simd<CheckedColumnKernel<Op, T>>(lhs.values().data(), rhs.values().data(), values.data(), validity.data(), count);
+  for (std::size_t w = 0; w < words; ++w) validity[w] = lhs.validity()[w] & rhs.validity()[w] & ~validity[w];
+
+  return OptionColumn<T>::from_parts(std::move(values), std::move(validity));
+}
+
+//*   <--- checked_sum --->
+
+// Blocks of 4096 elements: the wrapped 64-bit sum of a block is exact while its elements
+// stay below 2^50 in magnitude (or 2^51 for the unsigned ones);
+inline constexpr std::size_t sum_block = 4096;
+
+template <typename T>
+using sum_wide_t = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+
+// Exact sum of 64-bit values, `high * 2^64 + low` (a portable 128-bit accumulator: an add
+// and an add-with-carry per value); exact for fewer than 2^63 values:
+struct ExactSum {
+  std::int64_t high = 0;
+  std::uint64_t low = 0;
+
+  template <typename W>
+  void add(W value) noexcept {
+    const auto bits = static_cast<std::uint64_t>(value);
+    low += bits;
+    high += static_cast<std::int64_t>(low < bits);
+    if constexpr (std::is_signed_v<W>) high -= static_cast<std::int64_t>(value < 0);
+  }
+
+  template <typename T>
+  bool fits() const noexcept {
+    if constexpr (std::is_signed_v<T>) {
+      const auto value = static_cast<std::int64_t>(low);
+      const bool fits_int64 = high == (value < 0 ? -1 : 0);
+      return fits_int64 && value >= std::numeric_limits<T>::min() && value <= std::numeric_limits<T>::max();
+    }
+    else {
+      return high == 0 && low <= std::numeric_limits<T>::max();
+    }
+  }
+
+  template <typename T>
+  T value() const noexcept { return static_cast<T>(low); }
+};
+
+// Bits of the magnitude of `value` (|value| - 1 for the negative ones):
+template <typename T>
+sum_wide_t<T> magnitude(T value) noexcept {
+  const sum_wide_t<T> wide = value;
+  if constexpr (std::is_signed_v<T>) return wide ^ (wide >> 63);
+  else return wide;
+}
+
+// Whether a wrapped sum of `count` elements whose magnitudes are below 2^bits(mask) is exact:
+template <typename T>
+bool sum_is_exact(sum_wide_t<T> mask, std::size_t count) noexcept {
+  const std::uint64_t bound = static_cast<std::uint64_t>(mask);
+  const int bits = std::bit_width(bound);
+  const int count_bits = std::bit_width(static_cast<std::uint64_t>(count) | 1);
+  // |sum| <= count * 2^bits <= 2^(bits + count_bits):
+  return bits + count_bits <= (std::is_signed_v<T> ? 63 : 64);
+}
+
+// Sum of a block in the wide type: the kernels over arrays of Option<T> are scalar, so the check
+// is the overflow flag of the addition; false at the first None or when a partial sum leaves
+// the range of the wide type (both branches are never taken on the valid path):
+template <typename T>
+struct OptionSumKernel {
+  static bool run(const Option<T>* values, std::size_t count, sum_wide_t<T>& sum) noexcept {
+    sum_wide_t<T> partial = 0;
+    std::size_t i = 0;
+    // one branch on the states of 4 elements, then one fused add + jo per element:
+    for (; i + 4 <= count; i += 4) {
+      const bool some = values[i].has_value() & values[i + 1].has_value() & values[i + 2].has_value() & values[i + 3].has_value();
+      if (!some) [[unlikely]] return false;
+      for (std::size_t j = i; j < i + 4; ++j) {
+        const sum_wide_t<T> value = tmn::detail::OptionStorage::load_raw(values[j]);
+        if (tmn::detail::add_overflow(partial, value, &partial)) [[unlikely]] return false;
+      }
+    }
+    for (; i < count; ++i) {
+      if (!values[i].has_value()) [[unlikely]] return false;
+      const sum_wide_t<T> value = tmn::detail::OptionStorage::load_raw(values[i]);
+      if (tmn::detail::add_overflow(partial, value, &partial)) [[unlikely]] return false;
+    }
+    sum = partial;
+    return true;
+  }
+
+  static void exact(const Option<T>* values, std::size_t count, bool& all_some, ExactSum& sum) noexcept {
+    bool some = true;
+    for (std::size_t i = 0; i < count; ++i) {
+      some &= values[i].has_value();
+      sum.add(static_cast<sum_wide_t<T>>(select_bits(values[i].has_value(), tmn::detail::OptionStorage::load_raw(values[i]), T{0})));
+    }
+    all_some &= some;
+  }
+};
+
+template <typename T>
+struct ColumnSumKernel {
+  [[TMN_THROWLESS_KERNEL_INLINE]] static sum_wide_t<T> run(const T* values, std::size_t count, sum_wide_t<T>* mask) noexcept {
+    sum_wide_t<T> sum = 0;
+    sum_wide_t<T> bits = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      sum = static_cast<sum_wide_t<T>>(static_cast<std::uint64_t>(sum) + static_cast<std::uint64_t>(static_cast<sum_wide_t<T>>(values[i])));
+      bits |= magnitude(values[i]);
+    }
+    *mask = bits;
+    return sum;
+  }
+
+  static void exact(const T* values, std::size_t count, ExactSum& sum) noexcept {
+    for (std::size_t i = 0; i < count; ++i) sum.add(static_cast<sum_wide_t<T>>(values[i]));
+  }
+};
+
+} // namespace tmn::batch::detail;
+
+//*   <--- arrays of Option<T> --->
+
+template <typename L, typename R, typename Out> requires detail::CheckedKernelArgs<L, R, Out>
+std::size_t checked_add(const L& lhs, const R& rhs, Out&& out) noexcept { return detail::apply_checked_to_arrays<detail::CheckedAddOp>(lhs, rhs, out); }
+
+template <typename L, typename R, typename Out> requires detail::CheckedKernelArgs<L, R, Out>
+std::size_t checked_sub(const L& lhs, const R& rhs, Out&& out) noexcept { return detail::apply_checked_to_arrays<detail::CheckedSubOp>(lhs, rhs, out); }
+
+template <typename L, typename R, typename Out> requires detail::CheckedKernelArgs<L, R, Out>
+std::size_t checked_mul(const L& lhs, const R& rhs, Out&& out) noexcept { return detail::apply_checked_to_arrays<detail::CheckedMulOp>(lhs, rhs, out); }
+
+template <typename Range> requires detail::CheckedOptionRange<Range>
+auto checked_sum(const Range& options) noexcept -> Option<detail::option_payload_t<Range>> {
+  using T = detail::option_payload_t<Range>;
+  const Option<T>* data = std::ranges::data(options);
+  const std::size_t count = std::ranges::size(options);
+
+  detail::ExactSum total;
+  bool all_some = true;
+  for (std::size_t first = 0; first < count; first += detail::sum_block) {
+    const std::size_t size = std::min(detail::sum_block, count - first);
+    detail::sum_wide_t<T> sum = 0;
+    if (detail::OptionSumKernel<T>::run(data + first, size, sum)) total.add(sum);
+    else detail::OptionSumKernel<T>::exact(data + first, size, all_some, total);
+    if (!all_some) return Option<T>();
+  }
+  if (!total.fits<T>()) return Option<T>();
+  return Option<T>(total.value<T>());
+}
+
+//*   <--- OptionColumn<T> (the result has min(sizes) elements) --->
+
+template <typename T> requires detail::CheckedBatchInteger<T>
+OptionColumn<T> checked_add(const OptionColumn<T>& lhs, const OptionColumn<T>& rhs) { return detail::apply_checked_to_columns<detail::CheckedAddOp>(lhs, rhs); }
+
+template <typename T> requires detail::CheckedBatchInteger<T>
+OptionColumn<T> checked_sub(const OptionColumn<T>& lhs, const OptionColumn<T>& rhs) { return detail::apply_checked_to_columns<detail::CheckedSubOp>(lhs, rhs); }
+
+template <typename T> requires detail::CheckedBatchInteger<T>
+OptionColumn<T> checked_mul(const OptionColumn<T>& lhs, const OptionColumn<T>& rhs) { return detail::apply_checked_to_columns<detail::CheckedMulOp>(lhs, rhs); }
+
+template <typename T> requires detail::CheckedBatchInteger<T>
+Option<T> checked_sum(const OptionColumn<T>& column) noexcept {
+  if (column.count_some() != column.size()) return Option<T>();
+
+  detail::ExactSum total;
+  const T* data = column.values().data();
+  for (std::size_t first = 0; first < column.size(); first += detail::sum_block) {
+    const std::size_t size = std::min(detail::sum_block, column.size() - first);
+    detail::sum_wide_t<T> mask = 0;
+    const auto sum = tmn::detail::dispatch_simd<detail::ColumnSumKernel<T>>(data + first, size, &mask);
+    if (detail::sum_is_exact<T>(mask, size)) total.add(sum);
+    else detail::ColumnSumKernel<T>::exact(data + first, size, total);
+  }
+  if (!total.fits<T>()) return Option<T>();
+  return Option<T>(total.value<T>());
+}
+
+} // namespace tmn::batch;
+
+#endif // TMN_THROWLESS_BATCH_CHECKED_HPP
@@ -0,0 +1,152 @@
+#ifndef TMN_THROWLESS_BATCH_REDUCE_HPP
+#define TMN_THROWLESS_BATCH_REDUCE_HPP
+
+#include <atomic>
+#include <vector>
+#include <ranges> // for: random_access_range, sized_range, begin, size;
+#include <cstddef> // for: size_t;
+#include <utility> // for: move;
+#include <concepts> // for: invocable, convertible_to;
+#include <type_traits> // for: invoke_result_t, is_void_v, is_reference_v;
+
+#include "../Option/Option.hpp"
+#include "../Result/Result.hpp"
+#include "../../src/Batch/BatchTraits.hpp"
+#include "../../src/Batch/ParallelChunks.hpp"
+
+namespace tmn::batch {
+
+//* <--- Parallel reduction of Option / Result sequences --->
+
+// parallel_reduce(options, op)       -> Option<T>: None if the range is empty or has a None;
+// parallel_reduce(options, init, op) -> Option<T>: Some(init) for an empty range;
+// try_reduce(results, init, op)      -> Result<T, E>: the first Err (lowest index) if any;
+//
+// `op(T, T) -> T` combines the values: with std::plus<> / std::multiplies<> the result is
+// the fold of the Option monoid operators (`+=`, `*=`), the None / Err is absorbing;
+//   auto total = tmn::batch::parallel_reduce(samples, std::plus<>{});
+//   auto product = tmn::batch::try_reduce(parsed, 1L, std::multiplies<>{}, {.threads = 8});
+// Every chunk (see ParallelConfig) is folded left to right and the partial results are
+// combined in chunk order: for an associative `op` the result is the one of the sequential
+// fold, and it is the same for any number of threads; `op` is called concurrently and must not throw;
+// the first None / Err stops the work: chunks after it are not read;
+
+namespace detail {
+
+template <typename Range>
+concept ParallelRange = std::ranges::random_access_range<Range> && std::ranges::sized_range<Range>;
+
+template <typename Range>
+concept ParallelOptionRange = ParallelRange<Range> && !std::is_void_v<option_payload_t<Range>> &&
+  !std::is_reference_v<option_payload_t<Range>>;
+
+template <typename Range>
+concept ParallelResultRange = ParallelRange<Range> && !std::is_void_v<typename result_payload_t<Range>::value_type> &&
+  !std::is_reference_v<typename result_payload_t<Range>::value_type>;
+
+template <typename Op, typename T>
+concept ReduceOp = std::invocable<const Op&, const T&, const T&> &&
+  std::convertible_to<std::invoke_result_t<const Op&, const T&, const T&>, T>;
+
+template <typename Range>
+decltype(auto) element_at(const Range& range, std::size_t index) {
+  return std::ranges::begin(range)[static_cast<std::ranges::range_difference_t<const Range>>(index)];
+}
+
+// Fold of the chunks of `range`: `is_present(elem)` tells the values from the failures,
+// `value_of(elem)` gives the value, `fail(index)` records a failure and stops the chunk;
+// chunks for which `skip(first)` holds are not read; returns the partial result of every chunk
+// (None for skipped and failed chunks):
+template <typename T, typename Range, typename Op, typename IsPresent, typename ValueOf, typename Skip, typename Fail>
+std::vector<Option<T>> reduce_chunks(const Range& range, const Op& op, const ParallelConfig& config,
+                                     const IsPresent& is_present, const ValueOf& value_of, const Skip& skip, const Fail& fail) {
+  const std::size_t count = static_cast<std::size_t>(std::ranges::size(range));
+  std::vector<Option<T>> partials(tmn::detail::chunk_count(count, config));
+
+  tmn::detail::run_chunks(count, config, [&](std::size_t chunk, std::size_t first, std::size_t last) {
+    if (skip(first)) return;
+    if (!is_present(element_at(range, first))) {
+      fail(first);
+      return;
+    }
+
+    T acc = value_of(element_at(range, first));
+    for (std::size_t i = first + 1; i < last; ++i) {
+      const auto& elem = element_at(range, i);
+      if (!is_present(elem)) [[unlikely]] {
+        fail(i);
+        return;
+      }
+      acc = op(std::move(acc), value_of(elem));
+    }
+    partials[chunk] = Option<T>(std::move(acc));
+  });
+
+  return partials;
+}
+
+// Partial results (all present) combined in chunk order:
+template <typename T, typename Op>
+T combine_partials(T acc, std::vector<Option<T>>& partials, std::size_t from, const Op& op) {
+  for (std::size_t chunk = from; chunk < partials.size(); ++chunk) {
+    acc = op(std::move(acc), partials[chunk].value_unchecked());
+  }
+  return acc;
+}
+
+template <typename Range, typename Op>
+std::vector<Option<option_payload_t<Range>>> reduce_options(const Range& options, const Op& op, const ParallelConfig& config,
+                                                            std::atomic<bool>& found_none) {
+  using T = option_payload_t<Range>;
+  return reduce_chunks<T>(options, op, config,
+    [](const auto& opt) { return opt.has_value(); },
+    [](const auto& opt) -> const T& { return opt.value_unchecked(); },
+    [&](std::size_t) { return found_none.load(std::memory_order_relaxed); },
+    [&](std::size_t) { found_none.store(true, std::memory_order_relaxed); });
+}
+
+} // namespace tmn::batch::detail;
+
+template <typename Range, typename Op> requires (detail::ParallelOptionRange<Range> && detail::ReduceOp<Op, detail::option_payload_t<Range>>)
+auto parallel_reduce(const Range& options, const Op& op, const ParallelConfig& config = {}) -> Option<detail::option_payload_t<Range>> {
+  using T = detail::option_payload_t<Range>;
+  std::atomic<bool> found_none{false};
+  auto partials = detail::reduce_options(options, op, config, found_none);
+  if (partials.empty() || found_none.load(std::memory_order_relaxed)) return Option<T>();
+
+  T first = std::move(partials.front().value_unchecked());
+  return Option<T>(detail::combine_partials(std::move(first), partials, 1, op));
+}
+
+template <typename Range, typename Op> requires (detail::ParallelOptionRange<Range> && detail::ReduceOp<Op, detail::option_payload_t<Range>>)
+auto parallel_reduce(const Range& options, detail::option_payload_t<Range> init, const Op& op, const ParallelConfig& config = {})
+  -> Option<detail::option_payload_t<Range>>
+{
+  using T = detail::option_payload_t<Range>;
+  std::atomic<bool> found_none{false};
+  auto partials = detail::reduce_options(options, op, config, found_none);
+  if (found_none.load(std::memory_order_relaxed)) return Option<T>();
+  return Option<T>(detail::combine_partials(std::move(init), partials, 0, op));
+}
+
+template <typename Range, typename Op> requires (detail::ParallelResultRange<Range> && detail::ReduceOp<Op, typename detail::result_payload_t<Range>::value_type>)
+auto try_reduce(const Range& results, typename detail::result_payload_t<Range>::value_type init, const Op& op, const ParallelConfig& config = {})
+  -> Result<typename detail::result_payload_t<Range>::value_type, typename detail::result_payload_t<Range>::error_type>
+{
+  using T = typename detail::result_payload_t<Range>::value_type;
+  using E = typename detail::result_payload_t<Range>::error_type;
+
+  tmn::detail::FirstFailure failure;
+  auto partials = detail::reduce_chunks<T>(results, op, config,
+    [](const auto& res) { return res.is_ok(); },
+    [](const auto& res) -> const T& { return res.unwrap_unchecked(); },
+    [&](std::size_t first) { return failure.is_after(first); },
+    [&](std::size_t index) { failure.record(index); });
+
+  if (failure.failed()) return Result<T, E>::Err(detail::element_at(results, failure.index()).unwrap_err_unchecked());
+  return Result<T, E>::Ok(detail::combine_partials(std::move(init), partials, 0, op));
+}
+
+} // namespace tmn::batch;
+
+#endif // TMN_THROWLESS_BATCH_REDUCE_HPP
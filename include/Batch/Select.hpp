@@ -0,0 +1,220 @@
+#ifndef TMN_THROWLESS_BATCH_SELECT_HPP
+#define TMN_THROWLESS_BATCH_SELECT_HPP
+
+#include <bit> // for: popcount, countr_zero;
+#include <span>
+#include <vector>
+#include <ranges> // for: contiguous_range, range_value_t, data, size;
+#include <cstddef> // for: size_t;
+#include <cstdint> // for: uint64_t;
+#include <algorithm> // for: min;
+#include <type_traits> // for: remove_cv_t, is_void_v, is_reference_v;
+
+#include "../Option/Option.hpp"
+#include "../Option/OptionColumn.hpp"
+#include "../Result/Result.hpp"
+#include "../../src/Option/OptionStorage.hpp"
+#include "../../src/Result/ResultStorage.hpp"
+#include "../../src/Batch/SimdDispatch.hpp"
+#include "../../src/Batch/BatchTraits.hpp"
+
+#ifdef TMN_THROWLESS_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace tmn::batch {
+
+//* <--- Filtering and compaction of optional values --->
+
+// compact_some(options)          -> std::vector<T>: values of Some, in order;
+// partition_results(results)     -> {oks, errs}: values of Ok and errors of Err, in order;
+// select_mask(values, bitmap)    -> std::vector<T>: values whose bit is set (bit i of word i / 64);
+// compact_some(OptionColumn<T>)  == select_mask(column.values(), column.validity());
+//
+// The outputs are allocated once: the number of selected elements is counted first
+// (popcount of the bitmap, sum of the presence flags);
+// arithmetic payloads (every bit pattern is a value) are copied without a branch per
+// element: each value is stored at the output cursor and the cursor advances by the flag;
+// bitmaps of 4- and 8-byte values are compacted with the AVX-512 compress instructions;
+// other payloads are copied with a branch (the same result, any copyable type);
+
+template <typename T, typename E>
+struct PartitionedResults {
+  std::vector<T> oks;
+  std::vector<E> errs;
+};
+
+namespace detail {
+
+template <typename Range>
+concept OptionRange = std::ranges::contiguous_range<Range> && !std::is_void_v<option_payload_t<Range>> &&
+  !std::is_reference_v<option_payload_t<Range>>;
+
+template <typename Range>
+concept ResultRange = std::ranges::contiguous_range<Range> && !std::is_void_v<typename result_payload_t<Range>::value_type> &&
+  !std::is_reference_v<typename result_payload_t<Range>::value_type>;
+
+// Bit `count` and the following bits of the last word are ignored:
+inline std::size_t count_selected(std::span<const std::uint64_t> words, std::size_t count) noexcept {
+  std::size_t selected = 0;
+  const std::size_t full_words = count / 64;
+  for (std::size_t w = 0; w < full_words; ++w) selected += static_cast<std::size_t>(std::popcount(words[w]));
+  if (count % 64 != 0) {
+    selected += static_cast<std::size_t>(std::popcount(words[full_words] & ((std::uint64_t{1} << (count % 64)) - 1)));
+  }
+  return selected;
+}
+
+// Values selected by a bitmap: the scalar loop jumps from one set bit to the next
+// (a branch per word, not per element), AVX-512 compresses 8 / 16 values at a time:
+template <typename T>
+struct SelectKernel {
+  [[TMN_THROWLESS_KERNEL_INLINE]] static void run(const T* values, const std::uint64_t* words, std::size_t count, T* out) noexcept {
+    for (std::size_t w = 0; w * 64 < count; ++w) {
+      std::uint64_t bits = words[w];
+      if ((w + 1) * 64 > count) bits &= (std::uint64_t{1} << (count % 64)) - 1;
+      const T* block = values + w * 64;
+      while (bits != 0) {
+        *out++ = block[std::countr_zero(bits)];
+        bits &= bits - 1;
+      }
+    }
+  }
+
+#ifdef TMN_THROWLESS_SIMD_DISPATCH
+  [[TMN_THROWLESS_TARGET_AVX512]] static void run_avx512(const T* values, const std::uint64_t* words, std::size_t count, T* out) noexcept {
+    if constexpr (sizeof(T) == 8 || sizeof(T) == 4) {
+      constexpr std::size_t lanes = 64 / sizeof(T);
+      std::size_t i = 0;
+      for (; i + lanes <= count; i += lanes) {
+        const std::uint64_t bits = words[i / 64] >> (i % 64);
+        const __m512i block = _mm512_loadu_si512(values + i);
+        if constexpr (sizeof(T) == 8) {
+          const auto mask = static_cast<__mmask8>(bits);
+          _mm512_mask_compressstoreu_epi64(out, mask, block);
+          out += std::popcount(static_cast<unsigned>(mask));
+        }
+        else {
+          const auto mask = static_cast<__mmask16>(bits);
+          _mm512_mask_compressstoreu_epi32(out, mask, block);
+          out += std::popcount(static_cast<unsigned>(mask));
+        }
+      }
+      for (; i < count; ++i) {
+        if ((words[i / 64] >> (i % 64)) & 1) *out++ = values[i];
+      }
+    }
+    else {
+      run(values, words, count, out);
+    }
+  }
+#endif
+};
+
+} // namespace tmn::batch::detail;
+
+//*   <--- selection by a bitmap --->
+
+// Only the first min(values, 64 * words) values are considered:
+template <std::ranges::contiguous_range Values>
+auto select_mask(const Values& values, std::span<const std::uint64_t> mask_words) {
+  using T = std::remove_cv_t<std::ranges::range_value_t<Values>>;
+  const std::size_t count = std::min(static_cast<std::size_t>(std::ranges::size(values)), mask_words.size() * 64);
+  const T* data = std::ranges::data(values);
+
+  std::vector<T> result;
+  if constexpr (detail::BatchArithmetic<T>) {
+    result.resize(detail::count_selected(mask_words, count));
+    tmn::detail::dispatch_simd<detail::SelectKernel<T>>(data, mask_words.data(), count, result.data());
+  }
+  else {
+    result.reserve(detail::count_selected(mask_words, count));
+    for (std::size_t w = 0; w * 64 < count; ++w) {
+      std::uint64_t bits = mask_words[w];
+      if ((w + 1) * 64 > count) bits &= (std::uint64_t{1} << (count % 64)) - 1;
+      while (bits != 0) {
+        result.push_back(data[w * 64 + static_cast<std::size_t>(std::countr_zero(bits))]);
+        bits &= bits - 1;
+      }
+    }
+  }
+  return result;
+}
+
+//*   <--- compaction of Some values --->
+
+template <typename T>
+std::vector<T> compact_some(const OptionColumn<T>& column) {
+  return select_mask(column.values(), column.validity());
+}
+
+template <typename Options> requires detail::OptionRange<Options>
+auto compact_some(const Options& options) {
+  using T = detail::option_payload_t<Options>;
+  const auto* data = std::ranges::data(options);
+  const std::size_t count = static_cast<std::size_t>(std::ranges::size(options));
+
+  std::size_t selected = 0;
+  for (std::size_t i = 0; i < count; ++i) selected += data[i].has_value() ? 1 : 0;
+
+  std::vector<T> result;
+  if constexpr (detail::BatchArithmetic<T>) {
+    // one slot of slack: the value of a trailing None is stored past the last Some;
+    result.resize(selected + 1);
+    T* out = result.data();
+    for (std::size_t i = 0; i < count; ++i) {
+      *out = tmn::detail::OptionStorage::load_raw(data[i]);
+      out += data[i].has_value() ? 1 : 0;
+    }
+    result.pop_back();
+  }
+  else {
+    result.reserve(selected);
+    for (std::size_t i = 0; i < count; ++i) {
+      if (data[i].has_value()) result.push_back(data[i].value_unchecked());
+    }
+  }
+  return result;
+}
+
+//*   <--- partition of Results --->
+
+// Values of Ok go to `oks`, errors of Err go to `errs`, the order is kept in both;
+// for arithmetic values the Ok path is branch-free and the Err path is a branch
+// (cheap when errors are rare: the branch is predicted);
+template <typename Results> requires detail::ResultRange<Results>
+auto partition_results(const Results& results) {
+  using T = typename detail::result_payload_t<Results>::value_type;
+  using E = typename detail::result_payload_t<Results>::error_type;
+  const auto* data = std::ranges::data(results);
+  const std::size_t count = static_cast<std::size_t>(std::ranges::size(results));
+
+  std::size_t ok_count = 0;
+  for (std::size_t i = 0; i < count; ++i) ok_count += data[i].is_ok() ? 1 : 0;
+
+  PartitionedResults<T, E> parts;
+  parts.errs.reserve(count - ok_count);
+  if constexpr (detail::BatchArithmetic<T>) {
+    parts.oks.resize(ok_count + 1);
+    T* out = parts.oks.data();
+    for (std::size_t i = 0; i < count; ++i) {
+      const bool is_ok = data[i].is_ok();
+      *out = tmn::detail::ResultStorage::load_raw(data[i]);
+      out += is_ok ? 1 : 0;
+      if (!is_ok) [[unlikely]] parts.errs.push_back(data[i].unwrap_err_unchecked());
+    }
+    parts.oks.pop_back();
+  }
+  else {
+    parts.oks.reserve(ok_count);
+    for (std::size_t i = 0; i < count; ++i) {
+      if (data[i].is_ok()) parts.oks.push_back(data[i].unwrap_unchecked());
+      else parts.errs.push_back(data[i].unwrap_err_unchecked());
+    }
+  }
+  return parts;
+}
+
+} // namespace tmn::batch;
+
+#endif // TMN_THROWLESS_BATCH_SELECT_HPP
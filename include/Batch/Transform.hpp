@@ -0,0 +1,152 @@
+#ifndef TMN_THROWLESS_BATCH_TRANSFORM_HPP
+#define TMN_THROWLESS_BATCH_TRANSFORM_HPP
+
+#include <string>
+#include <vector>
+#include <ranges> // for: random_access_range, sized_range, range_reference_t, begin, size;
+#include <cstddef> // for: size_t;
+#include <utility> // for: move, forward;
+#include <algorithm> // for: min, max;
+#include <concepts> // for: invocable, same_as;
+#include <type_traits> // for: invoke_result_t, remove_cvref_t, conditional_t, is_void_v;
+
+#include "../Option/Option.hpp"
+#include "../Result/Result.hpp"
+#include "../Error/ErrorConcept.hpp"
+#include "../Error/ErrMsg.hpp"
+#include "../../src/Batch/BatchTraits.hpp"
+#include "../../src/Batch/ParallelChunks.hpp"
+
+namespace tmn::batch {
+
+//* <--- Parallel fallible transformation --->
+
+// try_transform(config, input, output, fn) -> Result<void, IndexedErr<E>>:
+// `output[i]` = value of `fn(input[i])` for the first min(sizes) elements, in parallel
+// (chunks and threads as in ParallelConfig); only the values are written, the Result
+// returned by `fn` is unpacked in place;
+//   std::vector<Record> records(lines.size());
+//   auto status = tmn::batch::try_transform({.threads = 8}, lines, records, parse_record);
+//   if (status.is_err()) report(status.unwrap_err().index, status.unwrap_err().error);
+// `fn` is either `fn(const In&) -> Result<Out, E>`, or `fn(const In&, Out&) -> Result<void, E>`,
+// which writes the output element itself (no value is moved through a Result);
+// the first Err cancels the rest: threads stop before the next element once an Err with
+// a lower index is known, so the reported error is the first one (lowest index) and
+// output[0, index) is fully written; the other elements are unspecified;
+// `fn` is called concurrently and must not throw;
+
+// Error of the element `index` of a batch; the message "element <index>: <message of
+// the error>" is rendered once, when the error is created, so `what()` and `err_msg()`
+// return the same text:
+template <typename E> requires err::Error<E>
+class IndexedErr {
+public: //* fields:
+  std::size_t index = 0;
+  E error;
+
+private: //* fields:
+  err::ErrMsg msg_;
+
+public: //* methods:
+  IndexedErr(std::size_t index, E error)
+    : index(index), error(std::move(error)), msg_("element " + std::to_string(index) + ": " + std::string(this->error.err_msg())) {}
+
+  std::string err_msg() const { return msg_.str(); }
+  const char* what() const noexcept { return msg_.c_str(); }
+
+  bool operator==(const IndexedErr& oth) const { return index == oth.index && error == oth.error; }
+};
+
+namespace detail {
+
+// The two forms of `fn`: value-returning and writing in place:
+template <typename Fn, typename In, typename Out>
+struct TransformErrOf {
+  using type = void;
+};
+
+template <typename Fn, typename In, typename Out>
+requires std::invocable<const Fn&, const In&>
+struct TransformErrOf<Fn, In, Out> {
+  using result_type = std::remove_cvref_t<std::invoke_result_t<const Fn&, const In&>>;
+  using type = std::conditional_t<std::same_as<typename ResultPayload<result_type>::value_type, Out>,
+                                  typename ResultPayload<result_type>::error_type, void>;
+  static constexpr bool writes_in_place = false;
+};
+
+template <typename Fn, typename In, typename Out>
+requires (!std::invocable<const Fn&, const In&> && std::invocable<const Fn&, const In&, Out&>)
+struct TransformErrOf<Fn, In, Out> {
+  using result_type = std::remove_cvref_t<std::invoke_result_t<const Fn&, const In&, Out&>>;
+  using type = std::conditional_t<std::is_void_v<typename ResultPayload<result_type>::value_type>,
+                                  typename ResultPayload<result_type>::error_type, void>;
+  static constexpr bool writes_in_place = true;
+};
+
+template <typename Output>
+using transform_out_t = std::remove_cvref_t<std::ranges::range_reference_t<Output>>;
+
+// Error type of `fn` (void if `fn` does not match either form):
+template <typename Fn, typename Input, typename Output>
+using transform_err_t = typename TransformErrOf<Fn, std::ranges::range_value_t<Input>, transform_out_t<Output>>::type;
+
+template <typename Fn, typename Input, typename Output>
+concept TransformArgs = std::ranges::random_access_range<Input> && std::ranges::sized_range<Input> &&
+  std::ranges::random_access_range<Output> && std::ranges::sized_range<Output> &&
+  !std::is_void_v<transform_err_t<Fn, Input, Output>>;
+
+} // namespace tmn::batch::detail;
+
+template <typename Input, typename Output, typename Fn> requires detail::TransformArgs<Fn, Input, Output>
+auto try_transform(const ParallelConfig& config, const Input& input, Output&& output, const Fn& fn)
+  -> Result<void, IndexedErr<detail::transform_err_t<Fn, Input, Output>>>
+{
+  using In = std::ranges::range_value_t<Input>;
+  using Out = detail::transform_out_t<Output>;
+  using E = detail::transform_err_t<Fn, Input, Output>;
+  using Status = Result<void, IndexedErr<E>>;
+  constexpr bool writes_in_place = detail::TransformErrOf<Fn, In, Out>::writes_in_place;
+
+  const std::size_t count = std::min(static_cast<std::size_t>(std::ranges::size(input)), static_cast<std::size_t>(std::ranges::size(output)));
+  const auto in = std::ranges::begin(input);
+  const auto out = std::ranges::begin(output);
+
+  // at most one error per chunk (its first one): the chunk of the first failure holds its error;
+  std::vector<Option<E>> chunk_errors(tmn::detail::chunk_count(count, config));
+  tmn::detail::FirstFailure failure;
+
+  tmn::detail::run_chunks(count, config, [&](std::size_t chunk, std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      if (failure.is_after(i)) return;
+
+      const auto offset = static_cast<std::ranges::range_difference_t<const Input>>(i);
+      auto res = [&] {
+        if constexpr (writes_in_place) return fn(in[offset], out[static_cast<std::ranges::range_difference_t<Output>>(i)]);
+        else return fn(in[offset]);
+      }();
+
+      if (!res.is_ok()) [[unlikely]] {
+        chunk_errors[chunk] = Option<E>(std::move(res.unwrap_err_unchecked()));
+        failure.record(i);
+        return;
+      }
+      if constexpr (!writes_in_place) {
+        out[static_cast<std::ranges::range_difference_t<Output>>(i)] = std::move(res.unwrap_unchecked());
+      }
+    }
+  });
+
+  if (!failure.failed()) return Status::Ok();
+  const std::size_t index = failure.index();
+  const std::size_t grain = std::max<std::size_t>(config.grain, 1);
+  return Status::Err(IndexedErr<E>{index, std::move(chunk_errors[index / grain].value_unchecked())});
+}
+
+template <typename Input, typename Output, typename Fn> requires detail::TransformArgs<Fn, Input, Output>
+auto try_transform(const Input& input, Output&& output, const Fn& fn) {
+  return try_transform(ParallelConfig{}, input, std::forward<Output>(output), fn);
+}
+
+} // namespace tmn::batch;
+
+#endif // TMN_THROWLESS_BATCH_TRANSFORM_HPP
@@ -0,0 +1,100 @@
+#ifndef TMN_THROWLESS_BOXED_ERROR_HPP
+#define TMN_THROWLESS_BOXED_ERROR_HPP
+
+#include <string>
+#include <span>
+#include <cstddef> // for: size_t;
+#include <utility> // for: exchange, forward;
+#include <concepts> // for: constructible_from;
+#include <type_traits> // for: remove_cvref_t;
+
+#include "ErrorConcept.hpp"
+#include "../Panic/Panic.hpp" // for: TMN_THROWLESS_ASSUME;
+
+namespace tmn::err {
+
+//* <--- Cold (out of line) storage for errors --->
+
+// Boxed<E> keeps the error on the heap and only a pointer inline.
+// Errors are expected to be rare, so the allocation is paid only on the
+// failure path, while the successful `Result<T, Boxed<E>>` stays small:
+// for example, `Result<int, Boxed<AnyErr>>` is 16 bytes instead of 48;
+// Boxed<E> satisfies Error concept by forwarding to the boxed error;
+template <typename E> requires Error<E>
+class Boxed {
+private: //* fields:
+  // nullptr only for moved-from objects:
+  E* error_ptr = nullptr;
+
+public: //* methods:
+  //*   <--- constructors, (~)ro5, destructor --->
+  // constructors are not declared `explicit` (like the rest of the Error wrappers),
+  // so that `Result<T, Boxed<E>>::Err(E{...})` works without repeating `Boxed`:
+  Boxed(const E& error) : error_ptr(new E(error)) {}
+  Boxed(E&& error) : error_ptr(new E(std::move(error))) {}
+
+  template <typename... Args>
+  requires (std::constructible_from<E, Args...> && !(std::same_as<std::remove_cvref_t<Args>, Boxed> || ...))
+  Boxed(Args&&... args) : error_ptr(new E(std::forward<Args>(args)...)) {}
+
+  Boxed(const Boxed& oth) : error_ptr(oth.error_ptr ? new E(*oth.error_ptr) : nullptr) {}
+  Boxed(Boxed&& oth) noexcept : error_ptr(std::exchange(oth.error_ptr, nullptr)) {}
+
+  Boxed& operator=(const Boxed& oth) {
+    if (this != &oth) {
+      Boxed tmp(oth);
+      std::swap(error_ptr, tmp.error_ptr);
+    }
+    return *this;
+  }
+
+  Boxed& operator=(Boxed&& oth) noexcept {
+    if (this != &oth) {
+      delete error_ptr;
+      error_ptr = std::exchange(oth.error_ptr, nullptr);
+    }
+    return *this;
+  }
+
+  ~Boxed() { delete error_ptr; }
+
+  //*   <--- access to the boxed error --->
+  // A moved-from Boxed holds no error: `empty()` is true, the Error interface below
+  // returns empty messages, and the accessors must not be used (asserted in debug
+  // builds, see TMN_THROWLESS_ASSUME) until a new error is assigned;
+  bool empty() const noexcept { return error_ptr == nullptr; }
+
+  const E& get() const noexcept { return *checked_ptr(); }
+  E& get() noexcept { return *checked_ptr(); }
+  const E& operator*() const noexcept { return *checked_ptr(); }
+  E& operator*() noexcept { return *checked_ptr(); }
+  const E* operator->() const noexcept { return checked_ptr(); }
+  E* operator->() noexcept { return checked_ptr(); }
+
+  //*   <--- Error interface --->
+  std::string err_msg() const { return error_ptr ? std::string(error_ptr->err_msg()) : std::string(); }
+  const char* what() const noexcept { return error_ptr ? error_ptr->what() : ""; }
+
+  std::size_t write_msg(std::span<char> out) const noexcept requires BufferWritableError<E> {
+    if (error_ptr != nullptr) return error_ptr->write_msg(out);
+    if (!out.empty()) out[0] = '\0';
+    return 0;
+  }
+
+  bool operator==(const Boxed& oth) const noexcept {
+    if (error_ptr == nullptr || oth.error_ptr == nullptr) {
+      return error_ptr == oth.error_ptr;
+    }
+    return *error_ptr == *oth.error_ptr;
+  }
+
+private: //* methods:
+  E* checked_ptr() const noexcept {
+    TMN_THROWLESS_ASSUME(error_ptr != nullptr, "Boxed: access to the error of a moved-from object");
+    return error_ptr;
+  }
+};
+
+} // namespace tmn::err;
+
+#endif // TMN_THROWLESS_BOXED_ERROR_HPP
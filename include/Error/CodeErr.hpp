@@ -0,0 +1,271 @@
+#ifndef TMN_THROWLESS_CODE_ERROR_HPP
+#define TMN_THROWLESS_CODE_ERROR_HPP
+
+#include <span>
+#include <array>
+#include <cerrno> // for: errno;
+#include <cstddef> // for: size_t;
+#include <string_view>
+#include <type_traits> // for: is_enum_v, underlying_type_t, is_trivially_copyable_v;
+#include <system_error> // for: std::errc;
+
+#include "ErrorConcept.hpp"
+#include "ErrMsg.hpp"
+#include "Error.hpp"
+
+namespace tmn::err {
+
+//* <--- Error codes: enum value + compile-time table of messages --->
+
+// Usage:
+//   enum class ParseCode { UnexpectedEof = 1, BadDigit, Overflow };
+//
+//   template <>
+//   struct tmn::err::ErrCodeCategory<ParseCode> {
+//     static constexpr const char* name = "parse";
+//     static constexpr auto messages = tmn::err::code_messages<ParseCode>({
+//       {ParseCode::UnexpectedEof, "Unexpected end of input"},
+//       {ParseCode::BadDigit,      "Invalid digit"},
+//       {ParseCode::Overflow,      "Number does not fit into the type"},
+//     });
+//   };
+//
+//   Result<int, CodeErr<ParseCode>> parse_int(std::string_view s); // sizeof == 8
+//   ...
+//   return Result<int, CodeErr<ParseCode>>::Err(ParseCode::BadDigit);
+template <typename Enum>
+struct ErrCodeCategory; // specialized by the user for every enum of codes;
+
+template <typename Enum>
+struct CodeMessage {
+  Enum code;
+  const char* msg;
+};
+
+namespace detail {
+
+// Not constexpr: a call from the consteval constructor of CodeTable is a compile error
+// that names the problem (works without exceptions, unlike `throw` in constant evaluation):
+inline void duplicate_code_in_the_table_of_error_messages() {}
+
+} // namespace tmn::err::detail;
+
+// Table of messages built at compile time (sorted by code, checked for duplicates):
+// dense tables (codes 0..N-1 or 1..N) are indexed directly, sparse ones are searched;
+template <typename Enum, std::size_t N>
+class CodeTable {
+private: //* fields:
+  std::array<CodeMessage<Enum>, N> entries_{};
+  bool dense_ = true;
+
+  static constexpr auto value_of(Enum code) noexcept { return static_cast<std::underlying_type_t<Enum>>(code); }
+
+public: //* methods:
+  consteval CodeTable(const CodeMessage<Enum> (&entries)[N]) {
+    for (std::size_t i = 0; i < N; ++i) {
+      // insertion sort by the code value:
+      std::size_t j = i;
+      while (j > 0 && value_of(entries_[j - 1].code) > value_of(entries[i].code)) {
+        entries_[j] = entries_[j - 1];
+        --j;
+      }
+      entries_[j] = entries[i];
+    }
+
+    for (std::size_t i = 1; i < N; ++i) {
+      if (value_of(entries_[i - 1].code) == value_of(entries_[i].code)) {
+        detail::duplicate_code_in_the_table_of_error_messages();
+      }
+      if (value_of(entries_[i].code) != value_of(entries_[0].code) + static_cast<std::underlying_type_t<Enum>>(i)) {
+        dense_ = false;
+      }
+    }
+  }
+
+  // nullptr if the code is not in the table:
+  constexpr const char* find(Enum code) const noexcept {
+    if constexpr (N == 0) {
+      return nullptr;
+    }
+    else {
+      const auto value = value_of(code);
+      if (dense_) {
+        const auto first = value_of(entries_[0].code);
+        if (value < first || value > value_of(entries_[N - 1].code)) return nullptr;
+        return entries_[static_cast<std::size_t>(value - first)].msg;
+      }
+
+      std::size_t left = 0;
+      std::size_t right = N;
+      while (left < right) {
+        const std::size_t middle = left + (right - left) / 2;
+        if (value_of(entries_[middle].code) < value) left = middle + 1;
+        else right = middle;
+      }
+      return (left < N && value_of(entries_[left].code) == value) ? entries_[left].msg : nullptr;
+    }
+  }
+};
+
+template <typename Enum, std::size_t N>
+consteval CodeTable<Enum, N> code_messages(const CodeMessage<Enum> (&entries)[N]) {
+  return CodeTable<Enum, N>(entries);
+}
+
+template <typename Enum>
+concept ErrCodeEnum = std::is_enum_v<Enum> && sizeof(Enum) <= 4 && requires(Enum code) {
+  { ErrCodeCategory<Enum>::name } -> std::convertible_to<const char*>;
+  { ErrCodeCategory<Enum>::messages.find(code) } -> std::convertible_to<const char*>;
+};
+
+// CodeErr stores only the code: the category and the messages are static per Enum,
+// so the error is trivially copyable, does not allocate and has the size of the enum;
+// conversion to AnyErr is explicit (the message stays a pointer to the static table);
+template <ErrCodeEnum Enum>
+class CodeErr {
+private: //* fields:
+  Enum code_{};
+
+public: //* methods:
+  constexpr CodeErr() noexcept = default;
+  constexpr CodeErr(Enum code) noexcept : code_(code) {}
+
+  constexpr Enum code() const noexcept { return code_; }
+  constexpr auto value() const noexcept { return static_cast<std::underlying_type_t<Enum>>(code_); }
+  static constexpr const char* category() noexcept { return ErrCodeCategory<Enum>::name; }
+
+  //*   <--- Error interface --->
+  constexpr const char* what() const noexcept {
+    const char* msg = ErrCodeCategory<Enum>::messages.find(code_);
+    return msg != nullptr ? msg : "Unknown error code";
+  }
+
+  // `const char*` is convertible to std::string: no allocation until the caller needs a string;
+  constexpr const char* err_msg() const noexcept { return what(); }
+
+  std::size_t write_msg(std::span<char> out) const noexcept { return MsgWriter(out).append(what()).finish(); }
+
+  constexpr bool operator==(const CodeErr& oth) const noexcept = default;
+  constexpr bool operator==(Enum code) const noexcept { return code_ == code; }
+
+  //*   <--- conversions --->
+  AnyErr to_any_err() const noexcept { return AnyErr(ErrMsg::from_static_storage(what())); }
+  explicit operator AnyErr() const noexcept { return to_any_err(); }
+};
+
+//* <--- errno: codes of std::errc with the POSIX messages --->
+
+// Every enumerator of std::errc with the text of glibc strerror (checked against
+// std::generic_category() by the tests); the aliases (operation_would_block and
+// resource_unavailable_try_again, operation_not_supported and not_supported) share
+// one entry where their values are equal. The texts are static: `what()` stays
+// noexcept and thread-safe, unlike strerror, and does not allocate, unlike
+// std::generic_category().message();
+template <>
+struct ErrCodeCategory<std::errc> {
+  static constexpr const char* name = "generic";
+  static constexpr auto messages = code_messages<std::errc>({
+    {std::errc::operation_not_permitted,             "Operation not permitted"},
+    {std::errc::no_such_file_or_directory,           "No such file or directory"},
+    {std::errc::no_such_process,                     "No such process"},
+    {std::errc::interrupted,                         "Interrupted system call"},
+    {std::errc::io_error,                            "Input/output error"},
+    {std::errc::no_such_device_or_address,           "No such device or address"},
+    {std::errc::argument_list_too_long,              "Argument list too long"},
+    {std::errc::executable_format_error,             "Exec format error"},
+    {std::errc::bad_file_descriptor,                 "Bad file descriptor"},
+    {std::errc::no_child_process,                    "No child processes"},
+#if EWOULDBLOCK != EAGAIN
+    {std::errc::operation_would_block,               "Resource temporarily unavailable"},
+#endif
+    {std::errc::resource_unavailable_try_again,      "Resource temporarily unavailable"},
+    {std::errc::not_enough_memory,                   "Cannot allocate memory"},
+    {std::errc::permission_denied,                   "Permission denied"},
+    {std::errc::bad_address,                         "Bad address"},
+    {std::errc::device_or_resource_busy,             "Device or resource busy"},
+    {std::errc::file_exists,                         "File exists"},
+    {std::errc::cross_device_link,                   "Invalid cross-device link"},
+    {std::errc::no_such_device,                      "No such device"},
+    {std::errc::not_a_directory,                     "Not a directory"},
+    {std::errc::is_a_directory,                      "Is a directory"},
+    {std::errc::invalid_argument,                    "Invalid argument"},
+    {std::errc::too_many_files_open_in_system,       "Too many open files in system"},
+    {std::errc::too_many_files_open,                 "Too many open files"},
+    {std::errc::inappropriate_io_control_operation,  "Inappropriate ioctl for device"},
+    {std::errc::text_file_busy,                      "Text file busy"},
+    {std::errc::file_too_large,                      "File too large"},
+    {std::errc::no_space_on_device,                  "No space left on device"},
+    {std::errc::invalid_seek,                        "Illegal seek"},
+    {std::errc::read_only_file_system,               "Read-only file system"},
+    {std::errc::too_many_links,                      "Too many links"},
+    {std::errc::broken_pipe,                         "Broken pipe"},
+    {std::errc::argument_out_of_domain,              "Numerical argument out of domain"},
+    {std::errc::result_out_of_range,                 "Numerical result out of range"},
+    {std::errc::resource_deadlock_would_occur,       "Resource deadlock avoided"},
+    {std::errc::filename_too_long,                   "File name too long"},
+    {std::errc::no_lock_available,                   "No locks available"},
+    {std::errc::function_not_supported,              "Function not implemented"},
+    {std::errc::directory_not_empty,                 "Directory not empty"},
+    {std::errc::too_many_symbolic_link_levels,       "Too many levels of symbolic links"},
+    {std::errc::no_message,                          "No message of desired type"},
+    {std::errc::identifier_removed,                  "Identifier removed"},
+    {std::errc::not_a_stream,                        "Device not a stream"},
+    {std::errc::no_message_available,                "No data available"},
+    {std::errc::stream_timeout,                      "Timer expired"},
+    {std::errc::no_stream_resources,                 "Out of streams resources"},
+    {std::errc::no_link,                             "Link has been severed"},
+    {std::errc::protocol_error,                      "Protocol error"},
+    {std::errc::bad_message,                         "Bad message"},
+    {std::errc::value_too_large,                     "Value too large for defined data type"},
+    {std::errc::illegal_byte_sequence,               "Invalid or incomplete multibyte or wide character"},
+    {std::errc::not_a_socket,                        "Socket operation on non-socket"},
+    {std::errc::destination_address_required,        "Destination address required"},
+    {std::errc::message_size,                        "Message too long"},
+    {std::errc::wrong_protocol_type,                 "Protocol wrong type for socket"},
+    {std::errc::no_protocol_option,                  "Protocol not available"},
+    {std::errc::protocol_not_supported,              "Protocol not supported"},
+    {std::errc::not_supported,                       "Operation not supported"},
+#if EOPNOTSUPP != ENOTSUP
+    {std::errc::operation_not_supported,             "Operation not supported"},
+#endif
+    {std::errc::address_family_not_supported,        "Address family not supported by protocol"},
+    {std::errc::address_in_use,                      "Address already in use"},
+    {std::errc::address_not_available,               "Cannot assign requested address"},
+    {std::errc::network_down,                        "Network is down"},
+    {std::errc::network_unreachable,                 "Network is unreachable"},
+    {std::errc::network_reset,                       "Network dropped connection on reset"},
+    {std::errc::connection_aborted,                  "Software caused connection abort"},
+    {std::errc::connection_reset,                    "Connection reset by peer"},
+    {std::errc::no_buffer_space,                     "No buffer space available"},
+    {std::errc::already_connected,                   "Transport endpoint is already connected"},
+    {std::errc::not_connected,                       "Transport endpoint is not connected"},
+    {std::errc::timed_out,                           "Connection timed out"},
+    {std::errc::connection_refused,                  "Connection refused"},
+    {std::errc::host_unreachable,                    "No route to host"},
+    {std::errc::connection_already_in_progress,      "Operation already in progress"},
+    {std::errc::operation_in_progress,               "Operation now in progress"},
+    {std::errc::operation_canceled,                  "Operation canceled"},
+    {std::errc::owner_dead,                          "Owner died"},
+    {std::errc::state_not_recoverable,               "State not recoverable"},
+  });
+};
+
+using ErrnoErr = CodeErr<std::errc>;
+
+inline ErrnoErr from_errno(int errno_value) noexcept {
+  return ErrnoErr(static_cast<std::errc>(errno_value));
+}
+
+// Current value of `errno` of the calling thread:
+inline ErrnoErr last_errno() noexcept {
+  return from_errno(errno);
+}
+
+static_assert(Error<ErrnoErr>, "CodeErr must satisfy Error concept");
+static_assert(BufferWritableError<ErrnoErr>, "CodeErr must be writable into buffers");
+static_assert(sizeof(ErrnoErr) == sizeof(std::errc) && std::is_trivially_copyable_v<ErrnoErr>,
+              "CodeErr must be a trivially copyable code");
+
+} // namespace tmn::err;
+
+#endif // TMN_THROWLESS_CODE_ERROR_HPP
@@ -0,0 +1,236 @@
+#ifndef TMN_THROWLESS_ERASED_ERROR_HPP
+#define TMN_THROWLESS_ERASED_ERROR_HPP
+
+#include <new> // for: placement new, launder;
+#include <span>
+#include <string>
+#include <string_view>
+#include <cstddef> // for: size_t, byte;
+#include <utility> // for: move, forward, swap;
+#include <concepts> // for: same_as;
+#include <type_traits> // for: remove_cvref_t, is_nothrow_move_constructible_v;
+
+#include "ErrorConcept.hpp"
+#include "ErrMsg.hpp"
+#include "ErrTypeInfo.hpp"
+#include "../Option/Option.hpp"
+
+namespace tmn::err {
+
+//* <--- Type-erased error with small buffer storage --->
+
+// ErasedErr keeps any Error by value without slicing it to a base class:
+//   Result<SharedPtr<T[]>, ErasedErr> r = ...;
+//   if (auto range_err = r.unwrap_err().downcast<OutOfRangeErr>()) {
+//     range_err.value().index(); // full fidelity of the original error;
+//   }
+// - errors up to 64 bytes (nothrow movable) are stored inline, larger ones on the heap
+//   (AnyErr, StrErr, OutOfRangeErr, EmptyArrErr, BadAllocErr, CodeErr fit inline);
+// - dispatch goes through a static table of function pointers per stored type
+//   (hand-rolled vtable): no RTTI, no virtual inheritance in the stored errors;
+// - `downcast<E>()` is checked: None if the stored error is not exactly E;
+// ErasedErr itself satisfies Error concept (message of the stored error);
+class ErasedErr {
+public: //* constants:
+  static constexpr std::size_t buffer_size = 64;
+  static constexpr std::size_t buffer_align = alignof(void*);
+
+  template <typename E>
+  static constexpr bool fits_inline =
+    sizeof(E) <= buffer_size && alignof(E) <= buffer_align && std::is_nothrow_move_constructible_v<E>;
+
+private: //* substructures:
+  struct VTable {
+    const ErrTypeInfo* type_info;
+    bool is_inline;
+
+    void (*copy)(const ErasedErr& from, ErasedErr& to);
+    void (*move)(ErasedErr& from, ErasedErr& to) noexcept;
+    void (*destroy)(ErasedErr& self) noexcept;
+
+    std::string (*err_msg)(const void* error);
+    const char* (*what)(const void* error) noexcept;
+    std::size_t (*write_msg)(const void* error, std::span<char> out);
+    bool (*equal)(const void* lhs, const void* rhs);
+  };
+
+private: //* fields:
+  union {
+    alignas(buffer_align) std::byte buffer_[buffer_size];
+    void* heap_ptr_;
+  };
+
+  // nullptr only for moved-from objects:
+  const VTable* vtable_ = nullptr;
+
+private: //* methods:
+  const void* object() const noexcept {
+    return vtable_->is_inline ? static_cast<const void*>(std::launder(buffer_)) : heap_ptr_;
+  }
+
+  void* object() noexcept {
+    return vtable_->is_inline ? static_cast<void*>(std::launder(buffer_)) : heap_ptr_;
+  }
+
+  template <typename E>
+  static void copy_impl(const ErasedErr& from, ErasedErr& to) {
+    const E& error = *static_cast<const E*>(from.object());
+    if constexpr (fits_inline<E>) {
+      ::new (static_cast<void*>(to.buffer_)) E(error);
+    }
+    else {
+      to.heap_ptr_ = new E(error);
+    }
+  }
+
+  template <typename E>
+  static void move_impl(ErasedErr& from, ErasedErr& to) noexcept {
+    if constexpr (fits_inline<E>) {
+      E* error = std::launder(reinterpret_cast<E*>(from.buffer_));
+      ::new (static_cast<void*>(to.buffer_)) E(std::move(*error));
+      error->~E();
+    }
+    else {
+      to.heap_ptr_ = from.heap_ptr_;
+    }
+  }
+
+  template <typename E>
+  static void destroy_impl(ErasedErr& self) noexcept {
+    if constexpr (fits_inline<E>) {
+      std::launder(reinterpret_cast<E*>(self.buffer_))->~E();
+    }
+    else {
+      delete static_cast<E*>(self.heap_ptr_);
+    }
+  }
+
+  template <typename E>
+  static std::size_t write_msg_impl(const void* error, std::span<char> out) {
+    const E& err = *static_cast<const E*>(error);
+    if constexpr (BufferWritableError<E>) {
+      return err.write_msg(out);
+    }
+    else {
+      return MsgWriter(out).append(std::string_view(std::string(err.err_msg()))).finish();
+    }
+  }
+
+  template <typename E>
+  static constexpr VTable vtable_for = {
+    &err_type_info<E>,
+    fits_inline<E>,
+    &copy_impl<E>,
+    &move_impl<E>,
+    &destroy_impl<E>,
+    [](const void* error) -> std::string { return std::string(static_cast<const E*>(error)->err_msg()); },
+    [](const void* error) noexcept -> const char* { return static_cast<const E*>(error)->what(); },
+    &write_msg_impl<E>,
+    [](const void* lhs, const void* rhs) -> bool { return *static_cast<const E*>(lhs) == *static_cast<const E*>(rhs); }
+  };
+
+  void reset() noexcept {
+    if (vtable_ != nullptr) {
+      vtable_->destroy(*this);
+      vtable_ = nullptr;
+    }
+  }
+
+  void steal(ErasedErr& oth) noexcept {
+    if (oth.vtable_ != nullptr) {
+      oth.vtable_->move(oth, *this);
+      vtable_ = std::exchange(oth.vtable_, nullptr);
+    }
+  }
+
+public: //* methods:
+  //*   <--- constructors, (~)ro5, destructor --->
+  // not `explicit` (like the rest of the Error wrappers): `Result<T, ErasedErr>::Err(OutOfRangeErr(...))`;
+  template <typename E>
+  requires (!std::same_as<std::remove_cvref_t<E>, ErasedErr> && Error<std::remove_cvref_t<E>>)
+  ErasedErr(E&& error) {
+    using Stored = std::remove_cvref_t<E>;
+    if constexpr (fits_inline<Stored>) {
+      ::new (static_cast<void*>(buffer_)) Stored(std::forward<E>(error));
+    }
+    else {
+      heap_ptr_ = new Stored(std::forward<E>(error));
+    }
+    vtable_ = &vtable_for<Stored>;
+  }
+
+  ErasedErr(const ErasedErr& oth) {
+    if (oth.vtable_ != nullptr) {
+      oth.vtable_->copy(oth, *this);
+      vtable_ = oth.vtable_;
+    }
+  }
+
+  ErasedErr(ErasedErr&& oth) noexcept { steal(oth); }
+
+  ErasedErr& operator=(const ErasedErr& oth) {
+    if (this != &oth) {
+      ErasedErr tmp(oth);
+      reset();
+      steal(tmp);
+    }
+    return *this;
+  }
+
+  ErasedErr& operator=(ErasedErr&& oth) noexcept {
+    if (this != &oth) {
+      reset();
+      steal(oth);
+    }
+    return *this;
+  }
+
+  ~ErasedErr() { reset(); }
+
+  //*   <--- checked access to the stored error --->
+  template <typename E>
+  bool is() const noexcept {
+    return vtable_ != nullptr && vtable_->type_info == &err_type_info<E>;
+  }
+
+  template <typename E>
+  Option<E&> downcast() noexcept {
+    if (!is<E>()) return Option<E&>();
+    return Option<E&>(*static_cast<E*>(object()));
+  }
+
+  template <typename E>
+  Option<const E&> downcast() const noexcept {
+    if (!is<E>()) return Option<const E&>();
+    return Option<const E&>(*static_cast<const E*>(object()));
+  }
+
+  // Record of the exact stored type (nullptr for moved-from objects):
+  const ErrTypeInfo* type_info() const noexcept { return vtable_ != nullptr ? vtable_->type_info : nullptr; }
+
+  bool has_error() const noexcept { return vtable_ != nullptr; }
+  bool is_inline() const noexcept { return vtable_ != nullptr && vtable_->is_inline; }
+
+  //*   <--- Error interface --->
+  std::string err_msg() const { return vtable_ != nullptr ? vtable_->err_msg(object()) : std::string(); }
+  const char* what() const noexcept { return vtable_ != nullptr ? vtable_->what(object()) : ""; }
+
+  std::size_t write_msg(std::span<char> out) const {
+    if (vtable_ != nullptr) return vtable_->write_msg(object(), out);
+    return MsgWriter(out).finish();
+  }
+
+  // Errors are equal if they store the same type and the stored errors are equal:
+  bool operator==(const ErasedErr& oth) const {
+    if (vtable_ == nullptr || oth.vtable_ == nullptr) {
+      return vtable_ == oth.vtable_;
+    }
+    return vtable_->type_info == oth.vtable_->type_info && vtable_->equal(object(), oth.object());
+  }
+};
+
+static_assert(Error<ErasedErr>, "ErasedErr must satisfy Error concept");
+
+} // namespace tmn::err;
+
+#endif // TMN_THROWLESS_ERASED_ERROR_HPP
@@ -0,0 +1,59 @@
+#ifndef TMN_THROWLESS_ERR_LIST_HPP
+#define TMN_THROWLESS_ERR_LIST_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef> // for: size_t;
+#include <utility> // for: move;
+
+#include "ErrorConcept.hpp"
+
+namespace tmn::err {
+
+//* <--- Several errors of one type as a single error --->
+
+// ErrList<E> is the error of operations that report every failure instead of the first
+// one (tmn::collect_all_errors); the errors are kept in the order they were found:
+//   Result<std::vector<Field>, ErrList<ParseErr>> fields = collect_all_errors<std::vector>(parsed);
+//   for (const ParseErr& err : fields.unwrap_err()) log(err.err_msg());
+// `err_msg()` joins the messages with "; ";
+template <typename E> requires Error<E>
+class ErrList {
+private: //* fields:
+  std::vector<E> errors_;
+
+public: //* methods:
+  ErrList() = default;
+
+  void push_back(const E& error) { errors_.push_back(error); }
+  void push_back(E&& error) { errors_.push_back(std::move(error)); }
+
+  void reserve(std::size_t count) { errors_.reserve(count); }
+
+  std::size_t size() const noexcept { return errors_.size(); }
+  bool empty() const noexcept { return errors_.empty(); }
+
+  const E& operator[](std::size_t index) const noexcept { return errors_[index]; }
+  const E& front() const noexcept { return errors_.front(); }
+
+  auto begin() const noexcept { return errors_.begin(); }
+  auto end() const noexcept { return errors_.end(); }
+
+  //*   <--- Error interface --->
+  std::string err_msg() const {
+    std::string msg;
+    for (std::size_t i = 0; i < errors_.size(); ++i) {
+      if (i != 0) msg += "; ";
+      msg += std::string(errors_[i].err_msg());
+    }
+    return msg;
+  }
+
+  const char* what() const noexcept { return errors_.empty() ? "ErrList" : errors_.front().what(); }
+
+  bool operator==(const ErrList& oth) const { return errors_ == oth.errors_; }
+};
+
+} // namespace tmn::err;
+
+#endif // TMN_THROWLESS_ERR_LIST_HPP
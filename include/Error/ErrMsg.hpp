@@ -0,0 +1,291 @@
+#ifndef TMN_THROWLESS_ERROR_MSG_HPP
+#define TMN_THROWLESS_ERROR_MSG_HPP
+
+#include <string>
+#include <string_view>
+#include <span>
+#include <cstring> // for: memcpy;
+#include <algorithm> // for: min;
+#include <cstddef> // for: size_t;
+#include <cstdint> // for: uint8_t;
+#include <utility> // for: move;
+#include <atomic> // for: atomic (rendered text of the Lazy mode);
+#include <new> // for: nothrow;
+
+#include "../SmartPtr/SharedStr.hpp"
+
+namespace tmn::err {
+
+//* <--- Message of the error without mandatory allocations --->
+
+// Message with static storage duration (string literal): stored as a pointer, never copied;
+// the constructor is `consteval`, so only compile-time constants (literals) are accepted
+// and the pointer can not dangle:
+//   StrErr(StaticMsg("Port must be in range 1-65535"))
+//   StrErr("Port must be in range 1-65535"_msg) // with `using namespace tmn::err::literals;`
+struct StaticMsg {
+  const char* str;
+  std::size_t length;
+
+  consteval StaticMsg(const char* literal) : str(literal), length(std::string_view(literal).size()) {}
+};
+
+namespace literals {
+
+consteval StaticMsg operator""_msg(const char* literal, std::size_t) {
+  return StaticMsg(literal);
+}
+
+} // namespace tmn::err::literals;
+
+// ErrMsg is the message storage of the Error hierarchy, it works in one of three modes:
+// - Literal: pointer to a static string (StaticMsg), no allocation;
+// - Owned:   runtime text, copied once into a SharedStr: copies of the error share it;
+// - Lazy:    structured fields (up to two size_t values) and a formatter;
+//            the text is rendered only when it is requested (`str()`, `c_str()`);
+//            `c_str()` keeps the rendered text in a cache that is published atomically
+//            (concurrent readers of one error are safe) and allocated with nothrow new,
+//            so `what()` stays noexcept;
+class ErrMsg {
+public: //* substructures:
+  // snprintf-like formatter: writes at most `capacity` chars (including '\0') to `out`
+  // and returns the length of the full message (without '\0'):
+  using Formatter = std::size_t (*)(char* out, std::size_t capacity, std::size_t first, std::size_t second);
+
+private: //* substructures:
+  enum class Kind : std::uint8_t {
+    Literal,
+    Owned,
+    Lazy
+  };
+
+  struct LazyFields {
+    Formatter formatter;
+    std::size_t first;
+    std::size_t second;
+  };
+
+private: //* fields:
+  union {
+    std::string_view literal_;
+    LazyFields lazy_;
+  };
+
+  // text of the Owned message:
+  SharedStr owned_;
+  // rendered text of the Lazy message ('\0'-terminated), created by the first `c_str()`:
+  mutable std::atomic<char*> rendered_{nullptr};
+  Kind kind_ = Kind::Literal;
+
+public: //* methods:
+  //*   <--- constructors --->
+  ErrMsg() noexcept : literal_(""), kind_(Kind::Literal) {}
+  ErrMsg(StaticMsg msg) noexcept : literal_(msg.str, msg.length), kind_(Kind::Literal) {}
+  ErrMsg(const std::string& msg) : literal_(), owned_(msg), kind_(Kind::Owned) {}
+  ErrMsg(SharedStr msg) noexcept : literal_(), owned_(std::move(msg)), kind_(Kind::Owned) {}
+
+  // Lifetime of an arbitrary `const char*` is unknown, so the text is copied:
+  ErrMsg(const char* msg) : literal_(), owned_(msg), kind_(Kind::Owned) {}
+
+  // The rendered text of a Lazy message is not shared: a copy renders its own on demand;
+  ErrMsg(const ErrMsg& oth) noexcept : literal_(), owned_(oth.owned_), kind_(oth.kind_) { copy_fields(oth); }
+
+  ErrMsg(ErrMsg&& oth) noexcept
+    : literal_(), owned_(std::move(oth.owned_)), rendered_(oth.rendered_.exchange(nullptr, std::memory_order_acq_rel)), kind_(oth.kind_) {
+    copy_fields(oth);
+  }
+
+  ErrMsg& operator=(const ErrMsg& oth) noexcept {
+    if (this != &oth) {
+      owned_ = oth.owned_;
+      kind_ = oth.kind_;
+      copy_fields(oth);
+      delete[] rendered_.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    return *this;
+  }
+
+  ErrMsg& operator=(ErrMsg&& oth) noexcept {
+    if (this != &oth) {
+      owned_ = std::move(oth.owned_);
+      kind_ = oth.kind_;
+      copy_fields(oth);
+      delete[] rendered_.exchange(oth.rendered_.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_acq_rel);
+    }
+    return *this;
+  }
+
+  ~ErrMsg() { delete[] rendered_.load(std::memory_order_acquire); }
+
+  // Text with static storage duration that is not a compile-time constant (entries
+  // of constexpr message tables selected at runtime): the caller guarantees the lifetime;
+  static ErrMsg from_static_storage(std::string_view text) noexcept {
+    ErrMsg msg;
+    msg.literal_ = text;
+    return msg;
+  }
+
+  static ErrMsg lazy(Formatter formatter, std::size_t first, std::size_t second = 0) noexcept {
+    ErrMsg msg;
+    msg.lazy_ = LazyFields{formatter, first, second};
+    msg.kind_ = Kind::Lazy;
+    return msg;
+  }
+
+  //*   <--- observers --->
+  bool is_static() const noexcept { return kind_ == Kind::Literal; }
+  bool is_lazy() const noexcept { return kind_ == Kind::Lazy; }
+
+  // Structured fields of the Lazy message (0 in the other modes):
+  std::size_t lazy_first() const noexcept { return kind_ == Kind::Lazy ? lazy_.first : 0; }
+  std::size_t lazy_second() const noexcept { return kind_ == Kind::Lazy ? lazy_.second : 0; }
+
+  // Renders the message (Lazy mode) into a new string:
+  std::string str() const {
+    switch (kind_) {
+      case Kind::Literal: return std::string(literal_);
+      case Kind::Owned: return owned_.str();
+      case Kind::Lazy: return render();
+    }
+    return std::string();
+  }
+
+  // For the Lazy mode the first call renders the message into the cache; if the
+  // allocation fails, a fixed text is returned (and the next call tries again):
+  const char* c_str() const noexcept {
+    switch (kind_) {
+      case Kind::Literal: return literal_.data();
+      case Kind::Owned: return owned_.c_str();
+      case Kind::Lazy: return rendered_c_str();
+    }
+    return "";
+  }
+
+  std::string_view view() const noexcept {
+    if (kind_ == Kind::Literal) return literal_;
+    if (kind_ == Kind::Lazy) return std::string_view(c_str());
+    return owned_.view();
+  }
+
+  // Writes the message into the caller's buffer without allocations (the Lazy mode
+  // is formatted directly into it) with snprintf semantics: the text is truncated
+  // to the buffer and '\0'-terminated (if the buffer is not empty);
+  // returns the full length of the message (without '\0');
+  std::size_t write_msg(std::span<char> out) const noexcept {
+    if (kind_ == Kind::Lazy) {
+      return lazy_.formatter(out.data(), out.size(), lazy_.first, lazy_.second);
+    }
+
+    const std::string_view text = (kind_ == Kind::Literal) ? literal_ : owned_.view();
+    if (!out.empty()) {
+      const std::size_t count = std::min(text.size(), out.size() - 1);
+      std::memcpy(out.data(), text.data(), count);
+      out[count] = '\0';
+    }
+    return text.size();
+  }
+
+  bool empty() const noexcept {
+    switch (kind_) {
+      case Kind::Literal: return literal_.empty();
+      case Kind::Owned: return owned_.empty();
+      case Kind::Lazy: return false;
+    }
+    return true;
+  }
+
+  bool operator==(const ErrMsg& oth) const noexcept {
+    if (kind_ == Kind::Lazy && oth.kind_ == Kind::Lazy) {
+      return lazy_.formatter == oth.lazy_.formatter && lazy_.first == oth.lazy_.first && lazy_.second == oth.lazy_.second;
+    }
+    return view() == oth.view();
+  }
+
+  // Concatenation helpers for composing messages (`err_msg()` implementations); the view is
+  // appended by its size: it is not '\0'-terminated for `from_static_storage` and has no data
+  // at all for an empty Owned message:
+  friend std::string operator+(const std::string& lhs, const ErrMsg& rhs) {
+    std::string out(lhs);
+    out.append(rhs.view());
+    return out;
+  }
+
+  friend std::string operator+(const ErrMsg& lhs, const std::string& rhs) { return lhs.str() + rhs; }
+  friend std::string operator+(const ErrMsg& lhs, const char* rhs) { return lhs.str() + rhs; }
+
+private: //* methods:
+  void copy_fields(const ErrMsg& oth) noexcept {
+    if (oth.kind_ == Kind::Lazy) lazy_ = oth.lazy_;
+    else literal_ = oth.literal_;
+  }
+
+  std::string render() const {
+    // most messages fit into the stack buffer, then the formatter runs only once:
+    char buffer[128];
+    const std::size_t length = lazy_.formatter(buffer, sizeof(buffer), lazy_.first, lazy_.second);
+    if (length < sizeof(buffer)) {
+      return std::string(buffer, length);
+    }
+
+    std::string result(length, '\0');
+    // std::string keeps room for the terminating '\0' after `length` chars:
+    lazy_.formatter(result.data(), length + 1, lazy_.first, lazy_.second);
+    return result;
+  }
+
+  // The first rendered text is published, a thread that loses the race frees its copy:
+  const char* rendered_c_str() const noexcept {
+    if (const char* cached = rendered_.load(std::memory_order_acquire)) return cached;
+
+    char buffer[128];
+    const std::size_t length = lazy_.formatter(buffer, sizeof(buffer), lazy_.first, lazy_.second);
+    char* text = new (std::nothrow) char[length + 1];
+    if (text == nullptr) [[unlikely]] return "(message unavailable: out of memory)";
+    if (length < sizeof(buffer)) std::memcpy(text, buffer, length + 1);
+    else lazy_.formatter(text, length + 1, lazy_.first, lazy_.second);
+
+    char* expected = nullptr;
+    if (rendered_.compare_exchange_strong(expected, text, std::memory_order_acq_rel, std::memory_order_acquire)) return text;
+    delete[] text;
+    return expected;
+  }
+};
+
+// Composes a message from several parts in the caller's buffer (for `write_msg()`
+// implementations of errors with composite messages) with the same snprintf semantics;
+class MsgWriter {
+private: //* fields:
+  std::span<char> out_;
+  std::size_t length_ = 0;
+
+public: //* methods:
+  explicit MsgWriter(std::span<char> out) noexcept : out_(out) {}
+
+  MsgWriter& append(std::string_view text) noexcept {
+    if (length_ < out_.size()) {
+      const std::size_t count = std::min(text.size(), out_.size() - length_);
+      std::memcpy(out_.data() + length_, text.data(), count);
+    }
+    length_ += text.size();
+    return *this;
+  }
+
+  MsgWriter& append(const char* text) noexcept { return append(std::string_view(text)); }
+
+  MsgWriter& append(const ErrMsg& msg) noexcept {
+    length_ += msg.write_msg(length_ < out_.size() ? out_.subspan(length_) : std::span<char>());
+    return *this;
+  }
+
+  // Terminates the text and returns the full length of the composed message:
+  std::size_t finish() noexcept {
+    if (!out_.empty()) {
+      out_[std::min(length_, out_.size() - 1)] = '\0';
+    }
+    return length_;
+  }
+};
+
+} // namespace tmn::err;
+
+#endif // TMN_THROWLESS_ERROR_MSG_HPP
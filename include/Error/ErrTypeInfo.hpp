@@ -0,0 +1,119 @@
+#ifndef TMN_THROWLESS_ERROR_TYPE_INFO_HPP
+#define TMN_THROWLESS_ERROR_TYPE_INFO_HPP
+
+#include <array>
+#include <string_view>
+#include <cstddef> // for: size_t;
+#include <type_traits> // for: is_void_v;
+
+namespace tmn::err {
+
+//* <--- Type identity of errors without RTTI --->
+
+namespace detail {
+
+// Name of the type from the signature of the function (the same on every run and works
+// with -fno-rtti); the result is a view into the function name, not '\0'-terminated:
+template <typename T>
+constexpr std::string_view raw_type_name() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+  // GCC:   "... raw_type_name() [with T = tmn::err::StrErr; std::string_view = ...]"
+  // Clang: "... raw_type_name() [T = tmn::err::StrErr]"
+  constexpr std::string_view signature = __PRETTY_FUNCTION__;
+  constexpr std::string_view prefix = "T = ";
+  const std::size_t begin = signature.find(prefix) + prefix.size();
+  std::size_t end = signature.find(';', begin);
+  if (end == std::string_view::npos) end = signature.rfind(']');
+  return signature.substr(begin, end - begin);
+#elif defined(_MSC_VER)
+  // MSVC:  "... raw_type_name<struct tmn::err::StrErr>(void) noexcept"
+  std::string_view name = __FUNCSIG__;
+  name.remove_prefix(name.find("raw_type_name<") + std::string_view("raw_type_name<").size());
+  name.remove_suffix(name.size() - name.rfind(">("));
+  for (std::string_view keyword : {"struct ", "class ", "enum "}) {
+    if (name.starts_with(keyword)) name.remove_prefix(keyword.size());
+  }
+  return name;
+#else
+  return "unknown type";
+#endif
+}
+
+// '\0'-terminated copy of the name with static storage duration (safe for `c_str()`):
+template <typename T>
+struct TypeNameStorage {
+  static constexpr std::string_view raw = raw_type_name<T>();
+
+  static constexpr std::array<char, raw.size() + 1> chars = [] {
+    std::array<char, raw.size() + 1> result{};
+    for (std::size_t i = 0; i < raw.size(); ++i) result[i] = raw[i];
+    return result;
+  }();
+};
+
+} // namespace tmn::err::detail;
+
+template <typename T>
+constexpr std::string_view type_name() noexcept {
+  return std::string_view(detail::TypeNameStorage<T>::chars.data(), detail::TypeNameStorage<T>::raw.size());
+}
+
+// One record per error type (constant-initialized, no static constructors):
+// - identity is the address of the record: comparison is a single pointer compare;
+// - `parent` links the record of the base error (`using parent_error = Base;`
+//   in the error type), so "is-a" checks walk a chain as deep as the hierarchy:
+//   an exact match is one compare, a base `depth` levels up costs `depth` loads;
+// there are no dense type numbers: a header-only library can not number the error types
+// of the whole program at compile time, and dispatch over the records is a chain walk;
+struct ErrTypeInfo {
+  std::string_view name;
+  const ErrTypeInfo* parent;
+
+  bool is_a(const ErrTypeInfo& base) const noexcept {
+    if (this == &base) return true; // exact match: the common case of matching;
+    for (const ErrTypeInfo* info = parent; info != nullptr; info = info->parent) {
+      if (info == &base) return true;
+    }
+    return false;
+  }
+
+  bool operator==(const ErrTypeInfo& oth) const noexcept { return this == &oth; }
+};
+
+namespace detail {
+
+template <typename E>
+struct ErrParent { using type = void; };
+
+template <typename E> requires requires { typename E::parent_error; }
+struct ErrParent<E> { using type = typename E::parent_error; };
+
+template <typename E>
+constexpr const ErrTypeInfo* parent_type_info() noexcept;
+
+} // namespace tmn::err::detail;
+
+template <typename E>
+inline constexpr ErrTypeInfo err_type_info = {
+  type_name<E>(),
+  detail::parent_type_info<E>()
+};
+
+namespace detail {
+
+template <typename E>
+constexpr const ErrTypeInfo* parent_type_info() noexcept {
+  using Parent = typename ErrParent<E>::type;
+  if constexpr (std::is_void_v<Parent>) {
+    return nullptr;
+  }
+  else {
+    return &err_type_info<Parent>;
+  }
+}
+
+} // namespace tmn::err::detail;
+
+} // namespace tmn::err;
+
+#endif // TMN_THROWLESS_ERROR_TYPE_INFO_HPP
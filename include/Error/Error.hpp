@@ -3,8 +3,10 @@
 
 #include <string>
 #include <concepts> // for: convertible_to;
-#include <typeinfo> // for: typeid;
 #include <limits> // for: std::numeric_limits;
+#include <cstdio> // for: snprintf;
+#include <span>
+#include <typeinfo> // for: typeid (the dynamic type of the exception with RTTI);
 
 //                    AnyErr
 //                      |
@@ -20,35 +22,68 @@
 // (etc)
 
 #include "ErrorConcept.hpp"
+#include "ErrMsg.hpp"
+#include "ErrTypeInfo.hpp"
 
 namespace tmn::err {
 
 //* <--- Basic wrappers for classic error handling methods --->
 
+// The message is stored in ErrMsg (see "ErrMsg.hpp"): string literals passed as StaticMsg
+// and lazily formatted messages (OutOfRangeErr) are created without allocations,
+// runtime messages are shared between copies of the error (refcounted SharedStr);
 struct AnyErr {
 protected:
-  std::string msg_;
+  ErrMsg msg_;
 
 public:
   AnyErr() = default;
   AnyErr(const std::string& msg) : msg_(msg) {}
   AnyErr(const char* msg) : msg_(msg) {}
+  AnyErr(ErrMsg msg) noexcept : msg_(std::move(msg)) {}
 
   template <typename...Args> requires std::constructible_from<std::string, Args...>
-  AnyErr(Args&&... args) : msg_(args...) {}
+  AnyErr(Args&&... args) : msg_(std::string(args...)) {}
 
   virtual ~AnyErr() = default;
 
-  virtual std::string err_msg() const { return msg_; }
+  virtual std::string err_msg() const { return msg_.str(); }
+  virtual std::size_t write_msg(std::span<char> out) const noexcept { return msg_.write_msg(out); }
   virtual const char* what() const noexcept { return msg_.c_str(); }
 
   virtual bool operator==(const AnyErr& oth) const noexcept {
     return msg_ == oth.msg_;
   }
+
+  //*   <--- type checks without RTTI (see "ErrTypeInfo.hpp") --->
+  // Errors of the library override `type_info()`; a custom error that does not
+  // is identified as its nearest base that does (`is<Custom>()` is false, never wrong);
+  virtual const ErrTypeInfo& type_info() const noexcept { return err_type_info<AnyErr>; }
+
+  // True if the dynamic type of the error is E or derived from E: a walk up the parent
+  // chain of the dynamic type (ErrTypeInfo::is_a), one compare for the exact type:
+  template <typename E> requires std::derived_from<E, AnyErr>
+  bool is() const noexcept {
+    if constexpr (std::same_as<E, AnyErr>) {
+      return true;
+    }
+    else {
+      return type_info().is_a(err_type_info<E>);
+    }
+  }
+
+  // Checked downcast (replacement of dynamic_cast): nullptr if the error is not E;
+  template <typename E> requires std::derived_from<E, AnyErr>
+  const E* as() const noexcept { return is<E>() ? static_cast<const E*>(this) : nullptr; }
+
+  template <typename E> requires std::derived_from<E, AnyErr>
+  E* as() noexcept { return is<E>() ? static_cast<E*>(this) : nullptr; }
 };
 
 struct StrErr : public AnyErr {
 public:
+  using parent_error = AnyErr;
+
   // constructors are not declared `explicit` to simplify
   // the construction of objects in complex structures (as Result<T, E>);
   // Compare the options:
@@ -56,13 +91,16 @@ public:
   // 2. return Result<Config, StrErr>::Err("Port must be in range 1-65535");
   // Second option is more laconic and does not contain unnecessary syntactic repetitions Err-Err;
   // Similar reasoning is applied to other wrappers of Error<E>;
-  StrErr() : AnyErr("Undefined Str Error") {}
+  StrErr() : AnyErr(StaticMsg("Undefined Str Error")) {}
   StrErr(const std::string& msg) : AnyErr(msg) {}
   StrErr(const char* msg) : AnyErr(msg) {}
+  StrErr(ErrMsg msg) noexcept : AnyErr(std::move(msg)) {}
 
   template <typename...Args> requires std::constructible_from<std::string, Args...>
   StrErr(Args&&... args) : AnyErr(args...) {}
 
+  const ErrTypeInfo& type_info() const noexcept override { return err_type_info<StrErr>; }
+
   bool operator==(const StrErr& oth) const noexcept {
     return msg_ == oth.msg_;
   }
@@ -72,18 +110,39 @@ public:
 static_assert(Error<StrErr>, "StrErr must satisfy Error concept");
 
 struct GeneralExceptionErr : public AnyErr {
+public:
+  using parent_error = AnyErr;
+
 private:
-  std::string _exception_name = "Unknown type";
+  ErrMsg _exception_name = StaticMsg("Unknown type");
+
+  // The name of the dynamic type (typeid, implementation-defined: mangled by GCC / Clang)
+  // with RTTI; the static type E without RTTI (-fno-rtti, a setting of the whole program);
+  // both have static storage duration, so the name is not copied:
+  template <typename E>
+  static ErrMsg exception_type_name(const E& ex) noexcept {
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+    return ErrMsg::from_static_storage(typeid(ex).name());
+#else
+    (void)ex;
+    return ErrMsg::from_static_storage(type_name<E>());
+#endif
+  }
 
 public:
   template<typename E> requires std::derived_from<E, std::exception>
-  explicit GeneralExceptionErr(const E& ex) : AnyErr(ex.what()), _exception_name(typeid(ex).name()) {}
-  GeneralExceptionErr() : AnyErr("Unknown General Exception Error") {}
+  explicit GeneralExceptionErr(const E& ex) : AnyErr(ex.what()), _exception_name(exception_type_name(ex)) {}
+  GeneralExceptionErr() : AnyErr(StaticMsg("Unknown General Exception Error")) {}
 
-  std::string exception_name() const noexcept { return _exception_name; }
-  std::string err_msg() const noexcept { return "[" + _exception_name + "]: "+ msg_; }
+  std::string exception_name() const { return _exception_name.str(); }
+  std::string err_msg() const noexcept { return "[" + _exception_name.str() + "]: "+ msg_.str(); }
+  std::size_t write_msg(std::span<char> out) const noexcept override {
+    return MsgWriter(out).append("[").append(_exception_name).append("]: ").append(msg_).finish();
+  }
   const char* what() const noexcept { return msg_.c_str(); }
 
+  const ErrTypeInfo& type_info() const noexcept override { return err_type_info<GeneralExceptionErr>; }
+
   bool operator==(const GeneralExceptionErr& oth) const noexcept {
     return msg_ == oth.msg_ && _exception_name == oth._exception_name;
   }
@@ -92,29 +151,38 @@ public:
 // Check that StrErr satisfies the concept of Error<E>:
 static_assert(Error<GeneralExceptionErr>, "ExceptionErr must satisfy Error concept");
 
+// Only index and size are stored on construction: the message is formatted lazily
+// in `err_msg()` / `what()`, so the construction of the error does not allocate;
+// the formatter is kept in the message, so it survives the conversion to AnyErr;
 struct OutOfRangeErr : public AnyErr {
+public:
+  using parent_error = AnyErr;
+
 private:
-  std::size_t index_ = std::numeric_limits<std::size_t>::max();
-  std::size_t size_ = 0;
+  // index and size are stored once, as the fields of the lazy message:
+  static std::size_t format_half_open(char* out, std::size_t capacity, std::size_t index, std::size_t size) {
+    return static_cast<std::size_t>(std::snprintf(out, capacity, "Index %zu out of range in [0, %zu)", index, size));
+  }
 
-public:
-  OutOfRangeErr(std::size_t index, std::size_t size, bool is_zero_indexing = true)
-    : index_(index), size_(size)
-  {
-    msg_ = "Index " + std::to_string(index) + " out of range in [0, " + std::to_string(size);
-    if (is_zero_indexing) { msg_.push_back(')'); }
-    else { msg_.push_back(']'); }
+  static std::size_t format_closed(char* out, std::size_t capacity, std::size_t index, std::size_t size) {
+    return static_cast<std::size_t>(std::snprintf(out, capacity, "Index %zu out of range in [0, %zu]", index, size));
   }
 
-  std::size_t index() const noexcept { return index_; }
-  std::size_t size() const noexcept { return size_; }
+public:
+  OutOfRangeErr(std::size_t index, std::size_t size, bool is_zero_indexing = true) noexcept
+    : AnyErr(ErrMsg::lazy(is_zero_indexing ? &format_half_open : &format_closed, index, size)) {}
+
+  std::size_t index() const noexcept { return msg_.lazy_first(); }
+  std::size_t size() const noexcept { return msg_.lazy_second(); }
 
-  std::string err_msg() const { return msg_; }
+  std::string err_msg() const { return msg_.str(); }
 
   const char* what() const noexcept { return msg_.c_str(); }
 
+  const ErrTypeInfo& type_info() const noexcept override { return err_type_info<OutOfRangeErr>; }
+
   bool operator==(const OutOfRangeErr& oth) const noexcept {
-    return index_ == oth.index_ && size_ == oth.size_;
+    return index() == oth.index() && size() == oth.size();
   }
 };
 
@@ -123,13 +191,19 @@ static_assert(Error<OutOfRangeErr>, "OutOfRangeErr must satisfy Error concept");
 
 class EmptyArrErr : public AnyErr {
 public:
+  using parent_error = AnyErr;
+
   EmptyArrErr() {}
   EmptyArrErr(std::string msg) : AnyErr(msg) {}
+  EmptyArrErr(const char* msg) : AnyErr(msg) {}
+  EmptyArrErr(ErrMsg msg) noexcept : AnyErr(std::move(msg)) {}
 
-  std::string err_msg() const { return msg_; }
+  std::string err_msg() const { return msg_.str(); }
 
   const char* what() const noexcept { return msg_.c_str(); }
 
+  const ErrTypeInfo& type_info() const noexcept override { return err_type_info<EmptyArrErr>; }
+
   bool operator==(const EmptyArrErr& oth) const noexcept {
     return msg_ == oth.msg_;
   }
@@ -138,35 +212,44 @@ public:
 static_assert(Error<EmptyArrErr>, "EmptyArrErr must satisfy Error concept");
 
 struct NullPtrErr : public AnyErr {
+public:
+  using parent_error = AnyErr;
+
 private:
-  std::string expected_ptr_type_ = "unknown ptr type";
+  ErrMsg expected_ptr_type_ = StaticMsg("unknown ptr type");
 
 public:
-  NullPtrErr() : AnyErr("Null pointer Error") {}
+  NullPtrErr() : AnyErr(StaticMsg("Null pointer Error")) {}
 
   NullPtrErr(const std::string& expected_ptr_type = "")
-    : AnyErr("Null pointer Error"),
-      expected_ptr_type_(expected_ptr_type.empty() ? "unknown pointer type" : expected_ptr_type) {}
+    : AnyErr(StaticMsg("Null pointer Error")),
+      expected_ptr_type_(expected_ptr_type.empty() ? ErrMsg(StaticMsg("unknown pointer type")) : ErrMsg(expected_ptr_type)) {}
 
   NullPtrErr(const char* expected_ptr_type = nullptr)
-    : AnyErr(std::string("Null pointer Error: ")),
-      expected_ptr_type_(expected_ptr_type ? expected_ptr_type : "unknown pointer type") {}
+    : AnyErr(StaticMsg("Null pointer Error: ")),
+      expected_ptr_type_(expected_ptr_type ? ErrMsg(expected_ptr_type) : ErrMsg(StaticMsg("unknown pointer type"))) {}
 
   template<typename T>
   explicit NullPtrErr(const T* _ = nullptr)
-    : AnyErr("Null pointer Error"),
-      expected_ptr_type_(typeid(T).name()) {}
+    : AnyErr(StaticMsg("Null pointer Error")),
+      expected_ptr_type_(ErrMsg::from_static_storage(type_name<T>())) {}
 
-  const std::string& pointer_type() const noexcept { return expected_ptr_type_; }
+  std::string pointer_type() const { return expected_ptr_type_.str(); }
 
   std::string err_msg() const override {
-    return msg_ + ". Expected '" + expected_ptr_type_ + "' pointer type";
+    return msg_.str() + ". Expected '" + expected_ptr_type_.str() + "' pointer type";
+  }
+
+  std::size_t write_msg(std::span<char> out) const noexcept override {
+    return MsgWriter(out).append(msg_).append(". Expected '").append(expected_ptr_type_).append("' pointer type").finish();
   }
 
   const char* what() const noexcept override {
     return msg_.c_str();
   }
 
+  const ErrTypeInfo& type_info() const noexcept override { return err_type_info<NullPtrErr>; }
+
   bool operator==(const NullPtrErr& oth) const noexcept {
     return expected_ptr_type_ == oth.expected_ptr_type_ && msg_ == oth.msg_;
   }
@@ -176,13 +259,18 @@ static_assert(Error<NullPtrErr>, "NullPtrErr must satisfy Error concept");
 
 struct BadAllocErr : public AnyErr {
 public:
-  BadAllocErr() : AnyErr("Bad Allocation Error") {}
+  using parent_error = AnyErr;
+
+  BadAllocErr() : AnyErr(StaticMsg("Bad Allocation Error")) {}
   BadAllocErr(const std::string& msg) : AnyErr(msg) {}
   BadAllocErr(const char* msg) : AnyErr(msg) {}
+  BadAllocErr(ErrMsg msg) noexcept : AnyErr(std::move(msg)) {}
 
   template <typename...Args> requires std::constructible_from<std::string, Args...>
   BadAllocErr(Args&&... args) : AnyErr(args...) {}
 
+  const ErrTypeInfo& type_info() const noexcept override { return err_type_info<BadAllocErr>; }
+
   bool operator==(const BadAllocErr& oth) const noexcept {
     return msg_ == oth.msg_;
   }
@@ -191,13 +279,18 @@ public:
 static_assert(Error<NullPtrErr>, "BadAllocErr must satisfy Error concept");
 
 struct InvalidArgErr : public AnyErr {
+public:
+  using parent_error = AnyErr;
+
 private:
   // description of the limitations of the expected argument value:
-  std::string expected_limits = "Unspecified limits";
+  ErrMsg expected_limits = StaticMsg("Unspecified limits");
 
 public:
-  InvalidArgErr() : AnyErr("Invalid Argument Error") {}
+  InvalidArgErr() : AnyErr(StaticMsg("Invalid Argument Error")) {}
   InvalidArgErr(const std::string& msg) : AnyErr(msg) {}
+  InvalidArgErr(ErrMsg msg, ErrMsg expected_limits = StaticMsg("Unspecified limits")) noexcept
+    : AnyErr(std::move(msg)), expected_limits(std::move(expected_limits)) {}
   InvalidArgErr(const std::string& msg, const std::string& expected_limits)
     : AnyErr(msg), expected_limits(expected_limits) {}
   InvalidArgErr(const std::string& msg, const char* expected_limits)
@@ -211,6 +304,8 @@ public:
   template <typename...Args> requires std::constructible_from<std::string, Args...>
   InvalidArgErr(Args&&... args) : AnyErr(args...) {}
 
+  const ErrTypeInfo& type_info() const noexcept override { return err_type_info<InvalidArgErr>; }
+
   bool operator==(const InvalidArgErr& oth) const noexcept {
     return msg_ == oth.msg_ && expected_limits == oth.expected_limits;
   }
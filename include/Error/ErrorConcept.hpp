@@ -3,6 +3,8 @@
 
 #include <string>
 #include <concepts> // for: convertible_to<T>;
+#include <span>
+#include <cstddef> // for: size_t;
 
 namespace tmn::err {
 
@@ -21,6 +23,16 @@ concept Error = requires(const E& e, E&& moved) {
   requires std::equality_comparable<E>;
 };
 
+//* <--- Optional extension: rendering of the message into the caller's buffer --->
+// `.write_msg(std::span<char>)` writes the message (the same text as `.err_msg()`)
+// with snprintf semantics (truncated, '\0'-terminated) and returns its full length;
+// errors without this method are still rendered through `.err_msg()`
+// (see "Format/Format.hpp": err::write_msg, err::format_to);
+template<typename E>
+concept BufferWritableError = Error<E> && requires(const E& e, std::span<char> out) {
+  { e.write_msg(out) } -> std::convertible_to<std::size_t>;
+};
+
 } // namespace tmn::err;
 
 #endif // TMN_THROWLESS_ERROR_CONCEPT_HPP
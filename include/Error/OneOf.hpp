@@ -0,0 +1,127 @@
+#ifndef TMN_THROWLESS_ONE_OF_ERROR_HPP
+#define TMN_THROWLESS_ONE_OF_ERROR_HPP
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <variant> // for: variant, visit, in_place_type;
+#include <cstddef> // for: size_t;
+#include <utility> // for: move, forward;
+#include <concepts> // for: same_as;
+#include <type_traits> // for: remove_cvref_t;
+
+#include "ErrorConcept.hpp"
+#include "ErrMsg.hpp"
+#include "../../src/Error/ErrorSet.hpp"
+#include "../Option/Option.hpp"
+
+namespace tmn::err {
+
+//* <--- Closed set of errors: tagged union without virtual dispatch --->
+
+// OneOf<Es...> holds exactly one error of the listed types (by value, no slicing);
+// `err_msg()` / `what()` / `write_msg()` dispatch through std::visit (a jump table
+// over the alternatives) and call the members of the concrete type with qualified
+// names, so even AnyErr-derived errors are not dispatched through their vtables:
+//   Result<Config, OneOf<ParseErr, IoErr>> load(...);
+//   auto r = read_file(path)             // Result<std::string, IoErr>
+//              .and_then(parse_config);  // -> Result<Config, OneOf<IoErr, ParseErr>>
+// OneOf converts to a wider OneOf (superset of the alternatives) implicitly;
+template <typename... Es>
+class OneOf {
+  static_assert(sizeof...(Es) > 0, "OneOf must list at least one error type");
+  static_assert((Error<Es> && ...), "All alternatives of OneOf must satisfy Error concept");
+  static_assert(detail::AllUnique<detail::TypeList<Es...>>::value, "Alternatives of OneOf must be unique");
+
+private: //* fields:
+  std::variant<Es...> error_;
+
+private: //* friends:
+  template <typename... Fs>
+  friend class OneOf;
+
+  template <typename Alt>
+  static std::size_t write_alternative(const Alt& error, std::span<char> out) {
+    if constexpr (BufferWritableError<Alt>) {
+      return error.Alt::write_msg(out);
+    }
+    else {
+      return MsgWriter(out).append(std::string_view(std::string(error.Alt::err_msg()))).finish();
+    }
+  }
+
+public: //* methods:
+  //*   <--- constructors --->
+  // not `explicit` (like the rest of the Error wrappers): `Result<T, OneOf<A, B>>::Err(A{...})`;
+  template <typename E> requires detail::contains_v<std::remove_cvref_t<E>, Es...>
+  OneOf(E&& error) : error_(std::in_place_type<std::remove_cvref_t<E>>, std::forward<E>(error)) {}
+
+  // widening: OneOf<A> / OneOf<A, B> -> OneOf<A, B, C>:
+  template <typename... Fs>
+  requires (!std::same_as<OneOf<Fs...>, OneOf> && (detail::contains_v<Fs, Es...> && ...))
+  OneOf(const OneOf<Fs...>& narrower)
+    : error_(std::visit([](const auto& error) -> std::variant<Es...> {
+        return std::variant<Es...>(std::in_place_type<std::remove_cvref_t<decltype(error)>>, error);
+      }, narrower.error_)) {}
+
+  template <typename... Fs>
+  requires (!std::same_as<OneOf<Fs...>, OneOf> && (detail::contains_v<Fs, Es...> && ...))
+  OneOf(OneOf<Fs...>&& narrower)
+    : error_(std::visit([](auto&& error) -> std::variant<Es...> {
+        return std::variant<Es...>(std::in_place_type<std::remove_cvref_t<decltype(error)>>, std::move(error));
+      }, std::move(narrower.error_))) {}
+
+  //*   <--- access to the alternatives --->
+  // position of the held error in Es...:
+  std::size_t index() const noexcept { return error_.index(); }
+
+  template <typename E> requires detail::contains_v<E, Es...>
+  bool is() const noexcept { return std::holds_alternative<E>(error_); }
+
+  template <typename E> requires detail::contains_v<E, Es...>
+  Option<E&> downcast() noexcept {
+    if (E* error = std::get_if<E>(&error_)) return Option<E&>(*error);
+    return Option<E&>();
+  }
+
+  template <typename E> requires detail::contains_v<E, Es...>
+  Option<const E&> downcast() const noexcept {
+    if (const E* error = std::get_if<E>(&error_)) return Option<const E&>(*error);
+    return Option<const E&>();
+  }
+
+  // Visitor must accept every alternative (compile-time dispatch through std::visit):
+  template <typename Visitor>
+  decltype(auto) visit(Visitor&& visitor) const& { return std::visit(std::forward<Visitor>(visitor), error_); }
+
+  template <typename Visitor>
+  decltype(auto) visit(Visitor&& visitor) & { return std::visit(std::forward<Visitor>(visitor), error_); }
+
+  template <typename Visitor>
+  decltype(auto) visit(Visitor&& visitor) && { return std::visit(std::forward<Visitor>(visitor), std::move(error_)); }
+
+  //*   <--- Error interface --->
+  std::string err_msg() const {
+    return std::visit([](const auto& error) -> std::string {
+      using Alt = std::remove_cvref_t<decltype(error)>;
+      return std::string(error.Alt::err_msg());
+    }, error_);
+  }
+
+  const char* what() const noexcept {
+    return std::visit([](const auto& error) noexcept -> const char* {
+      using Alt = std::remove_cvref_t<decltype(error)>;
+      return error.Alt::what();
+    }, error_);
+  }
+
+  std::size_t write_msg(std::span<char> out) const {
+    return std::visit([out](const auto& error) -> std::size_t { return write_alternative(error, out); }, error_);
+  }
+
+  bool operator==(const OneOf& oth) const { return error_ == oth.error_; }
+};
+
+} // namespace tmn::err;
+
+#endif // TMN_THROWLESS_ONE_OF_ERROR_HPP
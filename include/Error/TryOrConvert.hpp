@@ -5,26 +5,59 @@
 
 #include <type_traits> // for: invoke_result_t;
 #include <functional> // for: invoke;
+#include <new> // for: bad_alloc;
+#include <stdexcept> // for: logic_error, runtime_error, out_of_range, invalid_argument;
 
 #include "Error.hpp" // for: ExceptionErr;
+#include "../Panic/Panic.hpp" // for: TMN_THROWLESS_HAS_EXCEPTIONS;
 #include "ErrorConcept.hpp" // for: Error<E>;
 
 namespace tmn {
 
 // forward-declaration:
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template<typename T, typename E> requires err::Error<E>
 class Result;
 
-// analog of 'try', which converts the received exception to Error:
+// analog of 'try', which converts the received exception to Error
+// (without exceptions support in the compiler nothing can be thrown: the result is always Ok):
 template<typename Fn, typename... Args>
 auto try_or_convert(Fn&& fn, Args&&... args) -> Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr> {
-  try {
+#ifndef TMN_THROWLESS_HAS_EXCEPTIONS
+  if constexpr (std::is_void_v<std::invoke_result_t<Fn, Args...>>) {
+    std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...);
+    return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Ok();
+  }
+  else {
     return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Ok(std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...));
+  }
+#else
+  try {
+    if constexpr (std::is_void_v<std::invoke_result_t<Fn, Args...>>) {
+      std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...);
+      return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Ok();
+    }
+    else {
+      return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Ok(std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...));
+    }
+  }
+  // the name of the exception is taken from its static type (no RTTI), so the most
+  // common standard exceptions are caught by their own types:
+  catch (const std::bad_alloc& e) {
+    return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Err(err::GeneralExceptionErr{e});
+  } catch (const std::out_of_range& e) {
+    return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Err(err::GeneralExceptionErr{e});
+  } catch (const std::invalid_argument& e) {
+    return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Err(err::GeneralExceptionErr{e});
+  } catch (const std::logic_error& e) {
+    return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Err(err::GeneralExceptionErr{e});
+  } catch (const std::runtime_error& e) {
+    return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Err(err::GeneralExceptionErr{e});
   } catch (const std::exception& e) {
     return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Err(err::GeneralExceptionErr{e});
   } catch (...) {
     return Result<std::invoke_result_t<Fn, Args...>, err::GeneralExceptionErr>::Err(err::GeneralExceptionErr{});
   }
+#endif
 }
 
 } // namespace tmn;
@@ -0,0 +1,250 @@
+#ifndef TMN_THROWLESS_FORMAT_HPP
+#define TMN_THROWLESS_FORMAT_HPP
+
+//* <--- Rendering of errors, Option and Result into caller-provided outputs --->
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <iterator> // for: output_iterator;
+#include <ranges> // for: input_range;
+#include <algorithm> // for: copy_n;
+#include <charconv> // for: to_chars;
+#include <concepts> // for: same_as, convertible_to;
+#include <type_traits> // for: is_arithmetic_v, remove_cvref_t;
+#include <version> // for: __cpp_lib_format;
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include "../Error/ErrorConcept.hpp"
+#include "../Error/ErrMsg.hpp"
+#include "../Error/ErrList.hpp"
+#include "../Option/Option.hpp"
+#include "../Result/Result.hpp"
+
+// The functions below write into any output iterator (a fixed buffer, a log sink) or
+// append to a reused std::string (a whole piece at a time), the messages are not
+// materialized into temporary strings (except for errors that provide only `.err_msg()`
+// or messages longer than 256 chars):
+//   std::string line;
+//   tmn::err::format_to(line, err);                      // "[type]: message"
+//   tmn::format_to(line, result);                        // "Ok(42)" / "Err(message)"
+//   tmn::format_to(std::back_inserter(chars), option);   // "Some(42)" / "None"
+// If the standard library provides <format> (GCC 13+, Clang with libc++ 17+, MSVC),
+// std::formatter is specialized for errors, Option and Result with the same output,
+// written through the same functions straight into the output of the context:
+//   std::format("{}", result);                           // "Ok(42)" / "Err(message)"
+
+namespace tmn::detail {
+
+// Output of the string overloads: appends whole pieces instead of char-by-char push_back;
+struct StringSink {
+  std::string* str;
+};
+
+template <typename Out>
+concept CharOutput = std::same_as<Out, StringSink> || std::output_iterator<Out, const char&>;
+
+inline StringSink write_chars(StringSink out, const char* data, std::size_t count) {
+  out.str->append(data, count);
+  return out;
+}
+
+template <std::output_iterator<const char&> OutputIt>
+OutputIt write_chars(OutputIt out, const char* data, std::size_t count) {
+  return std::copy_n(data, count, out);
+}
+
+template <err::Error E, CharOutput Out>
+Out format_error_to(Out out, const E& error) {
+  if constexpr (err::BufferWritableError<E>) {
+    char buffer[256];
+    const std::size_t length = error.write_msg(buffer);
+    if (length < sizeof(buffer)) {
+      return write_chars(out, buffer, length);
+    }
+
+    std::string long_msg(length, '\0');
+    error.write_msg(std::span<char>(long_msg.data(), length + 1));
+    return write_chars(out, long_msg.data(), long_msg.size());
+  }
+  else {
+    const std::string msg = error.err_msg();
+    return write_chars(out, msg.data(), msg.size());
+  }
+}
+
+} // namespace tmn::detail;
+
+namespace tmn::err {
+
+// Message of the error into the caller's buffer (snprintf semantics, see BufferWritableError):
+template <Error E>
+std::size_t write_msg(const E& error, std::span<char> out) {
+  if constexpr (BufferWritableError<E>) {
+    return error.write_msg(out);
+  }
+  else {
+    return MsgWriter(out).append(std::string_view(error.err_msg())).finish();
+  }
+}
+
+template <Error E, std::output_iterator<const char&> OutputIt>
+OutputIt format_to(OutputIt out, const E& error) {
+  return tmn::detail::format_error_to(out, error);
+}
+
+// Appends the message to `out`:
+template <Error E>
+std::string& format_to(std::string& out, const E& error) {
+  tmn::detail::format_error_to(tmn::detail::StringSink{&out}, error);
+  return out;
+}
+
+} // namespace tmn::err;
+
+namespace tmn {
+
+namespace detail {
+
+// Values inside Option / Result that can be rendered without <format>:
+template <typename T>
+concept FormattableValue =
+  std::is_arithmetic_v<T> || std::convertible_to<const T&, std::string_view> || err::Error<T>;
+
+template <CharOutput Out>
+Out format_text_to(Out out, std::string_view text) {
+  return write_chars(out, text.data(), text.size());
+}
+
+template <FormattableValue T, CharOutput Out>
+Out format_value_to(Out out, const T& value) {
+  if constexpr (std::same_as<T, bool>) {
+    return format_text_to(out, value ? "true" : "false");
+  }
+  else if constexpr (std::same_as<T, char>) {
+    return write_chars(out, &value, 1);
+  }
+  else if constexpr (std::is_arithmetic_v<T>) {
+    char buffer[64];
+    const auto [end, _] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return write_chars(out, buffer, static_cast<std::size_t>(end - buffer));
+  }
+  else if constexpr (std::convertible_to<const T&, std::string_view>) {
+    return format_text_to(out, std::string_view(value));
+  }
+  else {
+    return format_error_to(out, value);
+  }
+}
+
+template <typename T, CharOutput Out>
+Out format_option_to(Out out, const Option<T>& option) {
+  if (!option.has_value()) {
+    return format_text_to(out, "None");
+  }
+  out = format_text_to(out, "Some(");
+  out = format_value_to(out, option.value());
+  return format_text_to(out, ")");
+}
+
+template <typename T, typename E, CharOutput Out>
+Out format_result_to(Out out, const Result<T, E>& result) {
+  if (result.is_err()) {
+    out = format_text_to(out, "Err(");
+    out = format_error_to(out, result.unwrap_err());
+    return format_text_to(out, ")");
+  }
+
+  out = format_text_to(out, "Ok(");
+  if constexpr (!std::is_void_v<T>) {
+    out = format_value_to(out, result.unwrap_value());
+  }
+  return format_text_to(out, ")");
+}
+
+} // namespace tmn::detail;
+
+// "Some(<value>)" or "None":
+template <typename T, std::output_iterator<const char&> OutputIt>
+requires detail::FormattableValue<std::remove_cvref_t<T>>
+OutputIt format_to(OutputIt out, const Option<T>& option) {
+  return detail::format_option_to(out, option);
+}
+
+template <typename T> requires detail::FormattableValue<std::remove_cvref_t<T>>
+std::string& format_to(std::string& out, const Option<T>& option) {
+  detail::format_option_to(detail::StringSink{&out}, option);
+  return out;
+}
+
+// "Ok(<value>)" ("Ok()" for Result<void, E>) or "Err(<error message>)":
+template <typename T, typename E, std::output_iterator<const char&> OutputIt>
+requires (std::is_void_v<T> || detail::FormattableValue<std::remove_cvref_t<T>>)
+OutputIt format_to(OutputIt out, const Result<T, E>& result) {
+  return detail::format_result_to(out, result);
+}
+
+template <typename T, typename E> requires (std::is_void_v<T> || detail::FormattableValue<std::remove_cvref_t<T>>)
+std::string& format_to(std::string& out, const Result<T, E>& result) {
+  detail::format_result_to(detail::StringSink{&out}, result);
+  return out;
+}
+
+} // namespace tmn;
+
+#if defined(__cpp_lib_format)
+
+namespace std {
+
+// Only the empty format spec ("{}") is accepted: `parse` consumes nothing, so std::format
+// reports any other spec as a format_error;
+// errors that are also ranges (ErrList) are left to the specialization for their template,
+// the generic one would be ambiguous with the range formatter of C++23:
+template <tmn::err::Error E> requires (!std::ranges::input_range<E>)
+struct formatter<E, char> {
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  template <typename FormatContext>
+  auto format(const E& error, FormatContext& ctx) const {
+    return tmn::err::format_to(ctx.out(), error);
+  }
+};
+
+template <typename E>
+struct formatter<tmn::err::ErrList<E>, char> {
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  template <typename FormatContext>
+  auto format(const tmn::err::ErrList<E>& errors, FormatContext& ctx) const {
+    return tmn::err::format_to(ctx.out(), errors);
+  }
+};
+
+template <typename T> requires tmn::detail::FormattableValue<std::remove_cvref_t<T>>
+struct formatter<tmn::Option<T>, char> {
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  template <typename FormatContext>
+  auto format(const tmn::Option<T>& option, FormatContext& ctx) const {
+    return tmn::format_to(ctx.out(), option);
+  }
+};
+
+template <typename T, typename E>
+requires (std::is_void_v<T> || tmn::detail::FormattableValue<std::remove_cvref_t<T>>)
+struct formatter<tmn::Result<T, E>, char> {
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  template <typename FormatContext>
+  auto format(const tmn::Result<T, E>& result, FormatContext& ctx) const {
+    return tmn::format_to(ctx.out(), result);
+  }
+};
+
+} // namespace std;
+
+#endif // __cpp_lib_format
+
+#endif // TMN_THROWLESS_FORMAT_HPP
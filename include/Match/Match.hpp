@@ -0,0 +1,110 @@
+#ifndef TMN_THROWLESS_MATCH_HPP
+#define TMN_THROWLESS_MATCH_HPP
+
+//* <--- Pattern matching over Option, Result and errors --->
+
+#include <tuple> // for: tuple;
+#include <utility> // for: forward;
+#include <functional> // for: invoke;
+#include <type_traits> // for: decay_t, remove_cvref_t, invoke_result_t;
+
+#include "../../src/Match/MatchTraits.hpp"
+
+namespace tmn {
+
+// match(opt, some_fn, none_fn), match(res, ok_fn, err_fn):
+// - exactly one branch on the state flag (the same code as a hand-written `if`, no indirect
+//   calls: checked by the MatchCodegenTests test on the assembly of test/Match/MatchCodegenProbe.cpp);
+// - the payload is passed by reference (moved from rvalues), never copied;
+// - the result is the common type of the arms (the exact type if they agree,
+//   so arms returning references give a reference);
+//   int port = match(parse_port(s), [](int p) { return p; }, [](const StrErr&) { return 80; });
+template <typename Opt, typename SomeFn, typename NoneFn>
+requires detail::OptionTraits<std::remove_cvref_t<Opt>>::is_option
+decltype(auto) match(Opt&& opt, SomeFn&& some_fn, NoneFn&& none_fn) {
+  using R = detail::match_result_t<
+    std::invoke_result_t<SomeFn, decltype(detail::some_payload(std::forward<Opt>(opt)))>,
+    std::invoke_result_t<NoneFn>
+  >;
+
+  if (opt.has_value()) {
+    return static_cast<R>(std::invoke(std::forward<SomeFn>(some_fn), detail::some_payload(std::forward<Opt>(opt))));
+  }
+  return static_cast<R>(std::invoke(std::forward<NoneFn>(none_fn)));
+}
+
+// ok_fn of Result<void, E> takes no arguments:
+template <typename Res, typename OkFn, typename ErrFn>
+requires detail::ResultTraits<std::remove_cvref_t<Res>>::is_result
+decltype(auto) match(Res&& res, OkFn&& ok_fn, ErrFn&& err_fn) {
+  using Value = typename detail::ResultTraits<std::remove_cvref_t<Res>>::value_type;
+  using ErrPayload = decltype(detail::err_payload(std::forward<Res>(res)));
+
+  if constexpr (std::is_void_v<Value>) {
+    using R = detail::match_result_t<std::invoke_result_t<OkFn>, std::invoke_result_t<ErrFn, ErrPayload>>;
+    if (res.is_ok()) {
+      return static_cast<R>(std::invoke(std::forward<OkFn>(ok_fn)));
+    }
+    return static_cast<R>(std::invoke(std::forward<ErrFn>(err_fn), detail::err_payload(std::forward<Res>(res))));
+  }
+  else {
+    using OkPayload = decltype(detail::ok_payload(std::forward<Res>(res)));
+    using R = detail::match_result_t<std::invoke_result_t<OkFn, OkPayload>, std::invoke_result_t<ErrFn, ErrPayload>>;
+    if (res.is_ok()) {
+      return static_cast<R>(std::invoke(std::forward<OkFn>(ok_fn), detail::ok_payload(std::forward<Res>(res))));
+    }
+    return static_cast<R>(std::invoke(std::forward<ErrFn>(err_fn), detail::err_payload(std::forward<Res>(res))));
+  }
+}
+
+//*   <--- matching of errors by type --->
+
+// Arm for the errors of type E (and derived from E); fn takes `E` with the qualifiers
+// of the matched error or nothing:
+template <typename E, typename Fn>
+Handler<E, std::decay_t<Fn>> handler(Fn&& fn) {
+  return Handler<E, std::decay_t<Fn>>{std::forward<Fn>(fn)};
+}
+
+// Arm for the rest of the errors: fn takes the matched error (the alternative for OneOf) or nothing:
+template <typename Fn>
+Otherwise<std::decay_t<Fn>> otherwise(Fn&& fn) {
+  return Otherwise<std::decay_t<Fn>>{std::forward<Fn>(fn)};
+}
+
+// match(err, handler<OutOfRangeErr>(...), handler<NullPtrErr>(...), otherwise(...)):
+// arms are tried in order, the first one that accepts the error is invoked;
+// - OneOf<Es...>: the arm of every alternative is selected at compile time,
+//   the match is one std::visit (jump table over the index), missing arms are compile errors;
+// - errors outside of the AnyErr hierarchy (CodeErr, user types): the arm is selected at
+//   compile time (no branches at all, checked by test/Match/MatchCodegenProbe.cpp);
+// - AnyErr and the errors derived from it (a reference may refer to a derived error) and
+//   ErasedErr: the dynamic type is read once (ErrTypeInfo, a virtual call) and compared with
+//   the record of each handler (pointer compares, no RTTI), `otherwise` is required
+//   unless some handler accepts the static type;
+template <typename Err, typename... Arms>
+requires (err::Error<std::remove_cvref_t<Err>> && sizeof...(Arms) > 0 && (detail::is_match_arm_v<std::remove_cvref_t<Arms>> && ...))
+decltype(auto) match(Err&& error, Arms&&... arms) {
+  using S = std::remove_cvref_t<Err>;
+  std::tuple<std::remove_reference_t<Arms>&...> arm_refs(arms...);
+
+  if constexpr (detail::is_one_of_v<S>) {
+    using R = typename detail::OneOfMatchResult<Err, S, std::remove_reference_t<Arms>...>::type;
+    return std::forward<Err>(error).visit([&arm_refs](auto&& alt) -> R {
+      return detail::dispatch_static<R>(std::forward<decltype(alt)>(alt), arm_refs);
+    });
+  }
+  else if constexpr (detail::is_polymorphic_err_v<S>) {
+    using R = detail::match_result_t<detail::error_arm_result_t<std::remove_reference_t<Arms>, Err>...>;
+    const err::ErrTypeInfo* info = detail::dynamic_type_info(error);
+    return detail::dispatch_dynamic<R, 0>(std::forward<Err>(error), info, arm_refs);
+  }
+  else {
+    using R = detail::error_arm_result_t<detail::static_arm_t<S, std::remove_reference_t<Arms>...>, Err>;
+    return detail::dispatch_static<R>(std::forward<Err>(error), arm_refs);
+  }
+}
+
+} // namespace tmn;
+
+#endif // TMN_THROWLESS_MATCH_HPP
@@ -10,9 +10,16 @@
 namespace tmn {
 
 // forward-declaration:
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template<typename T, typename E> requires err::Error<E>
 class Result;
 
+namespace detail {
+
+// raw access to the storage for the batch kernels (src/Option/OptionStorage.hpp):
+struct OptionStorage;
+
+} // namespace tmn::detail;
+
 template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
 class Option {
 private: //* fields :
@@ -54,6 +61,15 @@ public: //* methods :
   T& value();
   const T& value() const;
 
+  // Unchecked access for an Option already known to hold a value (e.g. after `has_value()`):
+  // asserted in debug builds, a plain load in release builds (see TMN_THROWLESS_ASSUME);
+  T& value_unchecked() noexcept;
+  const T& value_unchecked() const noexcept;
+  T& operator*() noexcept;
+  const T& operator*() const noexcept;
+  T* operator->() noexcept;
+  const T* operator->() const noexcept;
+
   bool operator==(const Option<T>& oth) const noexcept;
 
   // `.destroy_value()` method returns `true` if the object has been initialized and destroyed:
@@ -107,6 +123,8 @@ private: //* methods:
   void swap(Option& oth) noexcept(std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>);
 
 private: //* friends:
+  friend struct detail::OptionStorage;
+
   friend void swap(Option<T>& first, Option<T>& second) noexcept(noexcept(first.swap(second))) {
     first.swap(second);
   }
@@ -123,6 +141,7 @@ Option<T> Some(T val) noexcept(std::is_nothrow_move_constructible_v<T>);
 } // namespace tmn;
 
 #include "../../src/Option/Option.tpp" // for: Option definition;
+#include "../../src/Option/RefOption.hpp" // for: Option<T&> specialization;
 #include "../../src/Option/CoproductOperations.hpp" // for: external monoid functions for Option objects;
 #include "../Result/Result.hpp" // for: implementation of the Result class, which was previously declared forward;
 
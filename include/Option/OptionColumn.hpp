@@ -0,0 +1,295 @@
+#ifndef TMN_THROWLESS_OPTION_COLUMN_HPP
+#define TMN_THROWLESS_OPTION_COLUMN_HPP
+
+#include <bit> // for: popcount;
+#include <span>
+#include <vector>
+#include <algorithm> // for: min, max;
+#include <ranges> // for: input_range, sized_range, view, range_reference_t;
+#include <cstddef> // for: size_t;
+#include <cstdint> // for: uint64_t;
+#include <concepts> // for: default_initializable, copyable, convertible_to, same_as;
+#include <utility> // for: move, forward;
+#include <type_traits> // for: is_nothrow_copy_constructible_v, is_lvalue_reference_v, is_reference_v, remove_cvref_t;
+
+#include "Option.hpp"
+#include "../Panic/Panic.hpp" // for: panic, TMN_THROWLESS_ASSUME;
+
+namespace tmn {
+
+//* <--- Columnar storage of optional values --->
+
+// OptionColumn<T> stores a sequence of Option<T> as two arrays (Arrow-style layout):
+// the values are contiguous (a None slot holds T{}), and the presence of every
+// element is one bit of the validity bitmap (bit i of word i / 64);
+// Option<double> takes 16 bytes, the same element of the column takes 8 bytes + 1 bit,
+// and presence checks scan the bitmap (64 elements per word) instead of the values;
+// elements are handed out as Option<T> (copy) or Option<T&> (view into the column);
+// bool is not supported (std::vector<bool> is a bitset: no contiguous values, no T& views);
+//   OptionColumn<double> samples;
+//   samples.append(batch);            // any range of Option<double>
+//   samples.count_some();             // popcount over the bitmap
+//   samples.get_ref(i).fmap(...);
+template <typename T> requires (std::default_initializable<T> && std::copyable<T> && !std::same_as<T, bool>)
+class OptionColumn {
+public: //* types:
+  using value_type = T;
+  using word_type = std::uint64_t;
+
+  static constexpr std::size_t word_bits = 64;
+
+private: //* substructures:
+  // Bits of the last, incomplete word of `append`:
+  struct PendingWord {
+    OptionColumn& column;
+    word_type word;
+
+    ~PendingWord() {
+      if (column.size() % word_bits != 0) column.store_last_word(word);
+    }
+  };
+
+private: //* fields:
+  std::vector<T> values_;
+  std::vector<word_type> validity_;
+
+private: //* methods:
+  static constexpr std::size_t word_count(std::size_t size) noexcept { return (size + word_bits - 1) / word_bits; }
+  static constexpr word_type bit(std::size_t index) noexcept { return word_type{1} << (index % word_bits); }
+
+  void set_valid(std::size_t index, bool valid) noexcept {
+    if (valid) validity_[index / word_bits] |= bit(index);
+    else validity_[index / word_bits] &= ~bit(index);
+  }
+
+  // Restores "a None slot holds T{}" a word at a time (full words are skipped):
+  void clear_none_values() {
+    for (std::size_t w = 0; w < validity_.size(); ++w) {
+      const word_type word = validity_[w];
+      if (word == ~word_type{0}) continue;
+      const std::size_t last = std::min(values_.size(), (w + 1) * word_bits);
+      for (std::size_t i = w * word_bits; i < last; ++i) {
+        if ((word & bit(i)) == 0) values_[i] = T{};
+      }
+    }
+  }
+
+  // Value of the element of `append`: the value of an Option<T> rvalue is moved, other
+  // elements are converted to Option<T> first; returns whether the element is Some:
+  template <typename Element>
+  bool append_value(Element&& element) {
+    if constexpr (std::same_as<std::remove_cvref_t<Element>, Option<T>>) {
+      if (!element.has_value()) {
+        values_.emplace_back();
+        return false;
+      }
+      if constexpr (std::is_lvalue_reference_v<Element>) values_.push_back(element.value_unchecked());
+      else values_.push_back(std::move(element.value_unchecked()));
+      return true;
+    }
+    else {
+      return append_value(Option<T>(std::forward<Element>(element)));
+    }
+  }
+
+  // Room for the bit of the next element, made before its value is added: a copy of T
+  // that throws leaves the arrays as they were, and once the value is in, the bitmap
+  // grows without allocation (the capacity still grows geometrically):
+  void reserve_bit() {
+    if (values_.size() % word_bits == 0 && validity_.size() == validity_.capacity()) {
+      validity_.reserve(std::max<std::size_t>(2 * validity_.capacity(), 1));
+    }
+  }
+
+  // New element at the end (after `reserve_bit()`): one word per 64 elements, new bits are 0:
+  void grow_validity() noexcept {
+    if (values_.size() % word_bits == 1) validity_.push_back(0);
+  }
+
+  // The word of the last element (after `reserve_bit()` for the first element of the word):
+  void store_last_word(word_type word) noexcept {
+    if (validity_.size() == word_count(values_.size())) validity_.back() = word;
+    else validity_.push_back(word);
+  }
+
+public: //* methods:
+  //*   <--- constructors --->
+  OptionColumn() = default;
+
+  template <std::ranges::input_range R> requires std::convertible_to<std::ranges::range_reference_t<R>, Option<T>>
+  explicit OptionColumn(R&& options) { append(std::forward<R>(options)); }
+
+  // Column from the raw parts (output of the batch kernels): `validity` holds one word
+  // per 64 values, bits past the last value are cleared and the values of None slots
+  // are reset to T{} (the kernels compute every slot, whatever its validity);
+  // a bitmap of another size is a bug of the caller: panic;
+  static OptionColumn from_parts(std::vector<T> values, std::vector<word_type> validity) {
+    if (validity.size() != word_count(values.size())) [[unlikely]] {
+      panic("OptionColumn: size of the validity bitmap does not match the values");
+    }
+    OptionColumn column;
+    column.values_ = std::move(values);
+    column.validity_ = std::move(validity);
+    if (column.values_.size() % word_bits != 0) {
+      column.validity_.back() &= bit(column.values_.size()) - 1;
+    }
+    column.clear_none_values();
+    return column;
+  }
+
+  //*   <--- size & capacity --->
+  std::size_t size() const noexcept { return values_.size(); }
+  bool empty() const noexcept { return values_.empty(); }
+
+  void reserve(std::size_t capacity) {
+    values_.reserve(capacity);
+    validity_.reserve(word_count(capacity));
+  }
+
+  void clear() noexcept {
+    values_.clear();
+    validity_.clear();
+  }
+
+  //*   <--- appending --->
+  void push_back(const T& value) {
+    reserve_bit();
+    values_.push_back(value);
+    grow_validity();
+    set_valid(values_.size() - 1, true);
+  }
+
+  void push_back(T&& value) {
+    reserve_bit();
+    values_.push_back(std::move(value));
+    grow_validity();
+    set_valid(values_.size() - 1, true);
+  }
+
+  void push_none() {
+    reserve_bit();
+    values_.emplace_back();
+    grow_validity();
+  }
+
+  void push_back(const Option<T>& opt) {
+    if (opt.has_value()) push_back(opt.value_unchecked());
+    else push_none();
+  }
+
+  void push_back(Option<T>&& opt) {
+    if (opt.has_value()) push_back(std::move(opt.value_unchecked()));
+    else push_none();
+  }
+
+  // Bulk append: the storage is sized once for sized ranges and the bitmap
+  // is assembled a word at a time instead of read-modify-write per element;
+  // the elements of an owning rvalue range (and prvalue elements) are moved from,
+  // views and lvalue ranges are copied from:
+  template <std::ranges::input_range R> requires std::convertible_to<std::ranges::range_reference_t<R>, Option<T>>
+  void append(R&& options) {
+    constexpr bool moves_elements = !std::is_reference_v<std::ranges::range_reference_t<R>> ||
+      (!std::is_lvalue_reference_v<R> && !std::ranges::view<std::remove_cvref_t<R>>);
+
+    if constexpr (std::ranges::sized_range<R>) {
+      reserve(size() + static_cast<std::size_t>(std::ranges::size(options)));
+    }
+
+    // the word of the elements added so far is stored on every exit, a throwing copy of T
+    // included, so the bitmap always matches the values:
+    PendingWord pending{*this, (size() % word_bits != 0) ? validity_.back() : 0};
+    std::size_t index = size();
+    for (auto&& element : options) {
+      reserve_bit();
+      bool is_some = false;
+      if constexpr (moves_elements) is_some = append_value(std::move(element));
+      else is_some = append_value(element);
+      if (is_some) pending.word |= bit(index);
+
+      ++index;
+      if (index % word_bits == 0) {
+        store_last_word(pending.word);
+        pending.word = 0;
+      }
+    }
+  }
+
+  //*   <--- element access --->
+  bool is_some(std::size_t index) const noexcept {
+    TMN_THROWLESS_ASSUME(index < size(), "OptionColumn: index out of range");
+    return (validity_[index / word_bits] & bit(index)) != 0;
+  }
+
+  bool is_none(std::size_t index) const noexcept { return !is_some(index); }
+
+  // Copy of the element (None for an index out of range):
+  Option<T> get(std::size_t index) const noexcept(std::is_nothrow_copy_constructible_v<T>) {
+    if (index >= size() || !is_some(index)) return Option<T>();
+    return Option<T>(values_[index]);
+  }
+
+  // View of the element: valid until the column is modified (reallocation);
+  Option<T&> get_ref(std::size_t index) noexcept {
+    if (index >= size() || !is_some(index)) return Option<T&>();
+    return Option<T&>(values_[index]);
+  }
+
+  Option<const T&> get_ref(std::size_t index) const noexcept {
+    if (index >= size() || !is_some(index)) return Option<const T&>();
+    return Option<const T&>(values_[index]);
+  }
+
+  void set(std::size_t index, const T& value) {
+    TMN_THROWLESS_ASSUME(index < size(), "OptionColumn: index out of range");
+    values_[index] = value;
+    set_valid(index, true);
+  }
+
+  void set(std::size_t index, const Option<T>& opt) {
+    if (opt.has_value()) set(index, opt.value_unchecked());
+    else set_none(index);
+  }
+
+  void set_none(std::size_t index) {
+    TMN_THROWLESS_ASSUME(index < size(), "OptionColumn: index out of range");
+    values_[index] = T{};
+    set_valid(index, false);
+  }
+
+  //*   <--- bulk queries --->
+  // Bits past size() in the last word are always 0, so whole words are counted:
+  std::size_t count_some() const noexcept {
+    std::size_t count = 0;
+    for (const word_type word : validity_) count += static_cast<std::size_t>(std::popcount(word));
+    return count;
+  }
+
+  std::size_t count_none() const noexcept { return size() - count_some(); }
+
+  // Raw columns for kernels: values of None slots are T{};
+  std::span<const T> values() const noexcept { return values_; }
+  std::span<T> values() noexcept { return values_; }
+  std::span<const word_type> validity() const noexcept { return validity_; }
+
+  // Back to the row layout:
+  std::vector<Option<T>> to_options() const {
+    std::vector<Option<T>> result;
+    result.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+      result.push_back(is_some(i) ? Option<T>(values_[i]) : Option<T>());
+    }
+    return result;
+  }
+
+  bool operator==(const OptionColumn& oth) const {
+    if (size() != oth.size() || validity_ != oth.validity_) return false;
+    for (std::size_t i = 0; i < size(); ++i) {
+      if (is_some(i) && !(values_[i] == oth.values_[i])) return false;
+    }
+    return true;
+  }
+};
+
+} // namespace tmn;
+
+#endif // TMN_THROWLESS_OPTION_COLUMN_HPP
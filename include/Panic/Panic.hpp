@@ -0,0 +1,159 @@
+#ifndef TMN_THROWLESS_PANIC_HPP
+#define TMN_THROWLESS_PANIC_HPP
+
+//* <--- Failure paths of the library: exceptions or panic --->
+
+#include <atomic>
+#include <cstdio> // for: fputs;
+#include <cstdlib> // for: abort;
+#include <new> // for: bad_alloc;
+#include <optional> // for: bad_optional_access;
+#include <stdexcept> // for: runtime_error;
+
+// Build mode without exceptions: follows the compiler, selected when exceptions are
+// disabled (-fno-exceptions, /EHs-c-); in this mode every failure of the library
+// (`Option::value()` on None, `unwrap_value()` on Err, invalid arguments of the makers, ...)
+// calls the panic handler instead of `throw`;
+// the inline failure helpers below differ between the modes, so the mode is a property of
+// the whole program: every translation unit that includes the library must be compiled with
+// the same exception setting (the THROWLESS_NO_EXCEPTIONS CMake option sets it for the whole
+// build); the macro cannot be defined by hand while exceptions are enabled;
+// TMN_THROWLESS_HAS_EXCEPTIONS tells whether the compiler supports try / catch at all
+// (`try_or_convert` and coroutines catch exceptions of the user code with it);
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define TMN_THROWLESS_HAS_EXCEPTIONS
+#endif
+
+#if defined(TMN_THROWLESS_NO_EXCEPTIONS) && defined(TMN_THROWLESS_HAS_EXCEPTIONS)
+#error "TMN_THROWLESS_NO_EXCEPTIONS follows the compiler: build the whole program with exceptions disabled instead"
+#endif
+
+#if !defined(TMN_THROWLESS_HAS_EXCEPTIONS)
+#define TMN_THROWLESS_NO_EXCEPTIONS
+#endif
+
+// Failure helpers are kept out of the callers: the hot function contains only the
+// check and a call, the construction of the exception / message and the unwinding
+// tables for it live in a separate cold section;
+#if defined(__GNUC__) || defined(__clang__)
+#define TMN_THROWLESS_COLD gnu::cold, gnu::noinline
+#else
+#define TMN_THROWLESS_COLD
+#endif
+
+namespace tmn {
+
+// Handler ends the program (abort, trap, exit, quick_exit, ...): if it returns, the program is aborted;
+// it must not leave the failed function through longjmp, the frames being skipped hold objects
+// with non-trivial destructors (the error being reported, for one);
+using PanicHandler = void (*)(const char* message);
+
+// Default handler: prints the message to stderr and aborts;
+[[noreturn]] inline void panic_abort(const char* message) noexcept {
+  std::fputs("throwless panic: ", stderr);
+  std::fputs(message, stderr);
+  std::fputs("\n", stderr);
+  std::abort();
+}
+
+// Minimal handler: a single trap instruction, no output;
+[[noreturn]] inline void panic_trap(const char*) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_trap();
+#else
+  std::abort();
+#endif
+}
+
+namespace detail {
+
+inline std::atomic<PanicHandler> panic_handler{&panic_abort};
+
+} // namespace tmn::detail;
+
+// Returns the previous handler; nullptr restores the default one:
+inline PanicHandler set_panic_handler(PanicHandler handler) noexcept {
+  return detail::panic_handler.exchange(handler != nullptr ? handler : &panic_abort, std::memory_order_acq_rel);
+}
+
+inline PanicHandler get_panic_handler() noexcept {
+  return detail::panic_handler.load(std::memory_order_acquire);
+}
+
+[[noreturn, TMN_THROWLESS_COLD]] inline void panic(const char* message) {
+  get_panic_handler()(message);
+  std::abort();
+}
+
+namespace detail {
+
+//*   <--- failure helpers: throw in the default mode, panic without exceptions --->
+
+[[noreturn, TMN_THROWLESS_COLD]] inline void fail_bad_optional_access() {
+#ifdef TMN_THROWLESS_NO_EXCEPTIONS
+  panic("Option: access to the value of None");
+#else
+  throw std::bad_optional_access();
+#endif
+}
+
+[[noreturn, TMN_THROWLESS_COLD]] inline void fail_bad_alloc() {
+#ifdef TMN_THROWLESS_NO_EXCEPTIONS
+  panic("Allocation failed");
+#else
+  throw std::bad_alloc();
+#endif
+}
+
+[[noreturn, TMN_THROWLESS_COLD]] inline void fail_runtime(const char* message) {
+#ifdef TMN_THROWLESS_NO_EXCEPTIONS
+  panic(message);
+#else
+  throw std::runtime_error(message);
+#endif
+}
+
+// `unwrap_value()` on Err: the message of the error is reported;
+template <typename E>
+[[noreturn, TMN_THROWLESS_COLD]] void fail_unwrap_value(const E& error) {
+#ifdef TMN_THROWLESS_NO_EXCEPTIONS
+  panic(error.what());
+#else
+  throw std::runtime_error(error.err_msg());
+#endif
+}
+
+// Throws the error Err(args...) itself; arguments are cheap to pass (pointers,
+// sizes, StaticMsg), so the construction of the error happens in the cold helper:
+template <typename Err, typename... Args>
+[[noreturn, TMN_THROWLESS_COLD]] void fail_with(Args... args) {
+#ifdef TMN_THROWLESS_NO_EXCEPTIONS
+  const Err error(args...);
+  panic(error.what());
+#else
+  throw Err(args...);
+#endif
+}
+
+} // namespace tmn::detail;
+
+} // namespace tmn;
+
+// Precondition of the unchecked accessors (`value_unchecked()`, `unwrap_unchecked()`, ...):
+// checked with a panic in debug builds; in release builds (NDEBUG) the condition is
+// only an assumption for the optimizer, so the accessor is a plain load and the
+// check already made by the caller is not repeated; violating it is undefined behavior;
+// TMN_THROWLESS_CHECKED_UNCHECKED keeps the checks in release builds too;
+#if !defined(NDEBUG) || defined(TMN_THROWLESS_CHECKED_UNCHECKED)
+#define TMN_THROWLESS_ASSUME(cond, message) \
+  do { if (!(cond)) [[unlikely]] ::tmn::panic(message); } while (false)
+#elif defined(__GNUC__) || defined(__clang__)
+#define TMN_THROWLESS_ASSUME(cond, message) \
+  do { if (!(cond)) __builtin_unreachable(); } while (false)
+#elif defined(_MSC_VER)
+#define TMN_THROWLESS_ASSUME(cond, message) __assume(cond)
+#else
+#define TMN_THROWLESS_ASSUME(cond, message) ((void)0)
+#endif
+
+#endif // TMN_THROWLESS_PANIC_HPP
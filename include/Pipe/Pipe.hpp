@@ -0,0 +1,144 @@
+#ifndef TMN_THROWLESS_PIPE_HPP
+#define TMN_THROWLESS_PIPE_HPP
+
+//* <--- Fused fmap / and_then chains over Option and Result --->
+
+#include <tuple> // for: tuple, tuple_cat, get;
+#include <cstddef> // for: size_t;
+#include <utility> // for: move, forward, declval, as_const;
+#include <functional> // for: invoke;
+#include <type_traits> // for: decay_t, remove_cvref_t, conditional_t, is_lvalue_reference_v, invoke_result_t;
+
+#include "../Option/Option.hpp"
+#include "../Result/Result.hpp"
+#include "../../src/Pipe/PipeTraits.hpp"
+
+namespace tmn::pipe {
+
+// opt | fmap(f) | fmap(g) | and_then(h) | eval()
+// builds the chain without running it, `eval()` runs it as one function: the state of
+// the source is checked once, the values flow from stage to stage as plain temporaries
+// and the resulting Option / Result is constructed once, at the end; the eager chain
+// `opt.fmap(f).fmap(g)` constructs, checks and destroys an Option at every step;
+// - fmap(fn): the value is replaced by fn(value);
+// - and_then(fn): fn returning Option<U> (in a chain over Option) or Result<U, F> (over
+//   Result<T, E>) is flattened: its None / Err ends the chain, that is the only extra check;
+//   different errors widen the error of the result to OneOf (err::widen_t), the same type
+//   as the eager `Result::and_then` chain; fn returning a plain value works as fmap;
+//   over Option the type differs from the eager chain: the eager `Option::and_then` does
+//   not flatten (`opt.and_then(h)` is Option<Option<U>>), `opt | and_then(h) | eval()`
+//   is Option<U>; only chains over Result have the type of the eager chain;
+// - the source is read in place (lvalues are not copied, rvalues are moved from);
+//   the pipeline refers to lvalue sources, so it is evaluated in the expression that builds it
+//   (or moved: `std::move(pipeline) | eval()`);
+//   Option<std::string> name = user_opt | fmap(&User::profile) | fmap(&Profile::display_name)
+//                                       | and_then(non_empty) | eval();
+
+template <typename Source, typename... Stages>
+class Pipe {
+private: //* types:
+  using Wrapper = std::remove_cvref_t<Source>;
+  // lvalue sources are read as they were given, owned sources are moved from:
+  using SourceRef = std::conditional_t<std::is_lvalue_reference_v<Source>, Source, Source&&>;
+
+  static constexpr bool is_option = detail::OptionTraits<Wrapper>::is_option;
+
+  template <typename W>
+  static decltype(auto) payload(W&& source) {
+    if constexpr (is_option) return detail::some_payload(std::forward<W>(source));
+    else return detail::ok_payload(std::forward<W>(source));
+  }
+
+  using FirstArg = decltype(payload(std::declval<SourceRef>()));
+  using Value = detail::pipe_value_t<FirstArg, Stages...>;
+
+  template <typename W>
+  struct OutputOf { using type = Option<Value>; };
+
+  template <typename T, typename E>
+  struct OutputOf<Result<T, E>> { using type = Result<Value, detail::pipe_error_t<E, FirstArg, Stages...>>; };
+
+public: //* types:
+  using output_type = typename OutputOf<Wrapper>::type;
+
+private: //* fields:
+  Source source_;
+  std::tuple<Stages...> stages_;
+
+private: //* methods:
+  // Stage I applied to `value`, the result passed on to the stage I + 1:
+  template <std::size_t I, typename Arg>
+  output_type run(Arg&& value) {
+    if constexpr (I == sizeof...(Stages)) {
+      if constexpr (is_option) return output_type(std::forward<Arg>(value));
+      else return output_type::Ok(std::forward<Arg>(value));
+    }
+    else {
+      auto& stage = std::get<I>(stages_);
+      using Stage = std::remove_cvref_t<decltype(stage)>;
+      using R = std::remove_cvref_t<std::invoke_result_t<decltype((std::as_const(stage.fn))), Arg>>;
+
+      if constexpr (detail::is_and_then_stage_v<Stage> && detail::BindTraits<R>::is_option) {
+        static_assert(is_option, "pipe::and_then over Result must return Result or a plain value");
+        auto next = std::invoke(std::as_const(stage.fn), std::forward<Arg>(value));
+        if (!next.has_value()) return output_type();
+        return run<I + 1>(std::move(next.value_unchecked()));
+      }
+      else if constexpr (detail::is_and_then_stage_v<Stage> && detail::BindTraits<R>::is_result) {
+        static_assert(!is_option, "pipe::and_then over Option must return Option or a plain value");
+        auto next = std::invoke(std::as_const(stage.fn), std::forward<Arg>(value));
+        if (!next.is_ok()) return output_type::Err(std::move(next.unwrap_err_unchecked()));
+        return run<I + 1>(std::move(next.unwrap_unchecked()));
+      }
+      else {
+        return run<I + 1>(std::invoke(std::as_const(stage.fn), std::forward<Arg>(value)));
+      }
+    }
+  }
+
+public: //* methods:
+  Pipe(SourceRef source, std::tuple<Stages...> stages) : source_(std::forward<SourceRef>(source)), stages_(std::move(stages)) {}
+
+  output_type eval() && {
+    SourceRef source = static_cast<SourceRef>(source_);
+    if constexpr (is_option) {
+      if (!source.has_value()) return output_type();
+    }
+    else {
+      if (!source.is_ok()) return output_type::Err(detail::err_payload(std::forward<SourceRef>(source)));
+    }
+    return run<0>(payload(std::forward<SourceRef>(source)));
+  }
+
+  template <typename Stage> requires detail::is_pipe_stage_v<Stage>
+  friend Pipe<Source, Stages..., Stage> operator|(Pipe&& pipe, Stage stage) {
+    return Pipe<Source, Stages..., Stage>(static_cast<SourceRef>(pipe.source_),
+                                          std::tuple_cat(std::move(pipe.stages_), std::tuple<Stage>(std::move(stage))));
+  }
+
+  friend output_type operator|(Pipe&& pipe, EvalStage) { return std::move(pipe).eval(); }
+};
+
+//*   <--- stages --->
+
+template <typename Fn>
+FmapStage<std::decay_t<Fn>> fmap(Fn&& fn) { return {std::forward<Fn>(fn)}; }
+
+template <typename Fn>
+AndThenStage<std::decay_t<Fn>> and_then(Fn&& fn) { return {std::forward<Fn>(fn)}; }
+
+inline constexpr EvalStage eval() noexcept { return {}; }
+
+// The first stage starts the pipeline:
+template <typename W, typename Stage>
+requires ((detail::OptionTraits<std::remove_cvref_t<W>>::is_option || detail::ResultTraits<std::remove_cvref_t<W>>::is_result) &&
+          detail::is_pipe_stage_v<Stage>)
+auto operator|(W&& source, Stage stage) {
+  // lvalues are referred to, rvalues are moved into the pipeline:
+  using Source = std::conditional_t<std::is_lvalue_reference_v<W>, W, std::remove_cvref_t<W>>;
+  return Pipe<Source, Stage>(std::forward<W>(source), std::tuple<Stage>(std::move(stage)));
+}
+
+} // namespace tmn::pipe;
+
+#endif // TMN_THROWLESS_PIPE_HPP
@@ -0,0 +1,186 @@
+#ifndef TMN_THROWLESS_COROUTINE_HPP
+#define TMN_THROWLESS_COROUTINE_HPP
+
+//* <--- Early-return propagation via coroutines: `co_await` on Option / Result --->
+
+#include <coroutine> // for: coroutine_traits, coroutine_handle, suspend_never;
+#include <optional> // for: optional (storage of the returned object);
+#include <utility> // for: move, forward, declval;
+#include <concepts> // for: constructible_from;
+#include <type_traits> // for: remove_cvref_t;
+#include <exception> // for: exception_ptr, current_exception, rethrow_exception;
+
+#include "../../src/Propagation/TryTraits.hpp"
+#include "../../src/Propagation/FrameArena.hpp"
+#include "../Panic/Panic.hpp" // for: panic, TMN_THROWLESS_HAS_EXCEPTIONS;
+
+// Any function returning Option<T> or Result<T, E> becomes a "propagation coroutine"
+// as soon as it uses `co_await` / `co_return`:
+//   Result<Config, StrErr> parse(const std::string& s) {
+//     int port = co_await extract_port(s); // on Err: returns this Err from `parse`;
+//     std::string host = co_await extract_host(s);
+//     co_return Config{host, port};
+//   }
+// - `co_await opt` in a function returning Option<U> yields the value or returns None;
+// - `co_await res` in a function returning Result<U, F> yields the value or returns the Err
+//   (F must be constructible from the awaited error type);
+// - `co_return value` returns Some(value) / Ok(value); `co_return Option/Result` returns it as is;
+// Such coroutines never stay suspended, so their frames are taken from a thread-local
+// LIFO arena when the compiler does not elide the allocation (HALO);
+// the cost: a frame per call (GCC does not elide it), so `co_await` is about 2.5-3x slower
+// than TMN_TRY or a hand-written early return in tight loops (bench/Propagation/TryBench.cpp);
+// use it where the readability matters more than a few nanoseconds per call;
+//
+// The returned object is built in storage of the object returned by `get_return_object()`,
+// which the compiler converts to R when the coroutine returns to the caller (GCC, Clang);
+// a compiler converting it before the body runs is detected with a panic;
+// an exception escaping the body is rethrown to the caller after the frame is destroyed;
+
+namespace tmn::detail {
+
+// Where the body leaves the returned object (and the exception that escaped it): the storage
+// lives in the ReturnObject, outside of the coroutine frame, so the frame can be destroyed
+// as soon as the body completes;
+template <typename R>
+struct PropagationState {
+  std::optional<R> value;
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+  std::exception_ptr exception;
+#endif
+};
+
+template <typename R, typename A>
+struct PropagationAwaiter {
+  A&& awaited;
+  std::optional<R>* slot;
+
+  bool await_ready() const noexcept {
+    return !TryTraits<std::remove_cvref_t<A>>::is_failure(awaited);
+  }
+
+  // Failure: the returned object receives the failure and the coroutine is destroyed,
+  // control goes back to the caller without resuming the body;
+  void await_suspend(std::coroutine_handle<> handle) {
+    slot->emplace(TryTraits<std::remove_cvref_t<A>>::failure(std::forward<A>(awaited)));
+    handle.destroy();
+  }
+
+  decltype(auto) await_resume() {
+    return TryTraits<std::remove_cvref_t<A>>::unwrap(std::forward<A>(awaited));
+  }
+};
+
+// R is the return type of the coroutine: Option<T> or Result<T, E>;
+template <typename R>
+class PropagationPromiseBase {
+protected: //* fields:
+  // points to the storage of the object that the caller will receive:
+  PropagationState<R>* state = nullptr;
+  std::optional<R>* slot = nullptr;
+
+public: //* substructures:
+  // Returned by `get_return_object()` and converted to R when the coroutine returns
+  // to the caller, after the body has completed;
+  class ReturnObject {
+  private:
+    PropagationState<R> state;
+
+  public:
+    explicit ReturnObject(PropagationPromiseBase& promise) noexcept {
+      promise.state = &state;
+      promise.slot = &state.value;
+    }
+
+    ReturnObject(const ReturnObject&) = delete;
+    ReturnObject& operator=(const ReturnObject&) = delete;
+
+    operator R() {
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+      if (state.exception) [[unlikely]] std::rethrow_exception(std::move(state.exception));
+#endif
+      if (!state.value.has_value()) [[unlikely]] {
+        panic("Propagation coroutine: the return object was converted before the body completed");
+      }
+      return std::move(*state.value);
+    }
+  };
+
+public: //* methods:
+  ReturnObject get_return_object() noexcept { return ReturnObject(*this); }
+
+  std::suspend_never initial_suspend() const noexcept { return {}; }
+  std::suspend_never final_suspend() const noexcept { return {}; }
+
+  // The exception is kept for the caller: the body completes normally, so the frame is
+  // destroyed at the final suspend point (a rethrow from here would leave it suspended);
+  // without exceptions nothing can escape the body:
+  void unhandled_exception() noexcept {
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+    state->exception = std::current_exception();
+#else
+    panic("Exception escaped from a coroutine");
+#endif
+  }
+
+  template <typename A>
+  requires std::constructible_from<R, decltype(TryTraits<std::remove_cvref_t<A>>::failure(std::declval<A>()))>
+  PropagationAwaiter<R, A> await_transform(A&& awaited) noexcept {
+    return PropagationAwaiter<R, A>{std::forward<A>(awaited), slot};
+  }
+
+  static void* operator new(std::size_t size) { return CoroutineFrameArena::allocate(size); }
+  static void operator delete(void* frame, std::size_t size) noexcept { CoroutineFrameArena::deallocate(frame, size); }
+};
+
+template <typename T, typename E>
+class ResultPromise : public PropagationPromiseBase<Result<T, E>> {
+public:
+  template <typename U> requires std::constructible_from<T, U&&>
+  void return_value(U&& value) {
+    this->slot->emplace(Result<T, E>::Ok(static_cast<T>(std::forward<U>(value))));
+  }
+
+  void return_value(Result<T, E> result) {
+    this->slot->emplace(std::move(result));
+  }
+};
+
+template <typename E>
+class ResultPromise<void, E> : public PropagationPromiseBase<Result<void, E>> {
+public:
+  void return_void() {
+    this->slot->emplace(Result<void, E>::Ok());
+  }
+};
+
+template <typename T>
+class OptionPromise : public PropagationPromiseBase<Option<T>> {
+public:
+  template <typename U> requires std::constructible_from<T, U&&>
+  void return_value(U&& value) {
+    this->slot->emplace(Option<T>(static_cast<T>(std::forward<U>(value))));
+  }
+
+  void return_value(Option<T> option) {
+    this->slot->emplace(std::move(option));
+  }
+};
+
+} // namespace tmn::detail;
+
+// Specializations of std::coroutine_traits connecting Option / Result to their promises:
+namespace std {
+
+template <typename T, typename E, typename... Args>
+struct coroutine_traits<tmn::Result<T, E>, Args...> {
+  using promise_type = tmn::detail::ResultPromise<T, E>;
+};
+
+template <typename T, typename... Args>
+struct coroutine_traits<tmn::Option<T>, Args...> {
+  using promise_type = tmn::detail::OptionPromise<T>;
+};
+
+} // namespace std;
+
+#endif // TMN_THROWLESS_COROUTINE_HPP
@@ -0,0 +1,38 @@
+#ifndef TMN_THROWLESS_TRY_HPP
+#define TMN_THROWLESS_TRY_HPP
+
+//* <--- Early-return propagation of None / Err without exceptions --->
+
+#include <utility> // for: forward;
+#include <type_traits> // for: remove_cvref_t;
+
+#include "../../src/Propagation/TryTraits.hpp"
+
+// TMN_TRY(expr) evaluates `expr` (Option<T> or Result<T, E>):
+// - on None / Err it returns the failure from the enclosing function,
+//   which must return Option<U> (for None) or Result<U, F> with F constructible from E (for Err);
+// - otherwise the whole expression evaluates to the contained value (moved out of rvalues);
+// Usage:
+//   Result<Config, StrErr> parse(const std::string& s) {
+//     int port = TMN_TRY(extract_port(s));
+//     ...
+//   }
+// The macro is built on statement expressions, so it is available only for GCC/Clang;
+// the portable alternative is `co_await` from "Coroutine.hpp";
+// (!) statement expressions return by value: TMN_TRY over Option<T&> / Result<T&, E>
+// yields a copy of the referred object, `co_await` yields the reference itself;
+#if defined(__GNUC__) || defined(__clang__)
+
+#define TMN_TRY(...)                                                                             \
+  __extension__ ({                                                                               \
+    auto&& tmn_try_value_ = (__VA_ARGS__);                                                       \
+    using tmn_try_traits_ = ::tmn::detail::TryTraits<std::remove_cvref_t<decltype(tmn_try_value_)>>; \
+    if (tmn_try_traits_::is_failure(tmn_try_value_)) [[unlikely]] {                              \
+      return tmn_try_traits_::failure(std::forward<decltype(tmn_try_value_)>(tmn_try_value_));   \
+    }                                                                                            \
+    tmn_try_traits_::unwrap(std::forward<decltype(tmn_try_value_)>(tmn_try_value_));             \
+  })
+
+#endif
+
+#endif // TMN_THROWLESS_TRY_HPP
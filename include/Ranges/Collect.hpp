@@ -0,0 +1,114 @@
+#ifndef TMN_THROWLESS_RANGES_COLLECT_HPP
+#define TMN_THROWLESS_RANGES_COLLECT_HPP
+
+#include <ranges> // for: sized_range, size;
+#include <cstddef> // for: size_t;
+#include <utility> // for: move, forward;
+#include <concepts> // for: constructible_from;
+
+#include "../Option/Option.hpp"
+#include "../Result/Result.hpp"
+#include "../Error/ErrList.hpp"
+#include "../../src/Ranges/RangeTraits.hpp"
+
+namespace tmn {
+
+//* <--- Collection of ranges of Option / Result into one Option / Result --->
+
+// collect<Container>(options)            -> Option<Container>: None at the first None;
+// collect<Container>(results)            -> Result<Container, E>: the first Err;
+// collect_all_errors<Container>(results) -> Result<Container, err::ErrList<E>>: every Err;
+// the container is given as a type or as a template (`std::vector` = std::vector<T>):
+//   auto ports = tmn::collect<std::vector>(lines | std::views::transform(parse_port));
+//   auto names = tmn::collect<std::set<std::string>>(std::move(maybe_names));
+// One pass over the range, so lazy views are evaluated once and need no intermediate
+// vector; the container is reserved exactly when the size is known (sized ranges),
+// the payloads are moved when the elements are temporaries (views producing Option /
+// Result by value, std::views::as_rvalue) or the range itself is an expiring container;
+// collect stops reading the range at the first failure;
+
+namespace detail {
+
+template <typename Container, typename R>
+void reserve_for(Container& container, R& range) {
+  if constexpr (std::ranges::sized_range<R> && requires(std::size_t n) { container.reserve(n); }) {
+    container.reserve(static_cast<std::size_t>(std::ranges::size(range)));
+  }
+}
+
+template <typename Container, typename V>
+void append_to(Container& container, V&& value) {
+  if constexpr (requires { container.push_back(std::forward<V>(value)); }) container.push_back(std::forward<V>(value));
+  else container.insert(container.end(), std::forward<V>(value));
+}
+
+template <typename Container, typename R>
+concept CollectableInto = requires { typename Container::value_type; } &&
+  std::constructible_from<typename Container::value_type, typename range_wrapper_traits<R>::value_type>;
+
+} // namespace tmn::detail;
+
+//*   <--- collect --->
+
+template <typename Container, typename R>
+requires (detail::OptionInputRange<R> && detail::CollectableInto<Container, R>)
+Option<Container> collect(R&& options) {
+  constexpr bool move = detail::moves_payloads<R>;
+  Container container;
+  detail::reserve_for(container, options);
+  for (auto&& opt : options) {
+    if (!opt.has_value()) return Option<Container>();
+    detail::append_to(container, detail::present_value<move>(opt));
+  }
+  return Option<Container>(std::move(container));
+}
+
+template <typename Container, typename R>
+requires (detail::ResultInputRange<R> && detail::CollectableInto<Container, R>)
+auto collect(R&& results) -> Result<Container, typename detail::range_wrapper_traits<R>::error_type> {
+  using E = typename detail::range_wrapper_traits<R>::error_type;
+  constexpr bool move = detail::moves_payloads<R>;
+  Container container;
+  detail::reserve_for(container, results);
+  for (auto&& res : results) {
+    if (!res.is_ok()) return Result<Container, E>::Err(detail::error_value<move>(res));
+    detail::append_to(container, detail::present_value<move>(res));
+  }
+  return Result<Container, E>::Ok(std::move(container));
+}
+
+template <template <typename...> typename Container, typename R>
+requires (detail::OptionInputRange<R> || detail::ResultInputRange<R>)
+auto collect(R&& range) {
+  return collect<Container<typename detail::range_wrapper_traits<R>::value_type>>(std::forward<R>(range));
+}
+
+//*   <--- collect_all_errors --->
+
+// Reads the whole range: after the first Err only the errors are kept;
+template <typename Container, typename R>
+requires (detail::ResultInputRange<R> && detail::CollectableInto<Container, R>)
+auto collect_all_errors(R&& results) -> Result<Container, err::ErrList<typename detail::range_wrapper_traits<R>::error_type>> {
+  using E = typename detail::range_wrapper_traits<R>::error_type;
+  constexpr bool move = detail::moves_payloads<R>;
+  Container container;
+  err::ErrList<E> errors;
+  detail::reserve_for(container, results);
+  for (auto&& res : results) {
+    if (!res.is_ok()) [[unlikely]] errors.push_back(detail::error_value<move>(res));
+    else if (errors.empty()) detail::append_to(container, detail::present_value<move>(res));
+  }
+
+  if (!errors.empty()) return Result<Container, err::ErrList<E>>::Err(std::move(errors));
+  return Result<Container, err::ErrList<E>>::Ok(std::move(container));
+}
+
+template <template <typename...> typename Container, typename R>
+requires detail::ResultInputRange<R>
+auto collect_all_errors(R&& results) {
+  return collect_all_errors<Container<typename detail::range_wrapper_traits<R>::value_type>>(std::forward<R>(results));
+}
+
+} // namespace tmn;
+
+#endif // TMN_THROWLESS_RANGES_COLLECT_HPP
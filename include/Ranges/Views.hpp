@@ -0,0 +1,226 @@
+#ifndef TMN_THROWLESS_RANGES_VIEWS_HPP
+#define TMN_THROWLESS_RANGES_VIEWS_HPP
+
+#include <ranges> // for: view, view_interface, all, all_t, transform_view, viewable_range;
+#include <utility> // for: move, forward;
+#include <optional> // for: optional (cache of the current element);
+#include <iterator> // for: input_iterator_tag, forward_iterator_tag, default_sentinel_t;
+#include <concepts> // for: invocable;
+#include <functional> // for: invoke;
+#include <type_traits> // for: conditional_t, remove_cvref_t, is_lvalue_reference_v, invoke_result_t;
+
+#include "../Option/Option.hpp"
+#include "../Result/Result.hpp"
+#include "../../src/Ranges/RangeTraits.hpp"
+
+namespace tmn::views {
+
+//* <--- Lazy range adaptors for ranges of Option / Result --->
+
+// r | views::some             : values of the present Options (Nones are skipped);
+// r | views::ok               : values of the Ok Results;
+// r | views::errs             : errors of the Err Results;
+// r | views::and_then(fn)     : fn(x) -> Option<U> for every x (for every present value
+//                               of a range of Options), the present results are kept;
+// r | views::transform_ok(fn) : Result<U, E>: fn applied to the Ok values, Errs passed through;
+// one pass, nothing is allocated and the elements are not copied: views over containers
+// yield references into the elements (`T&` / `const T&`), and keep the forward traversal
+// of the underlying range;
+//   for (const Config& cfg : configs | tmn::views::some) apply(cfg);
+//   auto ports = lines | tmn::views::and_then(parse_port);   // lazy, parse_port called once per line
+//   for (int port : ports) listen(port);
+// elements produced by value (std::views::transform, and_then) are moved into a cache
+// in the view and the view is an input range: every element is computed once;
+
+namespace detail {
+
+struct KeepPresent {
+  template <typename W>
+  static bool keep(const W& elem) noexcept { return tmn::detail::is_present(elem); }
+
+  template <typename W>
+  static decltype(auto) project(W& elem) noexcept { return tmn::detail::present_value<false>(elem); }
+};
+
+struct KeepErrors {
+  template <typename W>
+  static bool keep(const W& elem) noexcept { return !elem.is_ok(); }
+
+  template <typename W>
+  static decltype(auto) project(W& elem) noexcept { return tmn::detail::error_value<false>(elem); }
+};
+
+} // namespace tmn::views::detail;
+
+//*   <--- some / ok / errs --->
+
+// Elements of V for which `Keep::keep` holds, as `Keep::project` of them:
+template <std::ranges::view V, typename Keep> requires std::ranges::input_range<V>
+class UnwrapView : public std::ranges::view_interface<UnwrapView<V, Keep>> {
+private: //* substructures:
+  using Elem = std::ranges::range_reference_t<V>;
+  static constexpr bool caches_elements = !std::is_lvalue_reference_v<Elem>;
+  static constexpr bool is_forward = !caches_elements && std::ranges::forward_range<V>;
+
+  struct NoCache {};
+  using Cache = std::conditional_t<caches_elements, std::optional<std::remove_cvref_t<Elem>>, NoCache>;
+
+  class Iterator {
+  private: //* fields:
+    UnwrapView* parent_ = nullptr;
+    std::ranges::iterator_t<V> current_{};
+
+  private: //* methods:
+    // Moves to the next kept element (from current_ on):
+    void satisfy() {
+      const auto end = std::ranges::end(parent_->base_);
+      for (; current_ != end; ++current_) {
+        if constexpr (caches_elements) {
+          parent_->cache_.emplace(*current_);
+          if (Keep::keep(*parent_->cache_)) return;
+        }
+        else {
+          if (Keep::keep(*current_)) return;
+        }
+      }
+    }
+
+    bool at_end() const { return current_ == std::ranges::end(parent_->base_); }
+
+    decltype(auto) element() const {
+      if constexpr (caches_elements) return *parent_->cache_;
+      else return *current_;
+    }
+
+  public: //* types:
+    using iterator_concept = std::conditional_t<is_forward, std::forward_iterator_tag, std::input_iterator_tag>;
+    using difference_type = std::ranges::range_difference_t<V>;
+    using value_type = std::remove_cvref_t<decltype(Keep::project(std::declval<std::conditional_t<caches_elements,
+      std::remove_cvref_t<Elem>&, Elem>>()))>;
+
+  public: //* methods:
+    Iterator() = default;
+    Iterator(UnwrapView& parent, std::ranges::iterator_t<V> current) : parent_(&parent), current_(std::move(current)) { satisfy(); }
+
+    decltype(auto) operator*() const { return Keep::project(element()); }
+
+    Iterator& operator++() {
+      ++current_;
+      satisfy();
+      return *this;
+    }
+
+    void operator++(int) requires (!is_forward) { ++*this; }
+
+    Iterator operator++(int) requires is_forward {
+      Iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) requires is_forward { return lhs.current_ == rhs.current_; }
+    friend bool operator==(const Iterator& it, std::default_sentinel_t) { return it.at_end(); }
+  };
+
+private: //* fields:
+  V base_ = V();
+  [[no_unique_address]] Cache cache_;
+
+public: //* methods:
+  UnwrapView() requires std::default_initializable<V> = default;
+  explicit UnwrapView(V base) : base_(std::move(base)) {}
+
+  V base() const& requires std::copy_constructible<V> { return base_; }
+  V base() && { return std::move(base_); }
+
+  Iterator begin() { return Iterator(*this, std::ranges::begin(base_)); }
+  std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+//*   <--- adaptor objects --->
+
+namespace detail {
+
+// `r | adaptor` and `adaptor(r)`:
+template <typename Adaptor>
+struct Pipeable {
+  template <std::ranges::viewable_range R> requires std::invocable<const Adaptor&, R>
+  friend auto operator|(R&& range, const Adaptor& adaptor) { return adaptor(std::forward<R>(range)); }
+};
+
+// `r | adaptor(args)`: the arguments are stored in the closure;
+template <typename Fn>
+struct Closure : Pipeable<Closure<Fn>> {
+  Fn make_view;
+
+  explicit Closure(Fn fn) : make_view(std::move(fn)) {}
+
+  template <std::ranges::viewable_range R> requires std::invocable<const Fn&, R>
+  auto operator()(R&& range) const { return make_view(std::forward<R>(range)); }
+};
+
+struct SomeAdaptor : Pipeable<SomeAdaptor> {
+  template <std::ranges::viewable_range R> requires tmn::detail::OptionInputRange<R>
+  auto operator()(R&& range) const { return UnwrapView<std::views::all_t<R>, KeepPresent>(std::views::all(std::forward<R>(range))); }
+};
+
+struct OkAdaptor : Pipeable<OkAdaptor> {
+  template <std::ranges::viewable_range R> requires tmn::detail::ResultInputRange<R>
+  auto operator()(R&& range) const { return UnwrapView<std::views::all_t<R>, KeepPresent>(std::views::all(std::forward<R>(range))); }
+};
+
+struct ErrsAdaptor : Pipeable<ErrsAdaptor> {
+  template <std::ranges::viewable_range R> requires (std::ranges::input_range<R> && tmn::detail::range_wrapper_traits<R>::is_result)
+  auto operator()(R&& range) const { return UnwrapView<std::views::all_t<R>, KeepErrors>(std::views::all(std::forward<R>(range))); }
+};
+
+// Ok values mapped by fn, errors moved (copied from lvalues) into the new Result:
+template <typename Fn>
+struct MapOk {
+  Fn fn;
+
+  template <typename W>
+  auto operator()(W&& res) const {
+    constexpr bool move = !std::is_lvalue_reference_v<W>;
+    using E = typename tmn::detail::WrapperTraits<std::remove_cvref_t<W>>::error_type;
+    using U = std::remove_cvref_t<std::invoke_result_t<const Fn&, decltype(tmn::detail::present_value<move>(res))>>;
+
+    if (!res.is_ok()) return Result<U, E>::Err(tmn::detail::error_value<move>(res));
+    if constexpr (std::is_void_v<U>) {
+      std::invoke(fn, tmn::detail::present_value<move>(res));
+      return Result<U, E>::Ok();
+    }
+    else {
+      return Result<U, E>::Ok(std::invoke(fn, tmn::detail::present_value<move>(res)));
+    }
+  }
+};
+
+} // namespace tmn::views::detail;
+
+inline constexpr detail::SomeAdaptor some{};
+inline constexpr detail::OkAdaptor ok{};
+inline constexpr detail::ErrsAdaptor errs{};
+
+template <typename Fn>
+auto and_then(Fn fn) {
+  return detail::Closure{[fn = std::move(fn)]<std::ranges::viewable_range R>(R&& range) {
+    if constexpr (tmn::detail::OptionInputRange<R>) {
+      return some(std::ranges::transform_view(some(std::forward<R>(range)), fn));
+    }
+    else {
+      return some(std::ranges::transform_view(std::views::all(std::forward<R>(range)), fn));
+    }
+  }};
+}
+
+template <typename Fn>
+auto transform_ok(Fn fn) {
+  return detail::Closure{[fn = std::move(fn)]<std::ranges::viewable_range R>(R&& range) requires tmn::detail::ResultInputRange<R> {
+    return std::ranges::transform_view(std::views::all(std::forward<R>(range)), detail::MapOk<Fn>{fn});
+  }};
+}
+
+} // namespace tmn::views;
+
+#endif // TMN_THROWLESS_RANGES_VIEWS_HPP
@@ -3,31 +3,45 @@
 
 #include <concepts> // for: default_initializable<>;
 #include <type_traits> // for: conditional, is_nothrow_constructible;
+#include <cstdint> // for: uint8_t;
 
 #include "../Option/Option.hpp" // for: class conversion;
+#include "../../src/Result/AndThen.hpp" // for: result type of `and_then` (error widening);
 
 namespace tmn {
 
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+namespace detail {
+
+// raw access to the storage for the batch kernels (src/Result/ResultStorage.hpp):
+struct ResultStorage;
+
+} // namespace tmn::detail;
+
+template<typename T, typename E> requires err::Error<E>
 class Result {
 private: //* substructures:
-  enum class State {
+  // One byte is enough for the discriminant. It follows the union, and the size
+  // of the Result is the union plus this byte rounded up to the alignment: smaller
+  // than with an int-sized state only when the union leaves room for the byte
+  // within the alignment (a union of 7 bytes: 8 instead of 12), the same otherwise;
+  enum class State : std::uint8_t {
     OkState,
-    ErrState,
-    Uninitialized
+    ErrState
   };
 
 private: //* fields:
-  State state;
-
   union {
     T ok_val;
     E err_val;
   };
 
+  State state;
+
 public: //* methods:
   //*   <--- constructors, (~)ro5, destructor --->
   Result() = delete;
+  // Moving does not change the state of the source: a moved-from Result
+  // keeps its Ok/Err state and holds a moved-from value (valid but unspecified);
   Result(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<T> && std::is_nothrow_copy_constructible_v<E>);
   Result(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
   Result& operator=(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<T> && std::is_nothrow_copy_constructible_v<E>);
@@ -83,6 +97,13 @@ public: //* methods:
   E& unwrap_err();
   const E& unwrap_err() const;
 
+  // Unchecked access for a Result whose state is already known (e.g. after `is_ok()`):
+  // asserted in debug builds, a plain load in release builds (see TMN_THROWLESS_ASSUME);
+  T& unwrap_unchecked() noexcept;
+  const T& unwrap_unchecked() const noexcept;
+  E& unwrap_err_unchecked() noexcept;
+  const E& unwrap_err_unchecked() const noexcept;
+
   //*   <--- functional methods (from funcprog)  --->
   // !!! Result object can have one of two values.
   // Therefore, the passed function (fn) must be able to handle both options:
@@ -97,11 +118,14 @@ public: //* methods:
     noexcept(std::is_nothrow_constructible_v<Result<T, std::invoke_result_t<Func, E>>> && std::is_nothrow_invocable_v<Func, T>)
     -> Result<T, std::invoke_result_t<Func, E>>;
 
+  // `fn` returning a plain value: the value is wrapped into Ok (as `fmap`);
+  // `fn` returning Result<U, F>: flattened into Result<U, widen_t<E, F>>
+  // (the same E, or OneOf of both error sets if F differs from E);
   template <typename Func>
   requires std::invocable<Func, T>
   auto and_then(Func&& fn) const
-    noexcept(std::is_nothrow_constructible_v<Result<std::invoke_result_t<Func, T>, E>> && std::is_nothrow_invocable_v<Func, T>)
-    -> Result<std::invoke_result_t<Func, T>, E>;
+    noexcept(std::is_nothrow_constructible_v<detail::and_then_result_t<std::invoke_result_t<Func, T>, E>> && std::is_nothrow_invocable_v<Func, T>)
+    -> detail::and_then_result_t<std::invoke_result_t<Func, T>, E>;
 
 private: //* methods:
   void swap(Result<T,E>& oth)
@@ -116,6 +140,13 @@ private: //* methods:
   Result(E&& err) noexcept(std::is_nothrow_move_constructible_v<E>);
 
 private: //* friends:
+  // access to the private constructors of Result with other template parameters
+  // (for example, `fmap` that changes the type of the value):
+  template<typename U, typename F> requires err::Error<F>
+  friend class Result;
+
+  friend struct detail::ResultStorage;
+
   friend void swap(Result<T,E>& first, Result<T,E>& second) noexcept(noexcept(first.swap(second))) {
     first.swap(second);
   }
@@ -125,5 +156,8 @@ private: //* friends:
 } // for: namespace tmn;
 
 #include "../../src/Result/Result.tpp" // for: Result definition;
+#include "../../src/Result/VoidResult.hpp" // for: Result<void, E> specialization;
+#include "../../src/Result/RefResult.hpp" // for: Result<T&, E> specialization;
+#include "../Error/OneOf.hpp" // for: error type of widening `and_then`;
 
 #endif // TMN_THROWLESS_RESULT_HPP
@@ -0,0 +1,76 @@
+#ifndef TMN_THROWLESS_SHARED_STR_HPP
+#define TMN_THROWLESS_SHARED_STR_HPP
+
+#include <atomic> // for: std::atomic;
+#include <cstddef> // for: size_t;
+#include <string>
+#include <string_view>
+
+namespace tmn {
+
+// SharedStr is an immutable reference-counted string: copies share one buffer,
+// so copying costs a single atomic increment instead of an allocation and memcpy.
+// The counter uses the same protocol as ControlBlock of SharedPtr (relaxed increment,
+// acq_rel decrement), but the control block and the characters are placed
+// in a single allocation:
+//   [ ref_count | length | c h a r s ... '\0' ]
+// There are no weak references and no custom deleters, the text can not be modified;
+class SharedStr {
+private: //* substructures:
+  struct StrControlBlock {
+    std::atomic<std::size_t> ref_count;
+    std::size_t length;
+
+    char* chars() noexcept { return reinterpret_cast<char*>(this + 1); }
+    const char* chars() const noexcept { return reinterpret_cast<const char*>(this + 1); }
+
+    void increment_strong() noexcept;
+    bool decrement_strong() noexcept;
+  };
+
+private: //* fields:
+  // nullptr for the empty string (no allocation):
+  StrControlBlock* control_block = nullptr;
+
+private: //* methods:
+  void cleanup() noexcept;
+  void swap(SharedStr& oth) noexcept;
+
+  friend void swap(SharedStr& first, SharedStr& second) noexcept {
+    first.swap(second);
+  }
+
+public:
+//*   <--- constructors, (~)ro5, destructor (etc) --->
+  SharedStr() noexcept = default;
+  SharedStr(std::string_view text);
+  SharedStr(const std::string& text);
+  SharedStr(const char* text);
+
+  SharedStr(const SharedStr& oth) noexcept;
+  SharedStr(SharedStr&& oth) noexcept;
+
+  SharedStr& operator=(const SharedStr& oth) noexcept;
+  SharedStr& operator=(SharedStr&& oth) noexcept;
+
+  ~SharedStr();
+
+  // Observers:
+  const char* c_str() const noexcept;
+  std::string_view view() const noexcept;
+  std::string str() const;
+  std::size_t size() const noexcept;
+  bool empty() const noexcept;
+
+  // number of SharedStr objects sharing the buffer (0 for the empty string):
+  std::size_t counter_value() const noexcept;
+
+  // Comparison of the text (not of the buffers):
+  bool operator==(const SharedStr& oth) const noexcept;
+};
+
+} // namespace tmn;
+
+#include "../../src/SmartPtr/SharedStr/SharedStr.tpp"
+
+#endif // TMN_THROWLESS_SHARED_STR_HPP
@@ -0,0 +1,179 @@
+#ifndef TMN_THROWLESS_VALIDATION_HPP
+#define TMN_THROWLESS_VALIDATION_HPP
+
+//* <--- Validation: applicative that accumulates the errors --->
+
+#include <cstddef> // for: size_t;
+#include <utility> // for: move, forward, as_const, declval;
+#include <optional> // for: optional (the valid value);
+#include <concepts> // for: constructible_from, invocable, same_as;
+#include <functional> // for: invoke;
+#include <type_traits> // for: invoke_result_t, remove_cvref_t, is_lvalue_reference_v, is_void_v;
+
+#include "../Result/Result.hpp"
+#include "../Error/ErrList.hpp"
+#include "../Panic/Panic.hpp" // for: TMN_THROWLESS_ASSUME;
+#include "../../src/Validation/ErrArena.hpp"
+
+namespace tmn {
+
+// Validation<T, E> is a value or every error found while computing it: unlike Result,
+// `combine` does not stop at the first failure, it evaluates all its arguments and
+// keeps the errors of all of them (in the order of the arguments);
+//   Validation<Request, FieldErr> req = combine(make_request, check_name(json), check_port(json), check_user(json));
+//   Result<Request, err::ErrList<FieldErr>> res = std::move(req).to_result();
+// - the valid path allocates nothing: the errors live in an arena (src/Validation/ErrArena.hpp)
+//   that stores the first error inline and the next ones in blocks of doubling capacity,
+//   combining failures splices the blocks instead of copying the errors;
+// - `to_result()` moves the errors into ErrList<E> (one allocation, on the error path only);
+template <typename T, typename E> requires (err::Error<E> && !std::is_void_v<T>)
+class Validation;
+
+namespace detail {
+
+// access to the value and the errors for `combine` (rvalue Validations are moved from):
+struct ValidationAccess;
+
+template <typename V>
+struct ValidationTraits { static constexpr bool is_validation = false; };
+
+template <typename T, typename E>
+struct ValidationTraits<Validation<T, E>> {
+  static constexpr bool is_validation = true;
+  using value_type = T;
+  using error_type = E;
+};
+
+template <typename V>
+concept ValidationRef = ValidationTraits<std::remove_cvref_t<V>>::is_validation;
+
+} // namespace tmn::detail;
+
+template <typename T, typename E> requires (err::Error<E> && !std::is_void_v<T>)
+class Validation {
+private: //* fields:
+  std::optional<T> value_;
+  detail::ErrArena<E> errors_;
+
+private: //* methods:
+  explicit Validation(detail::ErrArena<E>&& errors) noexcept : errors_(std::move(errors)) {}
+
+public: //* methods:
+  //*   <--- static mnemonic methods that call the constructor from an argument --->
+  template <typename... Args> requires std::constructible_from<T, Args...>
+  static Validation Valid(Args&&... args) {
+    Validation valid{detail::ErrArena<E>()};
+    valid.value_.emplace(std::forward<Args>(args)...);
+    return valid;
+  }
+
+  static Validation Invalid(E error) {
+    detail::ErrArena<E> errors;
+    errors.push_back(std::move(error));
+    return Validation(std::move(errors));
+  }
+
+  static Validation from_result(Result<T, E> res) {
+    if (res.is_ok()) return Valid(std::move(res.unwrap_unchecked()));
+    return Invalid(std::move(res.unwrap_err_unchecked()));
+  }
+
+  //*   <--- specialized algorithms & methods --->
+  bool is_valid() const noexcept { return errors_.empty(); }
+  bool is_invalid() const noexcept { return !errors_.empty(); }
+
+  // Unchecked access for a Validation that is known to be valid:
+  // asserted in debug builds, a plain load in release builds (see TMN_THROWLESS_ASSUME);
+  T& value_unchecked() noexcept {
+    TMN_THROWLESS_ASSUME(value_.has_value(), "Validation: unchecked access to the value of Invalid");
+    return *value_;
+  }
+
+  const T& value_unchecked() const noexcept {
+    TMN_THROWLESS_ASSUME(value_.has_value(), "Validation: unchecked access to the value of Invalid");
+    return *value_;
+  }
+
+  // Errors in the order they were found (a forward range of `const E&`, empty when valid):
+  const detail::ErrArena<E>& errors() const noexcept { return errors_; }
+  std::size_t error_count() const noexcept { return errors_.size(); }
+
+  // Functor interface:
+  template <typename Func> requires std::invocable<Func, T&&>
+  auto fmap(Func&& fn) && -> Validation<std::invoke_result_t<Func, T&&>, E> {
+    using Out = Validation<std::invoke_result_t<Func, T&&>, E>;
+    if (is_invalid()) return Out(std::move(errors_));
+    return Out::Valid(std::invoke(std::forward<Func>(fn), std::move(*value_)));
+  }
+
+  // Conversion to Result: the first error does not hide the others;
+  Result<T, err::ErrList<E>> to_result() && {
+    using Out = Result<T, err::ErrList<E>>;
+    if (is_valid()) return Out::Ok(std::move(*value_));
+
+    err::ErrList<E> list;
+    list.reserve(errors_.size());
+    errors_.drain([&list](E&& error) { list.push_back(std::move(error)); });
+    return Out::Err(std::move(list));
+  }
+
+  Result<T, err::ErrList<E>> to_result() const& { return Validation(*this).to_result(); }
+
+private: //* friends:
+  template <typename U, typename F> requires (err::Error<F> && !std::is_void_v<U>)
+  friend class Validation;
+
+  friend struct detail::ValidationAccess;
+};
+
+namespace detail {
+
+struct ValidationAccess {
+  template <typename V>
+  static decltype(auto) value(V&& validation) noexcept {
+    if constexpr (std::is_lvalue_reference_v<V>) return std::as_const(*validation.value_);
+    else return std::move(*validation.value_);
+  }
+
+  template <typename V>
+  static decltype(auto) errors(V&& validation) noexcept {
+    if constexpr (std::is_lvalue_reference_v<V>) return std::as_const(validation.errors_);
+    else return std::move(validation.errors_);
+  }
+
+  template <typename T, typename E>
+  static Validation<T, E> invalid(ErrArena<E>&& errors) noexcept { return Validation<T, E>(std::move(errors)); }
+};
+
+template <typename V>
+using validation_arg_t = decltype(ValidationAccess::value(std::declval<V>()));
+
+} // namespace tmn::detail;
+
+// Applicative interface:
+// fn(values...) if every argument is valid, otherwise all errors of the arguments;
+// rvalue Validations are moved from (their errors are spliced, not copied);
+template <typename Func, typename V, typename... Vs>
+requires (detail::ValidationRef<V> && (detail::ValidationRef<Vs> && ...) &&
+          (std::same_as<typename detail::ValidationTraits<std::remove_cvref_t<V>>::error_type,
+                        typename detail::ValidationTraits<std::remove_cvref_t<Vs>>::error_type> && ...) &&
+          std::invocable<Func, detail::validation_arg_t<V>, detail::validation_arg_t<Vs>...>)
+auto combine(Func&& fn, V&& first, Vs&&... rest) {
+  using E = typename detail::ValidationTraits<std::remove_cvref_t<V>>::error_type;
+  using U = std::invoke_result_t<Func, detail::validation_arg_t<V>, detail::validation_arg_t<Vs>...>;
+  using Out = Validation<U, E>;
+
+  if (first.is_valid() && (rest.is_valid() && ...)) {
+    return Out::Valid(std::invoke(std::forward<Func>(fn), detail::ValidationAccess::value(std::forward<V>(first)),
+                                  detail::ValidationAccess::value(std::forward<Vs>(rest))...));
+  }
+
+  detail::ErrArena<E> errors;
+  errors.append(detail::ValidationAccess::errors(std::forward<V>(first)));
+  (errors.append(detail::ValidationAccess::errors(std::forward<Vs>(rest))), ...);
+  return detail::ValidationAccess::invalid<U, E>(std::move(errors));
+}
+
+} // namespace tmn;
+
+#endif // TMN_THROWLESS_VALIDATION_HPP
@@ -0,0 +1,71 @@
+#ifndef TMN_THROWLESS_BATCH_TRAITS_HPP
+#define TMN_THROWLESS_BATCH_TRAITS_HPP
+
+#include <bit> // for: bit_cast;
+#include <ranges> // for: range_value_t;
+#include <cstdint> // for: uint8_t, uint16_t, uint32_t, uint64_t;
+#include <concepts> // for: same_as;
+#include <type_traits> // for: is_arithmetic_v, conditional_t, remove_cv_t;
+
+#include "../../include/Option/Option.hpp"
+#include "../../include/Result/Result.hpp"
+
+namespace tmn::batch::detail {
+
+// Payloads handled by the branch-free kernels: every bit pattern is a value, so the storage
+// of None / Err may be read and discarded; bool is excluded (`bool + bool` is int),
+// long double does not fit the 64-bit masks;
+template <typename T>
+concept BatchArithmetic = std::is_arithmetic_v<T> && !std::same_as<T, bool> && sizeof(T) <= 8;
+
+// Payload of the elements of an array of Option<T> (void for other arrays):
+template <typename Elem>
+struct OptionPayload {
+  using type = void;
+};
+
+template <typename T>
+struct OptionPayload<Option<T>> {
+  using type = T;
+};
+
+template <typename Range>
+using option_payload_t = typename OptionPayload<std::remove_cv_t<std::ranges::range_value_t<Range>>>::type;
+
+// Value and error types of the elements of an array of Result<T, E> (void for other arrays):
+template <typename Elem>
+struct ResultPayload {
+  using value_type = void;
+  using error_type = void;
+};
+
+template <typename T, typename E>
+struct ResultPayload<Result<T, E>> {
+  using value_type = T;
+  using error_type = E;
+};
+
+template <typename Range>
+using result_payload_t = ResultPayload<std::remove_cv_t<std::ranges::range_value_t<Range>>>;
+
+// Unsigned integer of the same size as T (for the bit operations on the values):
+template <typename T>
+using same_size_bits_t = std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                         std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                         std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+// `keep ? value : fallback` computed with a mask instead of a select: compilers turn
+// the select of loaded values back into a branch, the mask keeps the loop branch-free;
+// values of None are replaced by the neutral `fallback` before they are used: the garbage
+// of their storage must not overflow, trap or hit slow paths of the FPU (NaN, denormals):
+template <typename T>
+T select_bits(bool keep, T value, T fallback) noexcept {
+  using Bits = same_size_bits_t<T>;
+  const Bits mask = static_cast<Bits>(-static_cast<Bits>(keep));
+  const Bits bits = static_cast<Bits>((std::bit_cast<Bits>(value) & mask) | (std::bit_cast<Bits>(fallback) & ~mask));
+  return std::bit_cast<T>(bits);
+}
+
+} // namespace tmn::batch::detail;
+
+#endif // TMN_THROWLESS_BATCH_TRAITS_HPP
@@ -0,0 +1,171 @@
+#ifndef TMN_THROWLESS_PARALLEL_CHUNKS_HPP
+#define TMN_THROWLESS_PARALLEL_CHUNKS_HPP
+
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <cstddef> // for: size_t;
+#include <algorithm> // for: min, max;
+
+namespace tmn::batch {
+
+// Parallel batch operations: the input is cut into chunks of `grain` elements
+// (the last one may be shorter), at most `threads` threads (the caller included)
+// take the chunks one by one; 0 threads = std::thread::hardware_concurrency();
+// the chunks do not depend on the number of threads, so the partial results
+// (and the rounding of floating-point sums) are the same for any `threads`;
+struct ParallelConfig {
+  std::size_t threads = 0;
+  std::size_t grain = 16384;
+};
+
+} // namespace tmn::batch;
+
+namespace tmn::detail {
+
+inline std::size_t thread_count(const batch::ParallelConfig& config) noexcept {
+  if (config.threads != 0) return config.threads;
+  return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+inline std::size_t chunk_count(std::size_t count, const batch::ParallelConfig& config) noexcept {
+  const std::size_t grain = std::max<std::size_t>(config.grain, 1);
+  return (count + grain - 1) / grain;
+}
+
+// Process-wide worker threads of the batch operations: started on the first parallel
+// call (and when a call asks for more threads than there are), then kept for the life
+// of the process, so a call costs a wake-up instead of thread creation;
+// a call queues one ticket per wanted helper and runs the chunks itself too; when it
+// has no chunks left, it withdraws the tickets no worker has taken yet and waits only
+// for the workers that run its job: busy workers (concurrent or nested calls) never
+// block a caller, it does the work alone in the worst case;
+class ChunkWorkers {
+public: //* substructures:
+  struct Job {
+    void (*run)(const void* worker) noexcept;
+    const void* worker;
+    std::size_t running = 0; // workers inside `run`, guarded by the mutex of the pool;
+  };
+
+private: //* fields:
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  std::deque<Job*> tickets_;
+  bool stopping_ = false;
+  // declared last: joined (by ~jthread) before the other fields are destroyed;
+  std::vector<std::jthread> threads_;
+
+public: //* methods:
+  static ChunkWorkers& instance() {
+    static ChunkWorkers workers;
+    return workers;
+  }
+
+  ~ChunkWorkers() {
+    {
+      const std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+  }
+
+  std::size_t size() {
+    const std::lock_guard lock(mutex_);
+    return threads_.size();
+  }
+
+  // Runs `job` on the caller and on up to `helpers` workers, returns when none of them runs it:
+  void run(Job& job, std::size_t helpers) {
+    {
+      const std::lock_guard lock(mutex_);
+      while (threads_.size() < helpers) threads_.emplace_back([this] { serve(); });
+      tickets_.insert(tickets_.end(), helpers, &job);
+    }
+    if (helpers == 1) wake_.notify_one();
+    else wake_.notify_all();
+
+    job.run(job.worker);
+
+    std::unique_lock lock(mutex_);
+    std::erase(tickets_, &job);
+    done_.wait(lock, [&] { return job.running == 0; });
+  }
+
+private: //* methods:
+  void serve() {
+    std::unique_lock lock(mutex_);
+    for (;;) {
+      wake_.wait(lock, [this] { return stopping_ || !tickets_.empty(); });
+      if (stopping_) return;
+
+      Job* job = tickets_.front();
+      tickets_.pop_front();
+      ++job->running;
+      lock.unlock();
+      job->run(job->worker);
+      lock.lock();
+      // the caller may destroy the job as soon as it sees 0 (under the mutex):
+      if (--job->running == 0) done_.notify_all();
+    }
+  }
+};
+
+// Calls `body(chunk, first, last)` once for every chunk [first, last), from the caller
+// and up to min(threads, chunks) - 1 workers of ChunkWorkers; returns when all chunks are done;
+// the body must not throw (it runs on the worker threads);
+template <typename Body>
+void run_chunks(std::size_t count, const batch::ParallelConfig& config, const Body& body) {
+  const std::size_t grain = std::max<std::size_t>(config.grain, 1);
+  const std::size_t chunks = chunk_count(count, config);
+  std::atomic<std::size_t> next_chunk{0};
+
+  const auto worker = [&]() noexcept {
+    for (std::size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed); chunk < chunks;
+         chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+      body(chunk, chunk * grain, std::min(count, (chunk + 1) * grain));
+    }
+  };
+
+  const std::size_t threads = std::min(thread_count(config), chunks);
+  if (threads <= 1) {
+    worker();
+    return;
+  }
+
+  using Worker = decltype(worker);
+  ChunkWorkers::Job job{[](const void* w) noexcept { (*static_cast<const Worker*>(w))(); }, &worker};
+  ChunkWorkers::instance().run(job, threads - 1);
+}
+
+// Index of the first failed element (None, Err) seen by any thread: the threads skip
+// everything after it, so the work stops early and the failure reported at the end
+// is the one with the lowest index, whatever the order the chunks were run in;
+class FirstFailure {
+public: //* fields:
+  static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+private: //* fields:
+  std::atomic<std::size_t> index_{none};
+
+public: //* methods:
+  void record(std::size_t index) noexcept {
+    std::size_t current = index_.load(std::memory_order_relaxed);
+    while (index < current && !index_.compare_exchange_weak(current, index, std::memory_order_relaxed)) {}
+  }
+
+  // True if elements from `index` on can no longer change the outcome:
+  bool is_after(std::size_t index) const noexcept { return index > index_.load(std::memory_order_relaxed); }
+
+  bool failed() const noexcept { return index_.load(std::memory_order_relaxed) != none; }
+  std::size_t index() const noexcept { return index_.load(std::memory_order_relaxed); }
+};
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_PARALLEL_CHUNKS_HPP
@@ -0,0 +1,106 @@
+#ifndef TMN_THROWLESS_SIMD_DISPATCH_HPP
+#define TMN_THROWLESS_SIMD_DISPATCH_HPP
+
+#include <atomic>
+#include <cstdint> // for: uint8_t;
+
+// Runtime dispatch of the batch kernels: the same (always inlined) loop is compiled
+// for AVX-512, AVX2 and the baseline ISA, the variant is selected by the CPU at the first call;
+// only x86 with GCC / Clang has the extra variants, other targets use the baseline loop;
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TMN_THROWLESS_SIMD_DISPATCH
+#define TMN_THROWLESS_TARGET_AVX2 gnu::target("avx2,bmi2,popcnt"), gnu::noinline
+#define TMN_THROWLESS_TARGET_AVX512 gnu::target("avx512f,avx512vl,avx512bw,avx512dq,bmi2,popcnt"), gnu::noinline
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TMN_THROWLESS_KERNEL_INLINE gnu::always_inline
+#else
+#define TMN_THROWLESS_KERNEL_INLINE
+#endif
+
+namespace tmn::batch {
+
+enum class SimdLevel : std::uint8_t {
+  Scalar,
+  Avx2,
+  Avx512
+};
+
+} // namespace tmn::batch;
+
+namespace tmn::detail {
+
+inline batch::SimdLevel detect_simd_level() noexcept {
+#ifdef TMN_THROWLESS_SIMD_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") &&
+      __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq")) {
+    return batch::SimdLevel::Avx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return batch::SimdLevel::Avx2;
+  }
+#endif
+  return batch::SimdLevel::Scalar;
+}
+
+inline batch::SimdLevel supported_simd_level() noexcept {
+  static const batch::SimdLevel level = detect_simd_level();
+  return level;
+}
+
+inline std::atomic<batch::SimdLevel> active_simd_level{supported_simd_level()};
+
+// Kernel: struct with `static R run(Args...)` marked TMN_THROWLESS_KERNEL_INLINE,
+// so its body is compiled with the target of every wrapper below; a kernel written
+// with intrinsics provides `run_avx512(Args...)` itself (intrinsics need the target
+// attribute on the function that uses them), it is called instead of the compiled loop;
+template <typename Kernel, typename... Args>
+concept HasAvx512Variant = requires(Args... args) { Kernel::run_avx512(args...); };
+
+#ifdef TMN_THROWLESS_SIMD_DISPATCH
+template <typename Kernel, typename... Args>
+[[TMN_THROWLESS_TARGET_AVX512]] auto run_avx512(Args... args) noexcept { return Kernel::run(args...); }
+
+template <typename Kernel, typename... Args>
+[[TMN_THROWLESS_TARGET_AVX2]] auto run_avx2(Args... args) noexcept { return Kernel::run(args...); }
+#endif
+
+template <typename Kernel, typename... Args>
+auto dispatch_simd(Args... args) noexcept {
+#ifdef TMN_THROWLESS_SIMD_DISPATCH
+  switch (active_simd_level.load(std::memory_order_relaxed)) {
+    case batch::SimdLevel::Avx512:
+      if constexpr (HasAvx512Variant<Kernel, Args...>) return Kernel::run_avx512(args...);
+      else return run_avx512<Kernel>(args...);
+    case batch::SimdLevel::Avx2:
+      return run_avx2<Kernel>(args...);
+    case batch::SimdLevel::Scalar:
+      break;
+  }
+#endif
+  return Kernel::run(args...);
+}
+
+} // namespace tmn::detail;
+
+namespace tmn::batch {
+
+// Best level supported by the CPU:
+inline SimdLevel supported_simd_level() noexcept { return detail::supported_simd_level(); }
+
+// Level used by the kernels (for benchmarks and tests of the fallback): a level above
+// the supported one is clamped to it; returns the previous level:
+inline SimdLevel set_simd_level(SimdLevel level) noexcept {
+  if (static_cast<std::uint8_t>(level) > static_cast<std::uint8_t>(supported_simd_level())) {
+    level = supported_simd_level();
+  }
+  return detail::active_simd_level.exchange(level, std::memory_order_relaxed);
+}
+
+inline SimdLevel simd_level() noexcept { return detail::active_simd_level.load(std::memory_order_relaxed); }
+
+} // namespace tmn::batch;
+
+#endif // TMN_THROWLESS_SIMD_DISPATCH_HPP
@@ -8,11 +8,13 @@ namespace tmn::err {
 
 //*   <--- Concepts for objects, methods, constraints --->
 
+// References are accepted as well: wrappers store them as (rebindable) pointers,
+// so the wrapper itself is always copyable and moveable:
 template <typename T>
-concept CopyableOrVoid = std::same_as<T, void> || (std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>);
+concept CopyableOrVoid = std::same_as<T, void> || std::is_reference_v<T> || (std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>);
 
 template <typename T>
-concept MoveableOrVoid = std::same_as<T, void> || (std::is_move_constructible_v<T> && std::is_move_assignable_v<T>);
+concept MoveableOrVoid = std::same_as<T, void> || std::is_reference_v<T> || (std::is_move_constructible_v<T> && std::is_move_assignable_v<T>);
 
 } // namespace tmn::err;
 
@@ -0,0 +1,84 @@
+#ifndef TMN_THROWLESS_ERROR_SET_HPP
+#define TMN_THROWLESS_ERROR_SET_HPP
+
+#include <concepts> // for: same_as;
+#include <type_traits> // for: conditional_t;
+
+// Type-level operations on sets of error types (no dependencies on Option / Result,
+// so that Result can name the widened error type before OneOf is defined);
+
+namespace tmn::err {
+
+template <typename... Es>
+class OneOf;
+
+namespace detail {
+
+// List of error types (not to be confused with the error container err::ErrList<E>):
+template <typename... Es>
+struct TypeList {};
+
+template <typename E, typename... Es>
+inline constexpr bool contains_v = (std::same_as<E, Es> || ...);
+
+// Appends E to the list if it is not there yet:
+template <typename List, typename E>
+struct AppendUnique;
+
+template <typename... Es, typename E>
+struct AppendUnique<TypeList<Es...>, E> {
+  using type = std::conditional_t<contains_v<E, Es...>, TypeList<Es...>, TypeList<Es..., E>>;
+};
+
+template <typename List, typename... Es>
+struct MergeUnique { using type = List; };
+
+template <typename List, typename E, typename... Rest>
+struct MergeUnique<List, E, Rest...> {
+  using type = typename MergeUnique<typename AppendUnique<List, E>::type, Rest...>::type;
+};
+
+// Alternatives of the error: OneOf<Es...> -> Es..., any other error -> itself;
+template <typename E>
+struct Alternatives { using type = TypeList<E>; };
+
+template <typename... Es>
+struct Alternatives<OneOf<Es...>> { using type = TypeList<Es...>; };
+
+template <typename List1, typename List2>
+struct Union;
+
+template <typename... Es, typename... Fs>
+struct Union<TypeList<Es...>, TypeList<Fs...>> {
+  using type = typename MergeUnique<TypeList<>, Es..., Fs...>::type;
+};
+
+template <typename List>
+struct FromList;
+
+template <typename E>
+struct FromList<TypeList<E>> { using type = E; };
+
+template <typename... Es> requires (sizeof...(Es) > 1)
+struct FromList<TypeList<Es...>> { using type = OneOf<Es...>; };
+
+template <typename List>
+struct AllUnique;
+
+template <typename... Es>
+struct AllUnique<TypeList<Es...>> {
+  static constexpr bool value = std::same_as<typename MergeUnique<TypeList<>, Es...>::type, TypeList<Es...>>;
+};
+
+} // namespace tmn::err::detail;
+
+// Error type that can hold errors of both E1 and E2 (used by Result::and_then):
+// widen_t<E, E> = E; widen_t<A, B> = OneOf<A, B>; widen_t<OneOf<A, B>, C> = OneOf<A, B, C>;
+template <typename E1, typename E2>
+using widen_t = typename detail::FromList<
+  typename detail::Union<typename detail::Alternatives<E1>::type, typename detail::Alternatives<E2>::type>::type
+>::type;
+
+} // namespace tmn::err;
+
+#endif // TMN_THROWLESS_ERROR_SET_HPP
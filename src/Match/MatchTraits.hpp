@@ -0,0 +1,284 @@
+#ifndef TMN_THROWLESS_MATCH_TRAITS_HPP
+#define TMN_THROWLESS_MATCH_TRAITS_HPP
+
+#include <tuple> // for: tuple_size_v, tuple_element_t, get;
+#include <algorithm> // for: min;
+#include <cstddef> // for: size_t;
+#include <utility> // for: move, forward;
+#include <concepts> // for: same_as, derived_from;
+#include <functional> // for: invoke;
+#include <type_traits> // for: conditional_t, common_type_t, is_invocable_v;
+
+#include "../../include/Option/Option.hpp"
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Error/ErasedErr.hpp"
+#include "../../include/Error/OneOf.hpp"
+
+namespace tmn {
+
+//*   <--- arms of the error match: handler<E>(fn), otherwise(fn) --->
+
+template <typename E, typename Fn>
+struct Handler {
+  using error_type = E;
+  Fn fn;
+};
+
+template <typename Fn>
+struct Otherwise {
+  Fn fn;
+};
+
+namespace detail {
+
+//*   <--- classification of the matched types --->
+
+template <typename O>
+struct OptionTraits { static constexpr bool is_option = false; };
+
+template <typename T>
+struct OptionTraits<Option<T>> {
+  static constexpr bool is_option = true;
+  using value_type = T;
+};
+
+template <typename R>
+struct ResultTraits { static constexpr bool is_result = false; };
+
+template <typename T, typename E>
+struct ResultTraits<Result<T, E>> {
+  static constexpr bool is_result = true;
+  using value_type = T;
+  using error_type = E;
+};
+
+template <typename E>
+inline constexpr bool is_one_of_v = false;
+
+template <typename... Es>
+inline constexpr bool is_one_of_v<err::OneOf<Es...>> = true;
+
+template <typename C>
+inline constexpr bool is_handler_v = false;
+
+template <typename E, typename Fn>
+inline constexpr bool is_handler_v<Handler<E, Fn>> = true;
+
+template <typename C>
+inline constexpr bool is_otherwise_v = false;
+
+template <typename Fn>
+inline constexpr bool is_otherwise_v<Otherwise<Fn>> = true;
+
+template <typename C>
+inline constexpr bool is_match_arm_v = is_handler_v<C> || is_otherwise_v<C>;
+
+// Dynamic type of the error is known only at runtime (checked through ErrTypeInfo):
+template <typename S>
+inline constexpr bool is_polymorphic_err_v = std::same_as<S, err::ErasedErr> || std::derived_from<S, err::AnyErr>;
+
+//*   <--- forwarding of payloads without copies --->
+
+// Qualifiers of the source applied to another type: (const Src&, T) -> const T&, (Src&&, T) -> T&&:
+template <typename Src, typename T>
+using forward_like_t = std::conditional_t<
+  std::is_lvalue_reference_v<Src>,
+  std::conditional_t<std::is_const_v<std::remove_reference_t<Src>>, const T&, T&>,
+  std::conditional_t<std::is_const_v<std::remove_reference_t<Src>>, const T&&, T&&>
+>;
+
+// Value of Option / Result: reference to the stored object, moved from rvalues
+// (Option<T&> / Result<T&, E> always give T&):
+template <typename Opt>
+decltype(auto) some_payload(Opt&& opt) {
+  if constexpr (std::is_lvalue_reference_v<Opt> || std::is_reference_v<typename OptionTraits<std::remove_cvref_t<Opt>>::value_type>) {
+    return opt.value_unchecked();
+  }
+  else {
+    return std::move(opt.value_unchecked());
+  }
+}
+
+template <typename Res>
+decltype(auto) ok_payload(Res&& res) {
+  if constexpr (std::is_lvalue_reference_v<Res> || std::is_reference_v<typename ResultTraits<std::remove_cvref_t<Res>>::value_type>) {
+    return res.unwrap_unchecked();
+  }
+  else {
+    return std::move(res.unwrap_unchecked());
+  }
+}
+
+template <typename Res>
+decltype(auto) err_payload(Res&& res) {
+  if constexpr (std::is_lvalue_reference_v<Res>) {
+    return res.unwrap_err_unchecked();
+  }
+  else {
+    return std::move(res.unwrap_err_unchecked());
+  }
+}
+
+//*   <--- invocation of the arms --->
+
+// Arms of the error match may ignore the error (take no arguments):
+template <typename Fn, typename Arg>
+decltype(auto) invoke_arm(Fn& fn, Arg&& arg) {
+  if constexpr (std::is_invocable_v<Fn&, Arg&&>) {
+    return std::invoke(fn, std::forward<Arg>(arg));
+  }
+  else {
+    return std::invoke(fn);
+  }
+}
+
+template <typename Fn, typename Arg>
+using arm_result_t = decltype(invoke_arm(std::declval<Fn&>(), std::declval<Arg>()));
+
+// Result of the match: the exact type if all arms agree (references are kept),
+// the common type otherwise;
+template <typename R, typename... Rs>
+struct MatchResult {
+  using type = std::conditional_t<(std::same_as<R, Rs> && ...), R, std::common_type_t<R, Rs...>>;
+};
+
+template <typename... Rs>
+using match_result_t = typename MatchResult<Rs...>::type;
+
+// Error passed to the arm: handler<E> gets E with the qualifiers of the matched error,
+// otherwise(...) gets the matched error itself;
+template <typename Arm, typename Err>
+struct ArmArg { using type = Err&&; };
+
+template <typename E, typename Fn, typename Err>
+struct ArmArg<Handler<E, Fn>, Err> { using type = forward_like_t<Err&&, E>; };
+
+template <typename Arm, typename Err>
+using arm_arg_t = typename ArmArg<std::remove_cv_t<Arm>, Err>::type;
+
+template <typename Arm, typename Err>
+using error_arm_result_t = arm_result_t<decltype(std::declval<Arm&>().fn), arm_arg_t<Arm, Err>>;
+
+//*   <--- static dispatch: the type of the error is known at compile time --->
+
+template <typename Arm, typename Alt>
+inline constexpr bool statically_handles = true; // otherwise(...);
+
+template <typename E, typename Fn, typename Alt>
+inline constexpr bool statically_handles<Handler<E, Fn>, Alt> = std::same_as<Alt, E> || std::derived_from<Alt, E>;
+
+// Index of the first arm that handles Alt (number of arms if there is none):
+template <typename Alt, typename... Arms>
+constexpr std::size_t static_arm_index() {
+  constexpr bool handles[] = {statically_handles<std::remove_cv_t<Arms>, Alt>...};
+  for (std::size_t i = 0; i < sizeof...(Arms); ++i) {
+    if (handles[i]) return i;
+  }
+  return sizeof...(Arms);
+}
+
+// (the last arm if none handles Err: the static_assert of `dispatch_static` reports it)
+template <typename Err, typename... Arms>
+using static_arm_t = std::tuple_element_t<
+  std::min(static_arm_index<std::remove_cvref_t<Err>, Arms...>(), sizeof...(Arms) - 1),
+  std::tuple<Arms...>
+>;
+
+template <typename R, typename Alt, typename... Arms>
+R dispatch_static(Alt&& alt, std::tuple<Arms&...>& arms) {
+  constexpr std::size_t index = static_arm_index<std::remove_cvref_t<Alt>, Arms...>();
+  static_assert(index < sizeof...(Arms), "match is not exhaustive: add handler<E>(...) for the error or otherwise(...)");
+
+  auto& arm = std::get<index>(arms);
+  return invoke_arm(arm.fn, static_cast<arm_arg_t<std::remove_cvref_t<decltype(arm)>, Alt>>(alt));
+}
+
+// Result type over all alternatives of OneOf:
+template <typename Err, typename OneOfErr, typename... Arms>
+struct OneOfMatchResult;
+
+template <typename Err, typename... Es, typename... Arms>
+struct OneOfMatchResult<Err, err::OneOf<Es...>, Arms...> {
+  using type = match_result_t<
+    error_arm_result_t<static_arm_t<Es, Arms...>, forward_like_t<Err&&, Es>>...
+  >;
+};
+
+//*   <--- dynamic dispatch: base reference (AnyErr) or ErasedErr --->
+
+// Handler<E> can match the error only at runtime:
+template <typename E, typename S>
+constexpr bool dynamically_handles() {
+  if constexpr (std::same_as<S, err::ErasedErr>) {
+    return !std::same_as<E, err::ErasedErr>; // ErasedErr keeps the exact type: checked by identity;
+  }
+  else {
+    return std::derived_from<E, S> && !std::same_as<E, S>;
+  }
+}
+
+template <typename E, typename S>
+bool dynamic_type_is(const err::ErrTypeInfo* info) noexcept {
+  if constexpr (std::same_as<S, err::ErasedErr>) {
+    return info == &err::err_type_info<E>;
+  }
+  else {
+    return info->is_a(err::err_type_info<E>);
+  }
+}
+
+template <typename E, typename Err>
+forward_like_t<Err&&, E> dynamic_target(Err&& error) {
+  if constexpr (std::same_as<std::remove_cvref_t<Err>, err::ErasedErr>) {
+    return static_cast<forward_like_t<Err&&, E>>(error.template downcast<E>().value());
+  }
+  else {
+    return static_cast<forward_like_t<Err&&, E>>(error);
+  }
+}
+
+// Arms are checked in order (as an if / else-if chain), the type record is read once:
+template <typename R, std::size_t I, typename Err, typename... Arms>
+R dispatch_dynamic(Err&& error, const err::ErrTypeInfo* info, std::tuple<Arms&...>& arms) {
+  static_assert(I < sizeof...(Arms), "match over a polymorphic error needs otherwise(...) or a handler of its static type");
+
+  using S = std::remove_cvref_t<Err>;
+  using Arm = std::remove_cvref_t<std::tuple_element_t<I, std::tuple<Arms...>>>;
+  auto& arm = std::get<I>(arms);
+
+  if constexpr (is_otherwise_v<Arm>) {
+    return invoke_arm(arm.fn, std::forward<Err>(error));
+  }
+  else {
+    using E = typename Arm::error_type;
+    if constexpr (statically_handles<Arm, S>) {
+      return invoke_arm(arm.fn, static_cast<forward_like_t<Err&&, E>>(error));
+    }
+    else if constexpr (dynamically_handles<E, S>()) {
+      if (info != nullptr && dynamic_type_is<E, S>(info)) {
+        return invoke_arm(arm.fn, dynamic_target<E>(std::forward<Err>(error)));
+      }
+      return dispatch_dynamic<R, I + 1>(std::forward<Err>(error), info, arms);
+    }
+    else { // the arm can never match the error:
+      return dispatch_dynamic<R, I + 1>(std::forward<Err>(error), info, arms);
+    }
+  }
+}
+
+template <typename S>
+const err::ErrTypeInfo* dynamic_type_info(const S& error) noexcept {
+  if constexpr (std::same_as<S, err::ErasedErr>) {
+    return error.type_info();
+  }
+  else {
+    return &error.type_info();
+  }
+}
+
+} // namespace tmn::detail;
+
+} // namespace tmn;
+
+#endif // TMN_THROWLESS_MATCH_TRAITS_HPP
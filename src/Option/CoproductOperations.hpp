@@ -5,9 +5,11 @@ of the Option class and is not intended for use"
 #endif
 
 #include <utility> // for: declval;
-#include <type_traits> // for: is_integral_v;
+#include <concepts> // for: integral, same_as;
+#include <type_traits> // for: is_integral_v, is_signed_v, is_unsigned_v, common_type_t, conditional_t, make_signed_t, make_unsigned_t;
 
 #include "../../include/Option/Option.hpp"
+#include "Overflow.hpp" // for: add_overflow, sub_overflow, mul_overflow;
 
 namespace tmn {
 
@@ -19,7 +21,7 @@ auto operator+(const Option<T>& lhs, const Option<U>& rhs)
 {
   if (lhs.has_value() && rhs.has_value()) {
     return Option<decltype(std::declval<T>() + std::declval<U>())>(
-      lhs.value() + rhs.value()
+      lhs.value_unchecked() + rhs.value_unchecked()
     );
   }
   return Option<decltype(std::declval<T>() + std::declval<U>())>();
@@ -32,7 +34,7 @@ auto operator-(const Option<T>& lhs, const Option<U>& rhs)
 {
   if (lhs.has_value() && rhs.has_value()) {
     return Option<decltype(std::declval<T>() - std::declval<U>())>(
-      lhs.value() - rhs.value()
+      lhs.value_unchecked() - rhs.value_unchecked()
     );
   }
   return Option<decltype(std::declval<T>() - std::declval<U>())>();
@@ -45,7 +47,7 @@ auto operator*(const Option<T>& lhs, const Option<U>& rhs)
 {
   if (lhs.has_value() && rhs.has_value()) {
     return Option<decltype(std::declval<T>() * std::declval<U>())>(
-      lhs.value() * rhs.value()
+      lhs.value_unchecked() * rhs.value_unchecked()
     );
   }
   return Option<decltype(std::declval<T>() * std::declval<U>())>();
@@ -58,13 +60,98 @@ auto operator/(const Option<T>& lhs, const Option<U>& rhs)
 {
   if (lhs.has_value() && rhs.has_value()) {
     if constexpr (std::is_integral_v<T> && std::is_integral_v<U>) {
-      if (rhs.value() == 0) return Option<decltype(std::declval<T>() / std::declval<U>())>();
+      if (rhs.value_unchecked() == 0) return Option<decltype(std::declval<T>() / std::declval<U>())>();
     }
     return Option<decltype(std::declval<T>() / std::declval<U>())>(
-      lhs.value() / rhs.value()
+      lhs.value_unchecked() / rhs.value_unchecked()
     );
   }
   return Option<decltype(std::declval<T>() / std::declval<U>())>();
 }
 
+//*   <--- overflow-checked integer arithmetic --->
+
+// The operators above wrap (or, for signed integers, overflow with undefined behaviour);
+// checked_add / checked_sub / checked_mul / checked_div give None instead when the exact
+// result does not fit the result type, which is the type of the usual arithmetic conversions
+// without the promotion to int (detail::checked_result_t): Option<int64_t> for int64_t and
+// int32_t, Option<int16_t> for int8_t and int16_t, Option<uint8_t> for uint8_t and int8_t:
+//   Option<int64_t> total = checked_add(subtotal, checked_mul(price, quantity));
+// division also gives None for a zero divisor and for MIN / -1;
+// the checks are the compiler intrinsics (__builtin_add_overflow, ...) where they exist:
+// a flag test after the operation, no branch on the values (see src/Option/Overflow.hpp);
+template <typename T>
+concept CheckedInteger = std::integral<T> && !std::same_as<T, bool>;
+
+namespace detail {
+
+// Types of int and wider: the usual arithmetic conversions (std::common_type);
+template <typename T, typename U>
+struct CheckedResult {
+  using type = std::common_type_t<T, U>;
+};
+
+// Both narrower than int: the same rules without the promotion (std::common_type_t
+// of int8_t and int16_t is int): the wider type, unsigned for types of the same width;
+template <typename T, typename U> requires (sizeof(T) < sizeof(int) && sizeof(U) < sizeof(int))
+struct CheckedResult<T, U> {
+  using type = std::conditional_t<(sizeof(T) > sizeof(U)), T,
+               std::conditional_t<(sizeof(U) > sizeof(T)), U,
+               std::conditional_t<std::same_as<T, U>, T,
+               std::conditional_t<(std::is_unsigned_v<T> || std::is_unsigned_v<U>), std::make_unsigned_t<T>, std::make_signed_t<T>>>>>;
+};
+
+template <typename T, typename U>
+using checked_result_t = typename CheckedResult<T, U>::type;
+
+} // namespace tmn::detail;
+
+template <CheckedInteger T, CheckedInteger U>
+Option<detail::checked_result_t<T, U>> checked_add(const Option<T>& lhs, const Option<U>& rhs) noexcept {
+  detail::checked_result_t<T, U> result;
+  if (!lhs.has_value() || !rhs.has_value() || detail::add_overflow(lhs.value_unchecked(), rhs.value_unchecked(), &result)) {
+    return Option<detail::checked_result_t<T, U>>();
+  }
+  return Option<detail::checked_result_t<T, U>>(result);
+}
+
+template <CheckedInteger T, CheckedInteger U>
+Option<detail::checked_result_t<T, U>> checked_sub(const Option<T>& lhs, const Option<U>& rhs) noexcept {
+  detail::checked_result_t<T, U> result;
+  if (!lhs.has_value() || !rhs.has_value() || detail::sub_overflow(lhs.value_unchecked(), rhs.value_unchecked(), &result)) {
+    return Option<detail::checked_result_t<T, U>>();
+  }
+  return Option<detail::checked_result_t<T, U>>(result);
+}
+
+template <CheckedInteger T, CheckedInteger U>
+Option<detail::checked_result_t<T, U>> checked_mul(const Option<T>& lhs, const Option<U>& rhs) noexcept {
+  detail::checked_result_t<T, U> result;
+  if (!lhs.has_value() || !rhs.has_value() || detail::mul_overflow(lhs.value_unchecked(), rhs.value_unchecked(), &result)) {
+    return Option<detail::checked_result_t<T, U>>();
+  }
+  return Option<detail::checked_result_t<T, U>>(result);
+}
+
+template <CheckedInteger T, CheckedInteger U>
+Option<detail::checked_result_t<T, U>> checked_div(const Option<T>& lhs, const Option<U>& rhs) noexcept {
+  using R = detail::checked_result_t<T, U>;
+  R dividend;
+  R divisor;
+  // the operands converted to R (the conversion itself may not fit, e.g. -1 into unsigned):
+  if (!lhs.has_value() || !rhs.has_value() ||
+      detail::add_overflow(lhs.value_unchecked(), 0, &dividend) || detail::add_overflow(rhs.value_unchecked(), 0, &divisor)) {
+    return Option<R>();
+  }
+  if (divisor == 0) return Option<R>();
+  if constexpr (std::is_signed_v<R>) {
+    if (divisor == -1) {
+      R negated;
+      if (detail::sub_overflow(R{0}, dividend, &negated)) return Option<R>();
+      return Option<R>(negated);
+    }
+  }
+  return Option<R>(static_cast<R>(dividend / divisor));
+}
+
 } // namespace tmn;
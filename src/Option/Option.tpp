@@ -3,11 +3,11 @@
 #endif
 
 #include <utility> // for: move, swap;
-#include <optional> // for: bad_optional_access (exception);
 #include <type_traits> // for: is_void_v;
 #include <functional> // for: function;
 
 #include "../../include/Option/Option.hpp" // for: Option declaration;
+#include "../../include/Panic/Panic.hpp" // for: fail_bad_optional_access, TMN_THROWLESS_ASSUME;
 
 namespace tmn {
 
@@ -113,16 +113,48 @@ T Option<T>::value_or_default() noexcept requires std::default_initializable<T>
 
 template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
 const T& Option<T>::value() const {
-  if (!_is_initialized) throw std::bad_optional_access();
+  if (!_is_initialized) [[unlikely]] detail::fail_bad_optional_access();
   return *reinterpret_cast<const T*>(_value);
 }
 
 template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
 T& Option<T>::value() {
-  if (!_is_initialized) throw std::bad_optional_access();
+  if (!_is_initialized) [[unlikely]] detail::fail_bad_optional_access();
   return *reinterpret_cast<T*>(_value);
 }
 
+template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
+T& Option<T>::value_unchecked() noexcept {
+  TMN_THROWLESS_ASSUME(_is_initialized, "Option: unchecked access to the value of None");
+  return *reinterpret_cast<T*>(_value);
+}
+
+template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
+const T& Option<T>::value_unchecked() const noexcept {
+  TMN_THROWLESS_ASSUME(_is_initialized, "Option: unchecked access to the value of None");
+  return *reinterpret_cast<const T*>(_value);
+}
+
+template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
+T& Option<T>::operator*() noexcept {
+  return value_unchecked();
+}
+
+template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
+const T& Option<T>::operator*() const noexcept {
+  return value_unchecked();
+}
+
+template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
+T* Option<T>::operator->() noexcept {
+  return &value_unchecked();
+}
+
+template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
+const T* Option<T>::operator->() const noexcept {
+  return &value_unchecked();
+}
+
 template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> && err::MoveableOrVoid<T>)
 bool Option<T>::destroy_value() noexcept {
   if (_is_initialized) {
@@ -137,7 +169,7 @@ template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> &&
 bool Option<T>::operator==(const Option& oth) const noexcept {
   if (_is_initialized != oth._is_initialized) return false;
   if (!_is_initialized) return true;
-  return *reinterpret_cast<T*>(_value) == *reinterpret_cast<T*>(oth._value);
+  return *reinterpret_cast<const T*>(_value) == *reinterpret_cast<const T*>(oth._value);
 }
 
 //  <--- cast to other classes --->
@@ -146,7 +178,7 @@ template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> &&
 template <typename E> requires (!std::is_void_v<T> && err::Error<E>)
 Result<T, E> Option<T>::to_result(E error_if_none) {
   if (has_value()) {
-    return Result<T, E>::Ok(value());
+    return Result<T, E>::Ok(value_unchecked());
   }
   return Result<T, E>::Err(error_if_none);
 }
@@ -207,7 +239,7 @@ template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> &&
 template <typename U> requires arithmetic::Addable<T, U>
 Option<T>& Option<T>::operator+=(const Option<U>& rhs) {
   if (has_value() && rhs.has_value()) {
-    *reinterpret_cast<T*>(_value) += rhs.value();
+    *reinterpret_cast<T*>(_value) += rhs.value_unchecked();
   }
   else {
     _is_initialized = false;
@@ -219,7 +251,7 @@ template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> &&
 template <typename U> requires arithmetic::Subtractable<T, U>
 Option<T>& Option<T>::operator-=(const Option<U>& rhs) {
   if (has_value() && rhs.has_value()) {
-    *reinterpret_cast<T*>(_value) -= rhs.value();
+    *reinterpret_cast<T*>(_value) -= rhs.value_unchecked();
   }
   else {
     _is_initialized = false;
@@ -231,7 +263,7 @@ template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> &&
 template <typename U> requires arithmetic::Multipliable<T, U>
 Option<T>& Option<T>::operator*=(const Option<U>& rhs) {
   if (has_value() && rhs.has_value()) {
-    *reinterpret_cast<T*>(_value) *= rhs.value();
+    *reinterpret_cast<T*>(_value) *= rhs.value_unchecked();
   }
   else {
     _is_initialized = false;
@@ -243,7 +275,7 @@ template <typename T> requires (!std::is_void_v<T> && err::CopyableOrVoid<T> &&
 template <typename U> requires arithmetic::Dividable<T, U>
 Option<T>& Option<T>::operator/=(const Option<U>& rhs) {
   if (has_value() && rhs.has_value()) {
-    *reinterpret_cast<T*>(_value) /= rhs.value();
+    *reinterpret_cast<T*>(_value) /= rhs.value_unchecked();
   }
   else {
     _is_initialized = false;
@@ -0,0 +1,42 @@
+#ifndef TMN_THROWLESS_OPTION_STORAGE_HPP
+#define TMN_THROWLESS_OPTION_STORAGE_HPP
+
+#include <cstring> // for: memcpy;
+#include <type_traits> // for: is_trivially_copyable_v, is_arithmetic_v;
+
+#include "../../include/Option/Option.hpp"
+
+namespace tmn::detail {
+
+// Branch-free access to Option<T> of trivially copyable types for the batch kernels:
+// the state and the bytes of the storage are read and written independently,
+// so a loop over Options compiles to selects instead of a branch per element;
+struct OptionStorage {
+  // Bytes of the storage as T, whether the Option holds a value or not: for arithmetic
+  // types every bit pattern is some value, the caller discards (or masks) it for None;
+  // the bytes are copied with memcpy, never read through a T lvalue of the storage;
+  // sanitizer-hostile by design: the storage of a default-constructed None was never
+  // written, so its bytes are indeterminate; the kernels only mask them with select_bits
+  // (an AND with a zero mask, which MemorySanitizer treats as initialized) or store them
+  // into a slot that is overwritten later, no branch depends on them, but Valgrind-like
+  // tools that report every read of uninitialized memory will flag these loads;
+  template <typename T> requires std::is_arithmetic_v<T>
+  static T load_raw(const Option<T>& opt) noexcept {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    std::memcpy(&value, opt._value, sizeof(T));
+    return value;
+  }
+
+  // Overwrites the Option with Some(value) or None; there is nothing to destroy
+  // for trivially copyable types, and the bytes of None are never read:
+  template <typename T> requires std::is_trivially_copyable_v<T>
+  static void store(Option<T>& opt, T value, bool is_some) noexcept {
+    std::memcpy(opt._value, &value, sizeof(T));
+    opt._is_initialized = is_some;
+  }
+};
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_OPTION_STORAGE_HPP
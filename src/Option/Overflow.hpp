@@ -0,0 +1,112 @@
+#ifndef TMN_THROWLESS_OVERFLOW_HPP
+#define TMN_THROWLESS_OVERFLOW_HPP
+
+#include <limits> // for: numeric_limits;
+#include <cstdint> // for: uint64_t, int64_t;
+#include <concepts> // for: integral;
+#include <type_traits> // for: is_signed_v;
+
+namespace tmn::detail {
+
+//* <--- Overflow-checked integer operations --->
+
+// `*result = lhs op rhs` wrapped to R, returns true if the exact result does not fit R
+// (the semantics of __builtin_add_overflow and friends, operands of different types included);
+// GCC / Clang use the intrinsics (a flag test after the operation), the other compilers
+// the portable versions: the exact result is computed as a sign and a 64-bit magnitude;
+
+// Exact value of an integer of up to 64 bits (an exact result out of [-2^64, 2^64] is never
+// needed: it does not fit any result type):
+struct ExactInt {
+  bool negative;
+  std::uint64_t magnitude;
+};
+
+template <std::integral T>
+constexpr ExactInt to_exact(T value) noexcept {
+  static_assert(sizeof(T) <= 8, "overflow checks of integers wider than 64 bits need the compiler intrinsics");
+  if constexpr (std::is_signed_v<T>) {
+    if (value < 0) return ExactInt{true, std::uint64_t{0} - static_cast<std::uint64_t>(value)};
+  }
+  return ExactInt{false, static_cast<std::uint64_t>(value)};
+}
+
+template <std::integral R>
+constexpr bool exact_fits(ExactInt value) noexcept {
+  constexpr auto max = static_cast<std::uint64_t>(std::numeric_limits<R>::max());
+  if (!value.negative || value.magnitude == 0) return value.magnitude <= max;
+  if constexpr (std::is_signed_v<R>) return value.magnitude - 1 <= max; // |min| = max + 1;
+  else return false;
+}
+
+// false if the magnitude of the sum reaches 2^64:
+constexpr bool exact_add(ExactInt lhs, ExactInt rhs, ExactInt& sum) noexcept {
+  if (lhs.negative == rhs.negative) {
+    sum = ExactInt{lhs.negative, lhs.magnitude + rhs.magnitude};
+    return sum.magnitude >= lhs.magnitude;
+  }
+  if (lhs.magnitude >= rhs.magnitude) sum = ExactInt{lhs.negative, lhs.magnitude - rhs.magnitude};
+  else sum = ExactInt{rhs.negative, rhs.magnitude - lhs.magnitude};
+  return true;
+}
+
+// The wrapped result: the low 64 bits of the exact result are the same as of the unsigned operation:
+template <std::integral R>
+constexpr R wrap(std::uint64_t bits) noexcept { return static_cast<R>(bits); }
+
+template <std::integral T, std::integral U, std::integral R>
+constexpr bool portable_add_overflow(T lhs, U rhs, R* result) noexcept {
+  *result = wrap<R>(static_cast<std::uint64_t>(lhs) + static_cast<std::uint64_t>(rhs));
+  ExactInt sum{};
+  return !exact_add(to_exact(lhs), to_exact(rhs), sum) || !exact_fits<R>(sum);
+}
+
+template <std::integral T, std::integral U, std::integral R>
+constexpr bool portable_sub_overflow(T lhs, U rhs, R* result) noexcept {
+  *result = wrap<R>(static_cast<std::uint64_t>(lhs) - static_cast<std::uint64_t>(rhs));
+  ExactInt negated = to_exact(rhs);
+  negated.negative = !negated.negative;
+  ExactInt difference{};
+  return !exact_add(to_exact(lhs), negated, difference) || !exact_fits<R>(difference);
+}
+
+template <std::integral T, std::integral U, std::integral R>
+constexpr bool portable_mul_overflow(T lhs, U rhs, R* result) noexcept {
+  *result = wrap<R>(static_cast<std::uint64_t>(lhs) * static_cast<std::uint64_t>(rhs));
+  const ExactInt x = to_exact(lhs);
+  const ExactInt y = to_exact(rhs);
+  const ExactInt product{x.negative != y.negative, x.magnitude * y.magnitude};
+  if (x.magnitude != 0 && product.magnitude / x.magnitude != y.magnitude) return true;
+  return !exact_fits<R>(product);
+}
+
+template <std::integral T, std::integral U, std::integral R>
+constexpr bool add_overflow(T lhs, U rhs, R* result) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(lhs, rhs, result);
+#else
+  return portable_add_overflow(lhs, rhs, result);
+#endif
+}
+
+template <std::integral T, std::integral U, std::integral R>
+constexpr bool sub_overflow(T lhs, U rhs, R* result) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_sub_overflow(lhs, rhs, result);
+#else
+  return portable_sub_overflow(lhs, rhs, result);
+#endif
+}
+
+template <std::integral T, std::integral U, std::integral R>
+constexpr bool mul_overflow(T lhs, U rhs, R* result) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(lhs, rhs, result);
+#else
+  return portable_mul_overflow(lhs, rhs, result);
+#endif
+}
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_OVERFLOW_HPP
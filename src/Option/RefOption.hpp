@@ -0,0 +1,88 @@
+#ifndef TMN_THROWLESS_OPTION_HPP
+#error "Specialization of a class must follow the declaration of the main class template"
+#endif
+
+#ifndef TMN_THROWLESS_REF_OPTION_HPP
+#define TMN_THROWLESS_REF_OPTION_HPP
+
+#include "../../include/Option/Option.hpp"
+
+namespace tmn {
+
+// Specialization for references: Option<T&> refers to an existing object
+// instead of copying it (zero-copy lookups and accessors);
+// The reference is stored as a pointer and the null pointer is used as the niche
+// for None, so sizeof(Option<T&>) == sizeof(T*) and there is no separate flag;
+// Option<T&> does not own the object: the object must outlive the Option;
+template <typename T>
+class Option<T&> {
+private: //* fields :
+  T* _ptr = nullptr;
+
+public: //* methods :
+  //*   <--- constructors, (~)ro5, destructor --->
+  Option() noexcept = default;
+  Option(T& ref) noexcept;
+
+  // Binding to temporaries would produce a dangling reference:
+  Option(std::remove_cv_t<T>&& tmp) = delete;
+
+  Option(const Option& oth) noexcept = default;
+  Option(Option&& oth) noexcept = default;
+  Option& operator=(const Option& oth) noexcept = default;
+  Option& operator=(Option&& oth) noexcept = default;
+
+  ~Option() = default;
+
+  explicit operator bool() const noexcept;
+
+  //*   <--- specialized algorithms & methods  --->
+  bool has_value() const noexcept;
+
+  T& value() const;
+
+  // Unchecked access (asserted in debug builds only):
+  T& value_unchecked() const noexcept;
+  T& operator*() const noexcept;
+  T* operator->() const noexcept;
+  T& value_or(T& val) const noexcept;
+
+  // Copy of the referred object (Option<T&> -> Option<T>):
+  Option<std::remove_cv_t<T>> cloned() const
+    noexcept(std::is_nothrow_copy_constructible_v<std::remove_cv_t<T>>)
+    requires std::copy_constructible<std::remove_cv_t<T>>;
+
+  // Options are equal if both are None or both refer to equal objects:
+  bool operator==(const Option& oth) const noexcept;
+
+  // The referred object is not destroyed: only the reference is dropped;
+  // returns `true` if Option referred to an object:
+  bool destroy_value() noexcept;
+
+  //  <--- conversions (cast) : --->
+  template <typename E> requires err::Error<E>
+  Result<T&, E> to_result(E error_if_none) const;
+
+  //*   <--- functional methods --->
+  template <typename Func> requires std::invocable<Func, T&>
+  auto fmap(Func&& fn) const
+    noexcept(std::is_nothrow_invocable_v<Func, T&>)
+    -> Option<std::invoke_result_t<Func, T&>>;
+
+  template <typename Func> requires std::invocable<Func, T&>
+  auto and_then(Func&& fn) const
+    noexcept(std::is_nothrow_invocable_v<Func, T&>)
+    -> Option<std::invoke_result_t<Func, T&>>;
+
+  template <typename Func> requires std::invocable<Func> && std::same_as<std::invoke_result_t<Func>, T&>
+  auto or_else(Func&& fn) const
+    noexcept(std::is_nothrow_invocable_v<Func>)
+    -> Option<T&>;
+
+}; // class Option<T&>;
+
+} // namespace tmn;
+
+#include "RefOption.tpp" // for: Option<T&> definition;
+
+#endif // TMN_THROWLESS_REF_OPTION_HPP
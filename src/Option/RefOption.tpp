@@ -0,0 +1,124 @@
+#ifndef TMN_THROWLESS_REF_OPTION_HPP
+#error "Definition of the class must follow the declaration of the class"
+#endif
+
+#include <memory> // for: addressof;
+
+#include "RefOption.hpp"
+#include "../../include/Panic/Panic.hpp" // for: fail_bad_optional_access, TMN_THROWLESS_ASSUME;
+
+namespace tmn {
+
+//*   <--- constructors, (~)ro5, destructor --->
+
+template <typename T>
+Option<T&>::Option(T& ref) noexcept : _ptr(std::addressof(ref)) {}
+
+template <typename T>
+Option<T&>::operator bool() const noexcept {
+  return _ptr != nullptr;
+}
+
+//*   <--- specialized algorithms & methods  --->
+
+template <typename T>
+bool Option<T&>::has_value() const noexcept {
+  return _ptr != nullptr;
+}
+
+template <typename T>
+T& Option<T&>::value() const {
+  if (!_ptr) [[unlikely]] detail::fail_bad_optional_access();
+  return *_ptr;
+}
+
+template <typename T>
+T& Option<T&>::value_unchecked() const noexcept {
+  TMN_THROWLESS_ASSUME(_ptr != nullptr, "Option: unchecked access to the value of None");
+  return *_ptr;
+}
+
+template <typename T>
+T& Option<T&>::operator*() const noexcept {
+  return value_unchecked();
+}
+
+template <typename T>
+T* Option<T&>::operator->() const noexcept {
+  return &value_unchecked();
+}
+
+template <typename T>
+T& Option<T&>::value_or(T& val) const noexcept {
+  return _ptr ? *_ptr : val;
+}
+
+template <typename T>
+Option<std::remove_cv_t<T>> Option<T&>::cloned() const
+  noexcept(std::is_nothrow_copy_constructible_v<std::remove_cv_t<T>>)
+  requires std::copy_constructible<std::remove_cv_t<T>>
+{
+  if (!_ptr) return Option<std::remove_cv_t<T>>();
+  return Option<std::remove_cv_t<T>>(*_ptr);
+}
+
+template <typename T>
+bool Option<T&>::operator==(const Option& oth) const noexcept {
+  if (has_value() != oth.has_value()) return false;
+  if (!has_value()) return true;
+  return *_ptr == *oth._ptr;
+}
+
+template <typename T>
+bool Option<T&>::destroy_value() noexcept {
+  if (_ptr) {
+    _ptr = nullptr;
+    return true;
+  }
+  return false;
+}
+
+//  <--- cast to other classes --->
+
+template <typename T>
+template <typename E> requires err::Error<E>
+Result<T&, E> Option<T&>::to_result(E error_if_none) const {
+  if (has_value()) {
+    return Result<T&, E>::Ok(*_ptr);
+  }
+  return Result<T&, E>::Err(std::move(error_if_none));
+}
+
+//*   <--- functional methods  --->
+
+template <typename T>
+template <typename Func> requires std::invocable<Func, T&>
+auto Option<T&>::fmap(Func&& fn) const
+  noexcept(std::is_nothrow_invocable_v<Func, T&>)
+  -> Option<std::invoke_result_t<Func, T&>>
+{
+  if (!_ptr) return Option<std::invoke_result_t<Func, T&>>{};
+  return Option<std::invoke_result_t<Func, T&>>(std::forward<Func>(fn)(*_ptr));
+}
+
+template <typename T>
+template <typename Func> requires std::invocable<Func, T&>
+auto Option<T&>::and_then(Func&& fn) const
+  noexcept(std::is_nothrow_invocable_v<Func, T&>)
+  -> Option<std::invoke_result_t<Func, T&>>
+{
+  if (!_ptr) return Option<std::invoke_result_t<Func, T&>>{};
+  return Option<std::invoke_result_t<Func, T&>>(std::forward<Func>(fn)(*_ptr));
+}
+
+template <typename T>
+template <typename Func> requires std::invocable<Func> && std::same_as<std::invoke_result_t<Func>, T&>
+auto Option<T&>::or_else(Func&& fn) const
+  noexcept(std::is_nothrow_invocable_v<Func>)
+  -> Option<T&>
+{
+  if (_ptr) return *this;
+  return Option<T&>(std::forward<Func>(fn)());
+}
+
+} // namespace tmn;
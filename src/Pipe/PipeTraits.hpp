@@ -0,0 +1,120 @@
+#ifndef TMN_THROWLESS_PIPE_TRAITS_HPP
+#define TMN_THROWLESS_PIPE_TRAITS_HPP
+
+#include <type_traits> // for: invoke_result_t, remove_cvref_t, conditional_t, is_reference_v, type_identity;
+
+#include "../Match/MatchTraits.hpp" // for: OptionTraits, ResultTraits, payload forwarding;
+#include "../Error/ErrorSet.hpp" // for: widen_t;
+
+namespace tmn::pipe {
+
+//*   <--- stages of a pipeline --->
+
+template <typename Fn>
+struct FmapStage {
+  Fn fn;
+};
+
+template <typename Fn>
+struct AndThenStage {
+  Fn fn;
+};
+
+struct EvalStage {};
+
+} // namespace tmn::pipe;
+
+namespace tmn::detail {
+
+template <typename S>
+inline constexpr bool is_pipe_stage_v = false;
+
+template <typename Fn>
+inline constexpr bool is_pipe_stage_v<pipe::FmapStage<Fn>> = true;
+
+template <typename Fn>
+inline constexpr bool is_pipe_stage_v<pipe::AndThenStage<Fn>> = true;
+
+template <typename S>
+inline constexpr bool is_and_then_stage_v = false;
+
+template <typename Fn>
+inline constexpr bool is_and_then_stage_v<pipe::AndThenStage<Fn>> = true;
+
+// Argument of the next stage: references are passed on, prvalues are bound as `U&&`
+// (the temporary lives until the end of the fused evaluation);
+template <typename R>
+using stage_arg_t = std::conditional_t<std::is_reference_v<R>, R, R&&>;
+
+// What `fn` of and_then returns: Option<U> / Result<U, F> are flattened, other values are kept;
+template <typename R>
+struct BindTraits {
+  static constexpr bool is_option = OptionTraits<std::remove_cvref_t<R>>::is_option;
+  static constexpr bool is_result = ResultTraits<std::remove_cvref_t<R>>::is_result;
+};
+
+template <typename Stage, typename Arg>
+struct StageOutput;
+
+template <typename Fn, typename Arg>
+struct StageOutput<pipe::FmapStage<Fn>, Arg> {
+  using type = stage_arg_t<std::invoke_result_t<const Fn&, Arg>>;
+};
+
+template <typename Fn, typename Arg>
+struct StageOutput<pipe::AndThenStage<Fn>, Arg> {
+  using result_type = std::invoke_result_t<const Fn&, Arg>;
+  using wrapped = std::remove_cvref_t<result_type>;
+
+  template <typename W>
+  static auto payload() {
+    if constexpr (BindTraits<W>::is_option) return std::type_identity<typename OptionTraits<W>::value_type&&>{};
+    else if constexpr (BindTraits<W>::is_result) return std::type_identity<typename ResultTraits<W>::value_type&&>{};
+    else return std::type_identity<stage_arg_t<result_type>>{};
+  }
+
+  using type = typename decltype(payload<wrapped>())::type;
+};
+
+// Argument passed to the last stage ... the value stored in the result:
+template <typename Arg, typename... Stages>
+struct PipeOutput {
+  using type = Arg;
+};
+
+template <typename Arg, typename Stage, typename... Rest>
+struct PipeOutput<Arg, Stage, Rest...> : PipeOutput<typename StageOutput<Stage, Arg>::type, Rest...> {};
+
+template <typename Arg, typename... Stages>
+using pipe_value_t = std::remove_cvref_t<typename PipeOutput<Arg, Stages...>::type>;
+
+// Error of a pipeline over Result<T, E>: every and_then stage returning Result<U, F> widens it
+// with F (err::widen_t, as the eager `Result::and_then` does), the other stages keep it:
+template <typename E, typename Arg, typename... Stages>
+struct PipeError {
+  using type = E;
+};
+
+template <typename E, typename Arg, typename Stage, typename... Rest>
+struct PipeError<E, Arg, Stage, Rest...> {
+  template <typename S>
+  static auto stage_error() {
+    if constexpr (is_and_then_stage_v<S>) {
+      using W = typename StageOutput<S, Arg>::wrapped;
+      if constexpr (BindTraits<W>::is_result) return std::type_identity<err::widen_t<E, typename ResultTraits<W>::error_type>>{};
+      else return std::type_identity<E>{};
+    }
+    else {
+      return std::type_identity<E>{};
+    }
+  }
+
+  using type = typename PipeError<typename decltype(stage_error<Stage>())::type, typename StageOutput<Stage, Arg>::type, Rest...>::type;
+};
+
+template <typename E, typename Arg, typename... Stages>
+using pipe_error_t = typename PipeError<E, Arg, Stages...>::type;
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_PIPE_TRAITS_HPP
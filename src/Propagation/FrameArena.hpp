@@ -0,0 +1,64 @@
+#ifndef TMN_THROWLESS_FRAME_ARENA_HPP
+#define TMN_THROWLESS_FRAME_ARENA_HPP
+
+#include <cstddef> // for: size_t, byte, max_align_t;
+#include <cstdint> // for: uintptr_t;
+#include <new> // for: operator new, operator delete;
+
+namespace tmn::detail {
+
+// Thread-local bump allocator for the frames of propagation coroutines.
+// These coroutines never stay suspended: every frame is created and destroyed
+// before the call returns, so frames are released in strict LIFO order
+// and a stack-like arena replaces the heap allocation (when the compiler
+// could not elide the allocation with HALO). If the arena is exhausted
+// (very deep recursion), frames fall back to the global operator new;
+class CoroutineFrameArena {
+private: //* fields:
+  static constexpr std::size_t capacity = 64 * 1024;
+  static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+  struct Storage {
+    alignas(alignment) std::byte buffer[capacity];
+    std::size_t top = 0;
+  };
+
+  static Storage& storage() noexcept {
+    thread_local Storage arena;
+    return arena;
+  }
+
+  static bool owns(const Storage& arena, const void* ptr) noexcept {
+    const auto begin = reinterpret_cast<std::uintptr_t>(arena.buffer);
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    return address >= begin && address < begin + capacity;
+  }
+
+public: //* methods:
+  static void* allocate(std::size_t size) {
+    Storage& arena = storage();
+    const std::size_t aligned_size = (size + alignment - 1) & ~(alignment - 1);
+
+    if (arena.top + aligned_size <= capacity) {
+      void* frame = arena.buffer + arena.top;
+      arena.top += aligned_size;
+      return frame;
+    }
+    return ::operator new(size);
+  }
+
+  static void deallocate(void* frame, std::size_t size) noexcept {
+    Storage& arena = storage();
+
+    if (owns(arena, frame)) {
+      // LIFO: the released frame is always the last allocated one;
+      arena.top = static_cast<std::size_t>(static_cast<std::byte*>(frame) - arena.buffer);
+      return;
+    }
+    ::operator delete(frame, size);
+  }
+};
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_FRAME_ARENA_HPP
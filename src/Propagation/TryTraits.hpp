@@ -0,0 +1,92 @@
+#ifndef TMN_THROWLESS_TRY_TRAITS_HPP
+#define TMN_THROWLESS_TRY_TRAITS_HPP
+
+#include <utility> // for: move, forward;
+#include <concepts> // for: constructible_from;
+#include <type_traits> // for: is_lvalue_reference_v, is_void_v;
+
+#include "../../include/Option/Option.hpp"
+#include "../../include/Result/Result.hpp"
+
+namespace tmn::detail {
+
+//*   <--- failure carriers: "return this failure from the current function" --->
+
+// Converts to any Option<U>: None is propagated without knowing the target type;
+struct NoneCarrier {
+  template <typename U>
+  operator Option<U>() const noexcept { return Option<U>(); }
+};
+
+// Converts to any Result<U, F>, if F can be constructed from the propagated error:
+template <typename E>
+struct ErrCarrier {
+  E error;
+
+  template <typename U, typename F> requires std::constructible_from<F, E&&>
+  operator Result<U, F>() && {
+    if constexpr (std::same_as<E, F>) {
+      return Result<U, F>::Err(std::move(error));
+    }
+    else {
+      return Result<U, F>::Err(F(std::move(error)));
+    }
+  }
+};
+
+//*   <--- traits for propagation: failure check, failure extraction, value extraction --->
+
+// Shared by the TMN_TRY macro and by the coroutine support (co_await);
+// `unwrap()` and `failure()` move out of rvalues and copy from lvalues;
+template <typename R>
+struct TryTraits; // only Option and Result are supported;
+
+template <typename T>
+struct TryTraits<Option<T>> {
+  static bool is_failure(const Option<T>& opt) noexcept { return !opt.has_value(); }
+
+  template <typename O>
+  static NoneCarrier failure(O&&) noexcept { return NoneCarrier{}; }
+
+  template <typename O>
+  static T unwrap(O&& opt) {
+    if constexpr (std::is_lvalue_reference_v<O> || std::is_reference_v<T>) {
+      return opt.value_unchecked();
+    }
+    else {
+      return std::move(opt.value_unchecked());
+    }
+  }
+};
+
+template <typename T, typename E>
+struct TryTraits<Result<T, E>> {
+  static bool is_failure(const Result<T, E>& res) noexcept { return res.is_err(); }
+
+  template <typename R>
+  static ErrCarrier<E> failure(R&& res) {
+    if constexpr (std::is_lvalue_reference_v<R>) {
+      return ErrCarrier<E>{res.unwrap_err_unchecked()};
+    }
+    else {
+      return ErrCarrier<E>{std::move(res.unwrap_err_unchecked())};
+    }
+  }
+
+  template <typename R>
+  static T unwrap(R&& res) {
+    if constexpr (std::is_void_v<T>) {
+      return;
+    }
+    else if constexpr (std::is_lvalue_reference_v<R> || std::is_reference_v<T>) {
+      return res.unwrap_unchecked();
+    }
+    else {
+      return std::move(res.unwrap_unchecked());
+    }
+  }
+};
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_TRY_TRAITS_HPP
@@ -0,0 +1,82 @@
+#ifndef TMN_THROWLESS_RANGE_TRAITS_HPP
+#define TMN_THROWLESS_RANGE_TRAITS_HPP
+
+#include <ranges> // for: input_range, range_reference_t, view;
+#include <utility> // for: move;
+#include <type_traits> // for: remove_cvref_t, is_reference_v, is_lvalue_reference_v, is_void_v;
+
+#include "../../include/Option/Option.hpp"
+#include "../../include/Result/Result.hpp"
+
+namespace tmn::detail {
+
+//*   <--- elements of ranges of Option / Result --->
+
+template <typename W>
+struct WrapperTraits {
+  static constexpr bool is_option = false;
+  static constexpr bool is_result = false;
+};
+
+template <typename T>
+struct WrapperTraits<Option<T>> {
+  static constexpr bool is_option = true;
+  static constexpr bool is_result = false;
+  using value_type = T;
+};
+
+template <typename T, typename E>
+struct WrapperTraits<Result<T, E>> {
+  static constexpr bool is_option = false;
+  static constexpr bool is_result = true;
+  using value_type = T;
+  using error_type = E;
+};
+
+template <typename R>
+using range_wrapper_traits = WrapperTraits<std::remove_cvref_t<std::ranges::range_reference_t<R>>>;
+
+// Ranges of Option<T> / Result<T, E> with an object payload (not T&, not void):
+template <typename R>
+concept OptionInputRange = std::ranges::input_range<R> && range_wrapper_traits<R>::is_option &&
+  !std::is_reference_v<typename range_wrapper_traits<R>::value_type>;
+
+template <typename R>
+concept ResultInputRange = std::ranges::input_range<R> && range_wrapper_traits<R>::is_result &&
+  !std::is_reference_v<typename range_wrapper_traits<R>::value_type> &&
+  !std::is_void_v<typename range_wrapper_traits<R>::value_type>;
+
+// The payloads of the elements may be moved out: the elements are temporaries
+// (lazy views, move iterators) or the range is an expiring container;
+template <typename R>
+inline constexpr bool moves_payloads = !std::is_lvalue_reference_v<std::ranges::range_reference_t<R>> ||
+  (!std::is_lvalue_reference_v<R> && !std::ranges::view<std::remove_cvref_t<R>>);
+
+template <typename W>
+bool is_present(const W& elem) noexcept {
+  if constexpr (WrapperTraits<std::remove_cvref_t<W>>::is_option) return elem.has_value();
+  else return elem.is_ok();
+}
+
+// Value of a present element (moved out when `Move`, copied otherwise):
+template <bool Move, typename W>
+decltype(auto) present_value(W& elem) noexcept {
+  if constexpr (WrapperTraits<std::remove_cvref_t<W>>::is_option) {
+    if constexpr (Move) return std::move(elem.value_unchecked());
+    else return elem.value_unchecked();
+  }
+  else {
+    if constexpr (Move) return std::move(elem.unwrap_unchecked());
+    else return elem.unwrap_unchecked();
+  }
+}
+
+template <bool Move, typename W>
+decltype(auto) error_value(W& elem) noexcept {
+  if constexpr (Move) return std::move(elem.unwrap_err_unchecked());
+  else return elem.unwrap_err_unchecked();
+}
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_RANGE_TRAITS_HPP
@@ -0,0 +1,59 @@
+#ifndef TMN_THROWLESS_RESULT_HPP
+#error "AndThen.hpp is a file with hidden implementation details of Result and is not intended for use"
+#endif
+
+#ifndef TMN_THROWLESS_RESULT_AND_THEN_HPP
+#define TMN_THROWLESS_RESULT_AND_THEN_HPP
+
+#include <utility> // for: move;
+#include <concepts> // for: same_as;
+#include <type_traits> // for: is_void_v, is_reference_v;
+
+#include "../Error/ErrorSet.hpp" // for: widen_t;
+
+namespace tmn::detail {
+
+// Type returned by `Result<T, E>::and_then(fn)` where `fn` returns R:
+// - R is a plain value: Result<R, E> (the value is wrapped into Ok);
+// - R is Result<U, F>: the results are flattened into Result<U, widen_t<E, F>>,
+//   so chaining functions with different errors widens the error set (OneOf);
+template <typename R, typename E>
+struct AndThenResult { using type = Result<R, E>; };
+
+template <typename U, typename F, typename E>
+struct AndThenResult<Result<U, F>, E> { using type = Result<U, err::widen_t<E, F>>; };
+
+template <typename R, typename E>
+using and_then_result_t = typename AndThenResult<R, E>::type;
+
+template <typename R>
+inline constexpr bool is_result_v = false;
+
+template <typename U, typename F>
+inline constexpr bool is_result_v<Result<U, F>> = true;
+
+// Result<U, F> returned by the continuation -> Target = Result<U, W> (W is the widened error):
+template <typename Target, typename U, typename F>
+Target widen_result(Result<U, F>&& result) {
+  if constexpr (std::same_as<Target, Result<U, F>>) {
+    return std::move(result);
+  }
+  else {
+    if (result.is_err()) {
+      return Target::Err(std::move(result.unwrap_err_unchecked()));
+    }
+    if constexpr (std::is_void_v<U>) {
+      return Target::Ok();
+    }
+    else if constexpr (std::is_reference_v<U>) {
+      return Target::Ok(result.unwrap_unchecked());
+    }
+    else {
+      return Target::Ok(std::move(result.unwrap_unchecked()));
+    }
+  }
+}
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_RESULT_AND_THEN_HPP
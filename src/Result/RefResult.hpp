@@ -0,0 +1,113 @@
+#ifndef TMN_THROWLESS_RESULT_HPP
+#error "Specialization of a class must follow the declaration of the main class template"
+#endif
+
+#ifndef TMN_THROWLESS_REF_RESULT_HPP
+#define TMN_THROWLESS_REF_RESULT_HPP
+
+#include "../../include/Result/Result.hpp"
+
+namespace tmn {
+
+// Specialization for references: successful Result<T&, E> refers to an existing
+// object (zero-copy lookups and accessors), the reference is stored as a pointer;
+// Result<T&, E> does not own the object: the object must outlive the Result;
+template<typename T, typename E> requires err::Error<E>
+class Result<T&, E> {
+private: //* substructures:
+  enum class State : std::uint8_t {
+    OkState,
+    ErrState
+  };
+
+private: //* fields:
+  union {
+    T* ok_ptr;
+    E err_val;
+  };
+
+  State state;
+
+public: //* methods:
+  //*   <--- constructors, (~)ro5, destructor --->
+  Result() = delete;
+  Result(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<E>);
+  Result(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<E>);
+  Result& operator=(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<E>);
+  Result& operator=(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<E>);
+
+  ~Result();
+
+  // Conversions (cast) :
+  // true if ok_ptr in union; false if err_val;
+  explicit operator bool() const noexcept;
+
+  Option<T&> to_option() const noexcept;
+
+  explicit operator Option<T&>() const { return to_option(); }
+
+  //*   <--- static mnemonic methods that call the constructor from an argument --->
+  static Result Ok(T& ref) noexcept;
+  static Result Err(const E& error) noexcept(std::is_nothrow_copy_constructible_v<E>);
+  static Result Err(E&& error) noexcept(std::is_nothrow_move_constructible_v<E>);
+
+  template<typename... Args> requires std::constructible_from<E, Args...>
+  static Result Err(Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args...>);
+
+  //*   <--- specialized algorithms & methods  --->
+  bool is_ok() const noexcept;
+  bool is_err() const noexcept;
+
+  Option<T&> unwrap_value_to_optional() const noexcept;
+  T& unwrap_value_or(T& val) const noexcept;
+  T& unwrap_value() const;
+
+  Option<E> unwrap_err_to_optional() const noexcept(std::is_nothrow_copy_constructible_v<E>);
+  E& unwrap_err();
+  const E& unwrap_err() const;
+
+  // Unchecked access (asserted in debug builds only):
+  T& unwrap_unchecked() const noexcept;
+  E& unwrap_err_unchecked() noexcept;
+  const E& unwrap_err_unchecked() const noexcept;
+
+  //*   <--- functional methods (from funcprog)  --->
+  template <typename Func> requires std::invocable<Func, T&>
+  auto fmap(Func&& fn) const
+    noexcept(std::is_nothrow_copy_constructible_v<E> && std::is_nothrow_invocable_v<Func, T&>)
+    -> Result<std::invoke_result_t<Func, T&>, E>;
+
+  template <typename Func> requires std::invocable<Func, E>
+  auto fmap_err(Func&& fn) const
+    noexcept(std::is_nothrow_invocable_v<Func, E>)
+    -> Result<T&, std::invoke_result_t<Func, E>>;
+
+  template <typename Func> requires std::invocable<Func, T&>
+  auto and_then(Func&& fn) const
+    noexcept(std::is_nothrow_copy_constructible_v<E> && std::is_nothrow_invocable_v<Func, T&>)
+    -> detail::and_then_result_t<std::invoke_result_t<Func, T&>, E>;
+
+private: //* methods:
+  void swap(Result& oth) noexcept(std::is_nothrow_swappable_v<E> && std::is_nothrow_move_constructible_v<E>);
+
+  //* private constructors:
+  //*   <--- constructors that are called by static methods Ok(ref), Err(error) --->
+  Result(T* ptr) noexcept;
+  Result(const E& err) noexcept(std::is_nothrow_copy_constructible_v<E>);
+  Result(E&& err) noexcept(std::is_nothrow_move_constructible_v<E>);
+
+private: //* friends:
+  template<typename U, typename F> requires err::Error<F>
+  friend class Result;
+
+  friend void swap(Result& first, Result& second) noexcept(noexcept(first.swap(second))) {
+    first.swap(second);
+  }
+
+}; // class Result<T&, E>;
+
+} // for: namespace tmn;
+
+#include "RefResult.tpp" // for: Result<T&, E> definition;
+
+#endif // TMN_THROWLESS_REF_RESULT_HPP
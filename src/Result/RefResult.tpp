@@ -0,0 +1,271 @@
+#ifndef TMN_THROWLESS_REF_RESULT_HPP
+#error "Definition of the class must follow the declaration of the class"
+#endif
+
+#include <memory> // for: addressof;
+#include <utility> // for: move;
+
+#include "RefResult.hpp"
+#include "../../include/Panic/Panic.hpp" // for: fail_unwrap_value, fail_runtime, TMN_THROWLESS_ASSUME;
+
+namespace tmn {
+
+//*   <--- constructors, (~)ro5, destructor --->
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>::Result(T* ptr) noexcept : ok_ptr(ptr), state(State::OkState) {}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>::Result(const E& err) noexcept(std::is_nothrow_copy_constructible_v<E>)
+  : err_val(err), state(State::ErrState) {}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>::Result(E&& err) noexcept(std::is_nothrow_move_constructible_v<E>)
+  : err_val(std::move(err)), state(State::ErrState) {}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E> Result<T&, E>::Ok(T& ref) noexcept {
+  return Result(std::addressof(ref));
+}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E> Result<T&, E>::Err(const E& err) noexcept(std::is_nothrow_copy_constructible_v<E>) {
+  return Result(err);
+}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E> Result<T&, E>::Err(E&& err) noexcept(std::is_nothrow_move_constructible_v<E>) {
+  return Result(std::move(err));
+}
+
+template <typename T, typename E> requires err::Error<E>
+template<typename... Args> requires std::constructible_from<E, Args...>
+Result<T&, E> Result<T&, E>::Err(Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args...>) {
+  return Result(E{std::forward<Args>(args)...});
+}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>::Result(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<E>)
+  : state(oth.state)
+{
+  if (state == State::OkState) {
+    ok_ptr = oth.ok_ptr;
+  }
+  else {
+    new (&err_val) E(oth.err_val);
+  }
+}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>::Result(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<E>)
+  : state(oth.state)
+{
+  if (state == State::OkState) {
+    ok_ptr = oth.ok_ptr;
+  }
+  else {
+    new (&err_val) E(std::move(oth.err_val));
+  }
+}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>& Result<T&, E>::operator=(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<E>) {
+  if (this == &oth) {
+    return *this;
+  }
+
+  if (state == State::ErrState) {
+    err_val.~E();
+  }
+
+  state = oth.state;
+  if (state == State::OkState) {
+    ok_ptr = oth.ok_ptr;
+  }
+  else {
+    new (&err_val) E(oth.err_val);
+  }
+
+  return *this;
+}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>& Result<T&, E>::operator=(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<E>) {
+  if (this == &oth) {
+    return *this;
+  }
+
+  if (state == State::ErrState) {
+    err_val.~E();
+  }
+
+  state = oth.state;
+  if (state == State::OkState) {
+    ok_ptr = oth.ok_ptr;
+  }
+  else {
+    new (&err_val) E(std::move(oth.err_val));
+  }
+
+  return *this;
+}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>::~Result() {
+  if (state == State::ErrState) {
+    err_val.~E();
+  }
+}
+
+template <typename T, typename E> requires err::Error<E>
+void Result<T&, E>::swap(Result& oth) noexcept(std::is_nothrow_swappable_v<E> && std::is_nothrow_move_constructible_v<E>) {
+  if (this == &oth) return;
+
+  Result temp(std::move(*this));
+  *this = std::move(oth);
+  oth = std::move(temp);
+}
+
+template <typename T, typename E> requires err::Error<E>
+Result<T&, E>::operator bool() const noexcept {
+  return is_ok();
+}
+
+template <typename T, typename E> requires err::Error<E>
+Option<T&> Result<T&, E>::to_option() const noexcept {
+  if (is_ok()) return Option<T&>(*ok_ptr);
+  return Option<T&>();
+}
+
+//*   <--- specialized algorithms & methods  --->
+
+template <typename T, typename E> requires err::Error<E>
+bool Result<T&, E>::is_ok() const noexcept {
+  return state == State::OkState;
+}
+
+template <typename T, typename E> requires err::Error<E>
+bool Result<T&, E>::is_err() const noexcept {
+  return state == State::ErrState;
+}
+
+template <typename T, typename E> requires err::Error<E>
+Option<T&> Result<T&, E>::unwrap_value_to_optional() const noexcept {
+  return to_option();
+}
+
+template <typename T, typename E> requires err::Error<E>
+T& Result<T&, E>::unwrap_value_or(T& val) const noexcept {
+  return is_ok() ? *ok_ptr : val;
+}
+
+template <typename T, typename E> requires err::Error<E>
+T& Result<T&, E>::unwrap_value() const {
+  if (is_err()) [[unlikely]] {
+    detail::fail_unwrap_value(err_val);
+  }
+  return *ok_ptr;
+}
+
+template <typename T, typename E> requires err::Error<E>
+Option<E> Result<T&, E>::unwrap_err_to_optional() const noexcept(std::is_nothrow_copy_constructible_v<E>) {
+  if (is_err()) return Option<E>(err_val);
+  return Option<E>();
+}
+
+template <typename T, typename E> requires err::Error<E>
+E& Result<T&, E>::unwrap_err() {
+  if (is_ok()) [[unlikely]] {
+    detail::fail_runtime("Result<T&, E> does not contain Error");
+  }
+  return err_val;
+}
+
+template <typename T, typename E> requires err::Error<E>
+const E& Result<T&, E>::unwrap_err() const {
+  if (is_ok()) [[unlikely]] {
+    detail::fail_runtime("Result<T&, E> does not contain Error");
+  }
+  return err_val;
+}
+
+template <typename T, typename E> requires err::Error<E>
+T& Result<T&, E>::unwrap_unchecked() const noexcept {
+  TMN_THROWLESS_ASSUME(is_ok(), "Result<T&, E>: unchecked access to the value of Err");
+  return *ok_ptr;
+}
+
+template <typename T, typename E> requires err::Error<E>
+E& Result<T&, E>::unwrap_err_unchecked() noexcept {
+  TMN_THROWLESS_ASSUME(is_err(), "Result<T&, E>: unchecked access to the error of Ok");
+  return err_val;
+}
+
+template <typename T, typename E> requires err::Error<E>
+const E& Result<T&, E>::unwrap_err_unchecked() const noexcept {
+  TMN_THROWLESS_ASSUME(is_err(), "Result<T&, E>: unchecked access to the error of Ok");
+  return err_val;
+}
+
+//*   <--- functional methods  --->
+
+template <typename T, typename E> requires err::Error<E>
+template <typename Func> requires std::invocable<Func, T&>
+auto Result<T&, E>::fmap(Func&& fn) const
+  noexcept(std::is_nothrow_copy_constructible_v<E> && std::is_nothrow_invocable_v<Func, T&>)
+  -> Result<std::invoke_result_t<Func, T&>, E>
+{
+  if (is_ok()) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Func, T&>>) {
+      std::forward<Func>(fn)(*ok_ptr);
+      return Result<void, E>::Ok();
+    }
+    else {
+      return Result<std::invoke_result_t<Func, T&>, E>::Ok(std::forward<Func>(fn)(*ok_ptr));
+    }
+  }
+  else {
+    return Result<std::invoke_result_t<Func, T&>, E>(err_val);
+  }
+}
+
+template <typename T, typename E> requires err::Error<E>
+template <typename Func> requires std::invocable<Func, E>
+auto Result<T&, E>::fmap_err(Func&& fn) const
+  noexcept(std::is_nothrow_invocable_v<Func, E>)
+  -> Result<T&, std::invoke_result_t<Func, E>>
+{
+  if (is_err()) {
+    return Result<T&, std::invoke_result_t<Func, E>>::Err(std::forward<Func>(fn)(err_val));
+  }
+  else {
+    return Result<T&, std::invoke_result_t<Func, E>>::Ok(*ok_ptr);
+  }
+}
+
+template <typename T, typename E> requires err::Error<E>
+template <typename Func> requires std::invocable<Func, T&>
+auto Result<T&, E>::and_then(Func&& fn) const
+  noexcept(std::is_nothrow_copy_constructible_v<E> && std::is_nothrow_invocable_v<Func, T&>)
+  -> detail::and_then_result_t<std::invoke_result_t<Func, T&>, E>
+{
+  using Chained = detail::and_then_result_t<std::invoke_result_t<Func, T&>, E>;
+
+  if (is_ok()) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Func, T&>>) {
+      fn(*ok_ptr);
+      return Result<void, E>::Ok();
+    }
+    else if constexpr (detail::is_result_v<std::invoke_result_t<Func, T&>>) {
+      return detail::widen_result<Chained>(fn(*ok_ptr));
+    }
+    else {
+      return Chained::Ok(fn(*ok_ptr));
+    }
+  }
+  else {
+    return Chained::Err(err_val);
+  }
+}
+
+} // namespace tmn;
@@ -2,132 +2,124 @@
 #error "Include Result.hpp instead of Result.tpp"
 #endif
 
-#include <stdexcept> // for: runtime_error;
 #include <utility> // for: move;
 
 #include "../../include/Result/Result.hpp"
 #include "../../include/Error/ErrorConcept.hpp"
+#include "../../include/Panic/Panic.hpp" // for: fail_unwrap_value, fail_runtime, TMN_THROWLESS_ASSUME;
 
 namespace tmn {
 
 //*   <--- constructors, (~)ro5, destructor --->
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T, E>::Result(const T& val) noexcept(std::is_nothrow_copy_constructible_v<T>)
-  : state(State::OkState), ok_val(val) {}
+  : ok_val(val), state(State::OkState) {}
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T, E>::Result(T&& val) noexcept(std::is_nothrow_move_constructible_v<T>)
-  : state(State::OkState), ok_val(std::move(val)) {}
+  : ok_val(std::move(val)), state(State::OkState) {}
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T, E>::Result(const E& err) noexcept(std::is_nothrow_copy_constructible_v<E>)
-  : state(State::ErrState), err_val(err) {}
+  : err_val(err), state(State::ErrState) {}
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T, E>::Result(E&& err) noexcept(std::is_nothrow_move_constructible_v<E>)
-  : state(State::ErrState), err_val(std::move(err)) {}
+  : err_val(std::move(err)), state(State::ErrState) {}
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T,E> Result<T, E>::Ok(const T& val) noexcept requires (!std::is_void_v<T>) {
   return Result(val);
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T,E> Result<T, E>::Ok(T&& val) noexcept requires (!std::is_void_v<T>) {
-  return Result(val);
+  return Result(std::move(val));
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T,E> Result<T, E>::Err(const E& err) noexcept {
   return Result(err);
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T,E> Result<T, E>::Err(E&& err) noexcept {
   return Result(std::move(err));
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 template<typename... Args> requires std::constructible_from<T, Args...>
 Result<T,E> Result<T, E>::Ok(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
   T v {std::forward<Args>(args)...};
-  return Result(v);
+  return Result(std::move(v));
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 template<typename... Args> requires std::constructible_from<E, Args...>
 Result<T, E> Result<T, E>::Err(Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args...>) {
   E e {std::forward<Args>(args)...};
-  return Result(e);
+  return Result(std::move(e));
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T, E>::Result(const Result& oth)
   noexcept(std::is_nothrow_copy_constructible_v<T> && std::is_nothrow_copy_constructible_v<E>)
 {
   if (oth.state == State::OkState) {
     new (&ok_val) T(oth.ok_val);
-    state = State::OkState;
   }
-  else if (oth.state == State::ErrState) {
+  else {
     new (&err_val) E(oth.err_val);
-    state = State::ErrState;
-  }
-  else if (oth.state == State::Uninitialized) {
-    state = State::Uninitialized;
   }
+  state = oth.state;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T, E>::Result(Result&& oth)
   noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
 {
+  // `oth` keeps its state: its moved-from value is destroyed by its own destructor;
   if (oth.is_ok()) {
     new (&ok_val) T(std::move(oth.ok_val));
-    state = State::OkState;
-    oth.ok_val.~T();
-    oth.state = State::Uninitialized;
   }
   else {
     new (&err_val) E(std::move(oth.err_val));
-    state = State::ErrState;
-    oth.err_val.~E();
-    oth.state = State::Uninitialized;
   }
+  state = oth.state;
 }
 
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template<typename T, typename E> requires err::Error<E>
 template<typename U, typename F> requires std::is_convertible_v<U, T> && std::is_convertible_v<F, E>
 Result<T, E>::Result(const Result<U, F>& oth)
   noexcept(std::is_nothrow_constructible_v<T, U> && std::is_nothrow_constructible_v<E, F>)
 {
   if (oth.is_ok()) {
-    new (&ok_val) T(oth.unwrap());
+    new (&ok_val) T(oth.unwrap_unchecked());
     state = State::OkState;
   }
   else {
-    new (&err_val) E(oth.unwrap_err());
+    new (&err_val) E(oth.unwrap_err_unchecked());
     state = State::ErrState;
   }
 }
 
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template<typename T, typename E> requires err::Error<E>
 template<typename U, typename F> requires std::is_convertible_v<U, T> && std::is_convertible_v<F, E>
 Result<T, E>::Result(Result<U, F>&& oth)
   noexcept(std::is_nothrow_constructible_v<T, U> && std::is_nothrow_constructible_v<E, F>)
 {
   if (oth.is_ok()) {
-    new (&ok_val) T(std::move(oth).unwrap_value());
+    new (&ok_val) T(std::move(oth).unwrap_unchecked());
     state = State::OkState;
   }
   else {
-    new (&err_val) E(std::move(oth).unwrap_err());
+    new (&err_val) E(std::move(oth).unwrap_err_unchecked());
     state = State::ErrState;
   }
 }
 
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template<typename T, typename E> requires err::Error<E>
 template<typename U, typename F> requires std::is_convertible_v<U, T> && std::is_convertible_v<F, E>
 auto Result<T, E>::operator=(const Result<U, F>& oth)
   noexcept(std::is_nothrow_assignable_v<T, U> && std::is_nothrow_assignable_v<E, F>)
@@ -140,7 +132,7 @@ auto Result<T, E>::operator=(const Result<U, F>& oth)
   if (state == State::OkState) {
     ok_val.~T();
   }
-  else if (state == State::ErrState) {
+  else {
     err_val.~E();
   }
 
@@ -148,14 +140,14 @@ auto Result<T, E>::operator=(const Result<U, F>& oth)
   if (state == State::OkState) {
     new (&ok_val) T(oth.ok_val);
   }
-  else if (state == State::ErrState) {
+  else {
     new (&err_val) E(oth.err_val);
   }
 
   return *this;
 }
 
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template<typename T, typename E> requires err::Error<E>
 template<typename U, typename F> requires std::is_convertible_v<U, T> && std::is_convertible_v<F, E>
 auto Result<T, E>::operator=(Result<U, F>&& oth)
   noexcept(std::is_nothrow_assignable_v<T, U> && std::is_nothrow_assignable_v<E, F>)
@@ -168,24 +160,22 @@ auto Result<T, E>::operator=(Result<U, F>&& oth)
   if (state == State::OkState) {
     ok_val.~T();
   }
-  else if (state == State::ErrState) {
+  else {
     err_val.~E();
   }
 
   state = oth.state;
   if (state == State::OkState) {
     new (&ok_val) T(std::move(oth.ok_val));
-    oth.ok_val.~T();
   }
-  else if (state == State::ErrState) {
+  else {
     new (&err_val) E(std::move(oth.err_val));
-    oth.err_val.~E();
   }
 
   return *this;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T,E>& Result<T, E>::operator=(const Result<T,E>& oth)
   noexcept(std::is_nothrow_copy_constructible_v<T> && std::is_nothrow_copy_constructible_v<E>)
 {
@@ -196,7 +186,7 @@ Result<T,E>& Result<T, E>::operator=(const Result<T,E>& oth)
   if (state == State::OkState) {
     ok_val.~T();
   }
-  else if (state == State::ErrState) {
+  else {
     err_val.~E();
   }
 
@@ -204,14 +194,14 @@ Result<T,E>& Result<T, E>::operator=(const Result<T,E>& oth)
   if (state == State::OkState) {
     new (&ok_val) T(oth.ok_val);
   }
-  else if (state == State::ErrState) {
+  else {
     new (&err_val) E(oth.err_val);
   }
 
   return *this;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T,E>& Result<T,E>::operator=(Result<T,E>&& oth)
     noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
 {
@@ -222,34 +212,32 @@ Result<T,E>& Result<T,E>::operator=(Result<T,E>&& oth)
   if (state == State::OkState) {
     ok_val.~T();
   }
-  else if (state == State::ErrState) {
+  else {
     err_val.~E();
   }
 
   state = oth.state;
   if (state == State::OkState) {
     new (&ok_val) T(std::move(oth.ok_val));
-    oth.ok_val.~T();
   }
-  else if (state == State::ErrState) {
+  else {
     new (&err_val) E(std::move(oth.err_val));
-    oth.err_val.~E();
   }
 
   return *this;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T, E>::~Result() {
   if (state == State::OkState) {
     ok_val.~T();
   }
-  else if (state == State::ErrState) {
+  else {
     err_val.~E();
   }
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 void Result<T, E>::swap(Result<T, E> &oth)
     noexcept(std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T> &&
              std::is_nothrow_swappable_v<E> && std::is_nothrow_move_constructible_v<E>)
@@ -261,12 +249,12 @@ void Result<T, E>::swap(Result<T, E> &oth)
   oth = std::move(temp);
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Result<T, E>::operator bool() const noexcept{
   return is_ok();
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Option<T> Result<T, E>::to_option() {
   if (is_ok()) {
     return Option<T>(ok_val);
@@ -276,98 +264,125 @@ Option<T> Result<T, E>::to_option() {
 
 //*   <--- specialized algorithms & methods  --->
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 bool Result<T,E>::is_ok() const noexcept {
   return state == State::OkState;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 bool Result<T,E>::is_err() const noexcept {
   return state == State::ErrState;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Option<T> Result<T, E>::unwrap_value_to_optional() const noexcept(std::is_nothrow_copy_constructible_v<T>) {
   if (is_ok()) return Option<T>(ok_val);
   return Option<T>();
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 T& Result<T,E>::unwrap_value_or(T& val) noexcept(std::is_nothrow_copy_constructible_v<T>) {
   return is_ok() ? ok_val : val;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 const T& Result<T,E>::unwrap_value_or(const T& val) const
   noexcept(std::is_nothrow_copy_constructible_v<T>)
 {
   return is_ok() ? ok_val : val;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 T& Result<T, E>::unwrap_value() {
-  if (is_err()) {
-    throw std::runtime_error(err_val.err_msg());
-  }
-  else if (state == State::Uninitialized) {
-    throw std::runtime_error("Accessing moved-from Result");
+  if (is_err()) [[unlikely]] {
+    detail::fail_unwrap_value(err_val);
   }
-
   return ok_val;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 const T& Result<T, E>::unwrap_value() const {
-  if (is_err()) {
-    throw std::runtime_error(err_val.err_msg());
+  if (is_err()) [[unlikely]] {
+    detail::fail_unwrap_value(err_val);
   }
   return ok_val;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 T Result<T, E>::unwrap_value_or_default() const noexcept requires std::default_initializable<T> {
   return is_ok() ? ok_val : T{};
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 Option<E> Result<T, E>::unwrap_err_to_optional() const noexcept(std::is_nothrow_copy_constructible_v<E>) {
   if (is_err()) return Option<E>(err_val);
   return Option<E>();
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 E& Result<T, E>::unwrap_err() {
-  if (is_ok()) {
-    throw std::runtime_error("Result<T, E> does not contain Error");
+  if (is_ok()) [[unlikely]] {
+    detail::fail_runtime("Result<T, E> does not contain Error");
   }
   return err_val;
 }
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 const E& Result<T, E>::unwrap_err() const {
-  if (is_ok()) {
-    throw std::runtime_error("Result<T, E> does not contain Error");
+  if (is_ok()) [[unlikely]] {
+    detail::fail_runtime("Result<T, E> does not contain Error");
   }
   return err_val;
 }
 
+template <typename T, typename E> requires err::Error<E>
+T& Result<T, E>::unwrap_unchecked() noexcept {
+  TMN_THROWLESS_ASSUME(is_ok(), "Result<T, E>: unchecked access to the value of Err");
+  return ok_val;
+}
+
+template <typename T, typename E> requires err::Error<E>
+const T& Result<T, E>::unwrap_unchecked() const noexcept {
+  TMN_THROWLESS_ASSUME(is_ok(), "Result<T, E>: unchecked access to the value of Err");
+  return ok_val;
+}
+
+template <typename T, typename E> requires err::Error<E>
+E& Result<T, E>::unwrap_err_unchecked() noexcept {
+  TMN_THROWLESS_ASSUME(is_err(), "Result<T, E>: unchecked access to the error of Ok");
+  return err_val;
+}
+
+template <typename T, typename E> requires err::Error<E>
+const E& Result<T, E>::unwrap_err_unchecked() const noexcept {
+  TMN_THROWLESS_ASSUME(is_err(), "Result<T, E>: unchecked access to the error of Ok");
+  return err_val;
+}
+
 //*   <--- functional methods  --->
 
-template <typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template <typename T, typename E> requires err::Error<E>
 template <typename Func> requires std::invocable<Func, T>
 auto Result<T, E>::fmap(Func&& fn)
   noexcept(std::is_nothrow_constructible_v<Result<std::invoke_result_t<Func, T>, E>> && std::is_nothrow_invocable_v<Func, T>)
   -> Result<std::invoke_result_t<Func, T>, E>
 {
   if (is_ok()) {
-    return Result<std::invoke_result_t<Func, T>, E>(std::forward<Func>(fn)(ok_val));
+    // function without a result (status-only step) produces Result<void, E>:
+    if constexpr (std::is_void_v<std::invoke_result_t<Func, T>>) {
+      std::forward<Func>(fn)(ok_val);
+      return Result<void, E>::Ok();
+    }
+    else {
+      return Result<std::invoke_result_t<Func, T>, E>(std::forward<Func>(fn)(ok_val));
+    }
   }
   else {
     return Result<std::invoke_result_t<Func, T>, E>(err_val);
   }
 }
 
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template<typename T, typename E> requires err::Error<E>
 template<typename Func> requires std::invocable<Func, E>
 auto Result<T, E>::fmap_err(Func&& fn) const
   noexcept(std::is_nothrow_constructible_v<Result<T, std::invoke_result_t<Func, E>>> && std::is_nothrow_invocable_v<Func, T>)
@@ -381,18 +396,29 @@ auto Result<T, E>::fmap_err(Func&& fn) const
   }
 }
 
-template<typename T, typename E> requires (!std::is_void_v<T> && err::Error<E>)
+template<typename T, typename E> requires err::Error<E>
 template <typename Func>
 requires std::invocable<Func, T>
 auto Result<T, E>::and_then(Func&& fn) const
-  noexcept(std::is_nothrow_constructible_v<Result<std::invoke_result_t<Func, T>, E>> && std::is_nothrow_invocable_v<Func, T>)
-  -> Result<std::invoke_result_t<Func, T>, E>
+  noexcept(std::is_nothrow_constructible_v<detail::and_then_result_t<std::invoke_result_t<Func, T>, E>> && std::is_nothrow_invocable_v<Func, T>)
+  -> detail::and_then_result_t<std::invoke_result_t<Func, T>, E>
 {
+  using Chained = detail::and_then_result_t<std::invoke_result_t<Func, T>, E>;
+
   if (is_ok()) {
-    return Result<std::invoke_result_t<Func, T>, E>::Ok(fn(ok_val));
+    if constexpr (std::is_void_v<std::invoke_result_t<Func, T>>) {
+      fn(ok_val);
+      return Result<void, E>::Ok();
+    }
+    else if constexpr (detail::is_result_v<std::invoke_result_t<Func, T>>) {
+      return detail::widen_result<Chained>(fn(ok_val));
+    }
+    else {
+      return Chained::Ok(fn(ok_val));
+    }
   }
   else {
-    return Result<std::invoke_result_t<Func, T>, E>::Err(err_val);
+    return Chained::Err(err_val);
   }
 }
 
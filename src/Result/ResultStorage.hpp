@@ -0,0 +1,30 @@
+#ifndef TMN_THROWLESS_RESULT_STORAGE_HPP
+#define TMN_THROWLESS_RESULT_STORAGE_HPP
+
+#include <cstring> // for: memcpy;
+#include <type_traits> // for: is_trivially_copyable_v, is_arithmetic_v;
+
+#include "../../include/Result/Result.hpp"
+
+namespace tmn::detail {
+
+// Branch-free access to Result<T, E> with an arithmetic value for the batch kernels
+// (the counterpart of OptionStorage):
+struct ResultStorage {
+  // Bytes of the value member of the union, whether the Result is Ok or not:
+  // every bit pattern of an arithmetic type is some value, the caller discards it for Err;
+  // copied with memcpy, like OptionStorage::load_raw, and sanitizer-hostile the same way:
+  // for Err the bytes belong to the error (padding and unwritten members included),
+  // the value is only stored into a slot that is overwritten later;
+  template <typename T, typename E> requires std::is_arithmetic_v<T>
+  static T load_raw(const Result<T, E>& res) noexcept {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    std::memcpy(&value, &res.ok_val, sizeof(T));
+    return value;
+  }
+};
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_RESULT_STORAGE_HPP
@@ -0,0 +1,109 @@
+#ifndef TMN_THROWLESS_RESULT_HPP
+#error "Specialization of a class must follow the declaration of the main class template"
+#endif
+
+#ifndef TMN_THROWLESS_VOID_RESULT_HPP
+#define TMN_THROWLESS_VOID_RESULT_HPP
+
+#include "../../include/Result/Result.hpp"
+
+namespace tmn {
+
+// Specialization for status-only results (functions that either succeed
+// without a value or fail with an error): the success case stores nothing,
+// so sizeof(Result<void, E>) is the size of E plus the one-byte discriminant;
+template<typename E> requires err::Error<E>
+class Result<void, E> {
+private: //* substructures:
+  enum class State : std::uint8_t {
+    OkState,
+    ErrState
+  };
+
+private: //* fields:
+  union {
+    E err_val;
+  };
+
+  State state;
+
+public: //* methods:
+  //*   <--- constructors, (~)ro5, destructor --->
+  Result() = delete;
+  Result(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<E>);
+  Result(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<E>);
+  Result& operator=(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<E>);
+  Result& operator=(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<E>);
+
+  ~Result();
+
+  // Conversions (cast) :
+  // true if the operation succeeded; false if err_val;
+  explicit operator bool() const noexcept;
+
+  //*   <--- static mnemonic methods that call the constructor from an argument --->
+  static Result Ok() noexcept;
+  static Result Err(const E& error) noexcept(std::is_nothrow_copy_constructible_v<E>);
+  static Result Err(E&& error) noexcept(std::is_nothrow_move_constructible_v<E>);
+
+  template<typename... Args> requires std::constructible_from<E, Args...>
+  static Result Err(Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args...>);
+
+  //*   <--- specialized algorithms & methods  --->
+  bool is_ok() const noexcept;
+  bool is_err() const noexcept;
+
+  // There is no value to return: the method only checks
+  // that the Result is successful and throws otherwise;
+  void unwrap_value() const;
+
+  Option<E> unwrap_err_to_optional() const noexcept(std::is_nothrow_copy_constructible_v<E>);
+  E& unwrap_err();
+  const E& unwrap_err() const;
+
+  // Unchecked access (asserted in debug builds only):
+  void unwrap_unchecked() const noexcept;
+  E& unwrap_err_unchecked() noexcept;
+  const E& unwrap_err_unchecked() const noexcept;
+
+  //*   <--- functional methods (from funcprog)  --->
+  // Functions passed to the Result<void, E> take no arguments:
+  template <typename Func> requires std::invocable<Func>
+  auto fmap(Func&& fn) const
+    noexcept(std::is_nothrow_copy_constructible_v<E> && std::is_nothrow_invocable_v<Func>)
+    -> Result<std::invoke_result_t<Func>, E>;
+
+  template <typename Func> requires std::invocable<Func, E>
+  auto fmap_err(Func&& fn) const
+    noexcept(std::is_nothrow_invocable_v<Func, E>)
+    -> Result<void, std::invoke_result_t<Func, E>>;
+
+  template <typename Func> requires std::invocable<Func>
+  auto and_then(Func&& fn) const
+    noexcept(std::is_nothrow_copy_constructible_v<E> && std::is_nothrow_invocable_v<Func>)
+    -> detail::and_then_result_t<std::invoke_result_t<Func>, E>;
+
+private: //* methods:
+  void swap(Result& oth) noexcept(std::is_nothrow_swappable_v<E> && std::is_nothrow_move_constructible_v<E>);
+
+  //* private constructors:
+  //*   <--- constructors that are called by static methods Ok(), Err(error) --->
+  Result(std::in_place_t) noexcept;
+  Result(const E& err) noexcept(std::is_nothrow_copy_constructible_v<E>);
+  Result(E&& err) noexcept(std::is_nothrow_move_constructible_v<E>);
+
+private: //* friends:
+  template<typename U, typename F> requires err::Error<F>
+  friend class Result;
+
+  friend void swap(Result& first, Result& second) noexcept(noexcept(first.swap(second))) {
+    first.swap(second);
+  }
+
+}; // class Result<void, E>;
+
+} // for: namespace tmn;
+
+#include "VoidResult.tpp" // for: Result<void, E> definition;
+
+#endif // TMN_THROWLESS_VOID_RESULT_HPP
@@ -0,0 +1,240 @@
+#ifndef TMN_THROWLESS_VOID_RESULT_HPP
+#error "Definition of the class must follow the declaration of the class"
+#endif
+
+#include <utility> // for: move, in_place;
+
+#include "VoidResult.hpp"
+#include "../../include/Panic/Panic.hpp" // for: fail_unwrap_value, fail_runtime, TMN_THROWLESS_ASSUME;
+
+namespace tmn {
+
+//*   <--- constructors, (~)ro5, destructor --->
+
+template <typename E> requires err::Error<E>
+Result<void, E>::Result(std::in_place_t) noexcept : state(State::OkState) {}
+
+template <typename E> requires err::Error<E>
+Result<void, E>::Result(const E& err) noexcept(std::is_nothrow_copy_constructible_v<E>)
+  : err_val(err), state(State::ErrState) {}
+
+template <typename E> requires err::Error<E>
+Result<void, E>::Result(E&& err) noexcept(std::is_nothrow_move_constructible_v<E>)
+  : err_val(std::move(err)), state(State::ErrState) {}
+
+template <typename E> requires err::Error<E>
+Result<void, E> Result<void, E>::Ok() noexcept {
+  return Result(std::in_place);
+}
+
+template <typename E> requires err::Error<E>
+Result<void, E> Result<void, E>::Err(const E& err) noexcept(std::is_nothrow_copy_constructible_v<E>) {
+  return Result(err);
+}
+
+template <typename E> requires err::Error<E>
+Result<void, E> Result<void, E>::Err(E&& err) noexcept(std::is_nothrow_move_constructible_v<E>) {
+  return Result(std::move(err));
+}
+
+template <typename E> requires err::Error<E>
+template<typename... Args> requires std::constructible_from<E, Args...>
+Result<void, E> Result<void, E>::Err(Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args...>) {
+  return Result(E{std::forward<Args>(args)...});
+}
+
+template <typename E> requires err::Error<E>
+Result<void, E>::Result(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<E>)
+  : state(oth.state)
+{
+  if (state == State::ErrState) {
+    new (&err_val) E(oth.err_val);
+  }
+}
+
+template <typename E> requires err::Error<E>
+Result<void, E>::Result(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<E>)
+  : state(oth.state)
+{
+  if (state == State::ErrState) {
+    new (&err_val) E(std::move(oth.err_val));
+  }
+}
+
+template <typename E> requires err::Error<E>
+Result<void, E>& Result<void, E>::operator=(const Result& oth) noexcept(std::is_nothrow_copy_constructible_v<E>) {
+  if (this == &oth) {
+    return *this;
+  }
+
+  if (state == State::ErrState) {
+    err_val.~E();
+  }
+
+  state = oth.state;
+  if (state == State::ErrState) {
+    new (&err_val) E(oth.err_val);
+  }
+
+  return *this;
+}
+
+template <typename E> requires err::Error<E>
+Result<void, E>& Result<void, E>::operator=(Result&& oth) noexcept(std::is_nothrow_move_constructible_v<E>) {
+  if (this == &oth) {
+    return *this;
+  }
+
+  if (state == State::ErrState) {
+    err_val.~E();
+  }
+
+  state = oth.state;
+  if (state == State::ErrState) {
+    new (&err_val) E(std::move(oth.err_val));
+  }
+
+  return *this;
+}
+
+template <typename E> requires err::Error<E>
+Result<void, E>::~Result() {
+  if (state == State::ErrState) {
+    err_val.~E();
+  }
+}
+
+template <typename E> requires err::Error<E>
+void Result<void, E>::swap(Result& oth) noexcept(std::is_nothrow_swappable_v<E> && std::is_nothrow_move_constructible_v<E>) {
+  if (this == &oth) return;
+
+  Result temp(std::move(*this));
+  *this = std::move(oth);
+  oth = std::move(temp);
+}
+
+template <typename E> requires err::Error<E>
+Result<void, E>::operator bool() const noexcept {
+  return is_ok();
+}
+
+//*   <--- specialized algorithms & methods  --->
+
+template <typename E> requires err::Error<E>
+bool Result<void, E>::is_ok() const noexcept {
+  return state == State::OkState;
+}
+
+template <typename E> requires err::Error<E>
+bool Result<void, E>::is_err() const noexcept {
+  return state == State::ErrState;
+}
+
+template <typename E> requires err::Error<E>
+void Result<void, E>::unwrap_value() const {
+  if (is_err()) [[unlikely]] {
+    detail::fail_unwrap_value(err_val);
+  }
+}
+
+template <typename E> requires err::Error<E>
+Option<E> Result<void, E>::unwrap_err_to_optional() const noexcept(std::is_nothrow_copy_constructible_v<E>) {
+  if (is_err()) return Option<E>(err_val);
+  return Option<E>();
+}
+
+template <typename E> requires err::Error<E>
+E& Result<void, E>::unwrap_err() {
+  if (is_ok()) [[unlikely]] {
+    detail::fail_runtime("Result<void, E> does not contain Error");
+  }
+  return err_val;
+}
+
+template <typename E> requires err::Error<E>
+const E& Result<void, E>::unwrap_err() const {
+  if (is_ok()) [[unlikely]] {
+    detail::fail_runtime("Result<void, E> does not contain Error");
+  }
+  return err_val;
+}
+
+template <typename E> requires err::Error<E>
+void Result<void, E>::unwrap_unchecked() const noexcept {
+  TMN_THROWLESS_ASSUME(is_ok(), "Result<void, E>: unchecked access to the value of Err");
+}
+
+template <typename E> requires err::Error<E>
+E& Result<void, E>::unwrap_err_unchecked() noexcept {
+  TMN_THROWLESS_ASSUME(is_err(), "Result<void, E>: unchecked access to the error of Ok");
+  return err_val;
+}
+
+template <typename E> requires err::Error<E>
+const E& Result<void, E>::unwrap_err_unchecked() const noexcept {
+  TMN_THROWLESS_ASSUME(is_err(), "Result<void, E>: unchecked access to the error of Ok");
+  return err_val;
+}
+
+//*   <--- functional methods  --->
+
+template <typename E> requires err::Error<E>
+template <typename Func> requires std::invocable<Func>
+auto Result<void, E>::fmap(Func&& fn) const
+  noexcept(std::is_nothrow_copy_constructible_v<E> && std::is_nothrow_invocable_v<Func>)
+  -> Result<std::invoke_result_t<Func>, E>
+{
+  if (is_ok()) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Func>>) {
+      std::forward<Func>(fn)();
+      return Result<void, E>::Ok();
+    }
+    else {
+      return Result<std::invoke_result_t<Func>, E>(std::forward<Func>(fn)());
+    }
+  }
+  else {
+    return Result<std::invoke_result_t<Func>, E>(err_val);
+  }
+}
+
+template <typename E> requires err::Error<E>
+template <typename Func> requires std::invocable<Func, E>
+auto Result<void, E>::fmap_err(Func&& fn) const
+  noexcept(std::is_nothrow_invocable_v<Func, E>)
+  -> Result<void, std::invoke_result_t<Func, E>>
+{
+  if (is_err()) {
+    return Result<void, std::invoke_result_t<Func, E>>::Err(std::forward<Func>(fn)(err_val));
+  }
+  else {
+    return Result<void, std::invoke_result_t<Func, E>>::Ok();
+  }
+}
+
+template <typename E> requires err::Error<E>
+template <typename Func> requires std::invocable<Func>
+auto Result<void, E>::and_then(Func&& fn) const
+  noexcept(std::is_nothrow_copy_constructible_v<E> && std::is_nothrow_invocable_v<Func>)
+  -> detail::and_then_result_t<std::invoke_result_t<Func>, E>
+{
+  using Chained = detail::and_then_result_t<std::invoke_result_t<Func>, E>;
+
+  if (is_ok()) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Func>>) {
+      fn();
+      return Result<void, E>::Ok();
+    }
+    else if constexpr (detail::is_result_v<std::invoke_result_t<Func>>) {
+      return detail::widen_result<Chained>(fn());
+    }
+    else {
+      return Chained::Ok(fn());
+    }
+  }
+  else {
+    return Chained::Err(err_val);
+  }
+}
+
+} // namespace tmn;
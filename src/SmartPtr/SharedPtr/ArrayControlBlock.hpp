@@ -33,7 +33,7 @@ private: //* friends:
 
 public:
   //* constructors:
-  ControlBlock(T* arr, size_t size);
+  ControlBlock(T* arr, size_t size) noexcept; // function pointer deleter, as in ControlBlock<T>;
   ControlBlock(T* arr, size_t size, std::function<void(T*, size_t size)> del);
 
   //* modifier-methods:
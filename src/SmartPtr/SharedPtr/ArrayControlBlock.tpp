@@ -9,19 +9,20 @@ of the SmartPtr mechanism and is not intended for use"
 #endif
 
 #include "ArrayControlBlock.hpp"
+#include "../../../include/Panic/Panic.hpp" // for: fail_with;
 
 namespace tmn {
 
 template<typename T>
-ControlBlock<T[]>::ControlBlock(T* arr_ptr, size_t size)
-  : ref_count(1), weak_count(0), array_ptr(arr_ptr), array_size(size), deleter([](T* p, size_t size) { delete[] p; }) {}
+ControlBlock<T[]>::ControlBlock(T* arr_ptr, size_t size) noexcept
+  : ref_count(1), weak_count(0), array_ptr(arr_ptr), array_size(size), deleter(&detail::delete_array<T>) {}
 
 template<typename T>
 ControlBlock<T[]>::ControlBlock(T* arr_ptr, size_t size, std::function<void(T*, size_t size)> del)
   : ref_count(1), weak_count(0), array_ptr(arr_ptr), array_size(size), deleter(std::move(del))
 {
-  if (deleter == nullptr) {
-    throw err::NullPtrErr("Deleter<[]>");
+  if (deleter == nullptr) [[unlikely]] {
+    detail::fail_with<err::NullPtrErr>("Deleter<[]>");
   }
 }
 
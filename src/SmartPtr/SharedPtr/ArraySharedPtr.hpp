@@ -6,6 +6,7 @@
 #include "ArrayControlBlock.hpp"
 #include "../../../include/Result/Result.hpp"
 #include  "../../../include/Error/Error.hpp"
+#include "../../../include/Error/ErasedErr.hpp"
 
 namespace tmn {
 
@@ -36,7 +37,7 @@ private: //* friends:
   friend class WeakPtr<T[]>;
 
   template <typename U>
-  friend Result<SharedPtr<U[]>, err::AnyErr> make_shared_array(size_t size);
+  friend Result<SharedPtr<U[]>, err::ErasedErr> make_shared_array(size_t size);
 
 public:
 //*   <--- constructors, (~)ro5, destructor (etc) --->
@@ -67,7 +68,8 @@ public:
 
   T& operator[](size_t index) const noexcept;
 
-  Result<T, err::AnyErr> at(size_t index) const;
+  // Returns a reference to the element (no copy) or an error:
+  Result<T&, err::ErasedErr> at(size_t index) const;
 
   bool has_resource() const noexcept;
   explicit operator bool() const noexcept;
@@ -129,14 +129,14 @@ T& SharedPtr<T[]>::operator[](size_t index) const noexcept {
 }
 
 template<typename T>
-Result<T, err::AnyErr> SharedPtr<T[]>::at(size_t index) const {
+Result<T&, err::ErasedErr> SharedPtr<T[]>::at(size_t index) const {
   if (!resource_ptr) {
-    return Result<T, err::EmptyArrErr>::Err("Null SharedPtr array access");
+    return Result<T&, err::ErasedErr>::Err(err::EmptyArrErr(err::StaticMsg("Null SharedPtr array access")));
   }
   if (index >= size()) {
-    return Result<T, err::OutOfRangeErr>::Err(index, size());
+    return Result<T&, err::ErasedErr>::Err(err::OutOfRangeErr(index, size()));
   }
-  return Result<T, err::AnyErr>::Ok(resource_ptr[index]);
+  return Result<T&, err::ErasedErr>::Ok(resource_ptr[index]);
 }
 
 template<typename T>
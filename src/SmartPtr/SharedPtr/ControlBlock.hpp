@@ -48,7 +48,9 @@ private: //* friends:
 
 public:
   //* constructors:
-  ControlBlock(T* ptr);
+  // the default deleter is a function pointer: std::function stores it without allocation
+  // and the constructor can not throw (make_shared_ptr relies on it);
+  ControlBlock(T* ptr) noexcept;
   ControlBlock(T* ptr, std::function<void(T*)> del);
 
   //* modifier-methods:
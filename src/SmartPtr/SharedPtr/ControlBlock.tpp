@@ -10,19 +10,30 @@ of the SmartPtr mechanism and is not intended for use"
 
 #include "ControlBlock.hpp"
 #include "../../../include/Error/Error.hpp"
+#include "../../../include/Panic/Panic.hpp" // for: fail_with;
 
 namespace tmn {
 
+namespace detail {
+
+template<typename T>
+void delete_object(T* ptr) noexcept { delete ptr; }
+
+template<typename T>
+void delete_array(T* ptr, size_t) noexcept { delete[] ptr; }
+
+} // namespace tmn::detail;
+
 template<typename T>
-ControlBlock<T>::ControlBlock(T* ptr)
-  : ref_count(0), weak_count(0), object_ptr(ptr), deleter([](T* p) { delete p; }) {}
+ControlBlock<T>::ControlBlock(T* ptr) noexcept
+  : ref_count(0), weak_count(0), object_ptr(ptr), deleter(&detail::delete_object<T>) {}
 
 template<typename T>
 ControlBlock<T>::ControlBlock(T* ptr, std::function<void(T*)> del)
   : ref_count(0), weak_count(0), object_ptr(ptr), deleter(std::move(del))
 {
-  if (deleter == nullptr) {
-    throw err::NullPtrErr("Deleter");
+  if (deleter == nullptr) [[unlikely]] {
+    detail::fail_with<err::NullPtrErr>("Deleter");
   }
 }
 
@@ -2,9 +2,13 @@
 #error "Include SharedPtr.hpp instead of MakeSharedPtr.tpp"
 #endif
 
+#include <new> // for: nothrow;
+#include <cstdint> // for: PTRDIFF_MAX;
+
 #include "../../../include/SmartPtr/SharedPtr.hpp"
 #include "../../../include/Result/Result.hpp"
 #include "ControlBlock.hpp"
+#include "../../../include/Panic/Panic.hpp" // for: fail_bad_alloc;
 
 namespace tmn {
 
@@ -14,41 +18,39 @@ namespace tmn {
 
 template <typename T, typename... Args>
 SharedPtr<T> make_shared_ptr(Args&&... args) {
-  T* raw_resource_ptr = nullptr;
-  ControlBlock<T>* control_block = nullptr;
-
-  try {
-    raw_resource_ptr = new T(std::forward<Args>(args)...);
-    control_block = new ControlBlock<T>(raw_resource_ptr);
+  // nothrow from end to end (an exception of the constructor of T is the only one that leaves):
+  // both allocations report failure with nullptr and the constructor of the control block does not throw;
+  T* raw_resource_ptr = new (std::nothrow) T(std::forward<Args>(args)...);
+  if (raw_resource_ptr == nullptr) [[unlikely]] {
+    detail::fail_bad_alloc();
   }
-  catch(...){
+
+  ControlBlock<T>* control_block = new (std::nothrow) ControlBlock<T>(raw_resource_ptr);
+  if (control_block == nullptr) [[unlikely]] {
     delete raw_resource_ptr;
-    throw;
+    detail::fail_bad_alloc();
   }
 
   return SharedPtr<T>(raw_resource_ptr, control_block);
 }
 
 template<typename T>
-Result<SharedPtr<T[]>, err::AnyErr> make_shared_array(size_t size) {
+Result<SharedPtr<T[]>, err::ErasedErr> make_shared_array(size_t size) {
   if (size == 0) {
     return Result<SharedPtr<T[]>, err::InvalidArgErr>::Err(
-      err::InvalidArgErr("Array to be created must have a non-zero size")
+      err::InvalidArgErr(err::StaticMsg("Array to be created must have a non-zero size"))
     );
   }
 
-  T* raw_array = nullptr;
-  ControlBlock<T[]>* control_block = nullptr;
-
-  try {
-    raw_array = new T[size];
-
-    control_block = new ControlBlock<T[]>(raw_array, size);
+  T* raw_array = size <= PTRDIFF_MAX / sizeof(T) ? new (std::nothrow) T[size] : nullptr;
+  if (raw_array == nullptr) [[unlikely]] {
+    return Result<SharedPtr<T[]>, err::BadAllocErr>::Err(err::BadAllocErr());
   }
-  catch (const std::bad_alloc& e) {
-    return Result<SharedPtr<T[]>, err::BadAllocErr>::Err(
-      err::BadAllocErr()
-    );
+
+  ControlBlock<T[]>* control_block = new (std::nothrow) ControlBlock<T[]>(raw_array, size);
+  if (control_block == nullptr) [[unlikely]] {
+    delete[] raw_array;
+    return Result<SharedPtr<T[]>, err::BadAllocErr>::Err(err::BadAllocErr());
   }
 
   assert(raw_array != nullptr);
@@ -0,0 +1,113 @@
+#ifndef TMN_THROWLESS_SHARED_STR_HPP
+#error "Include SharedStr.hpp instead of SharedStr.tpp"
+#endif
+
+#include "../../../include/SmartPtr/SharedStr.hpp"
+
+#include <cstring> // for: memcpy;
+#include <new> // for: operator new, operator delete;
+#include <utility> // for: std::exchange;
+
+namespace tmn {
+
+//*   <--- StrControlBlock --->
+
+inline void SharedStr::StrControlBlock::increment_strong() noexcept {
+  ref_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline bool SharedStr::StrControlBlock::decrement_strong() noexcept {
+  return ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+//*   <--- private methods --->
+
+// The member is detached before the decrement: no path leaves it pointing to a freed block
+// (GCC's -Wuse-after-free does not see the refcount guard across inlined copies otherwise);
+inline void SharedStr::cleanup() noexcept {
+  StrControlBlock* const block = std::exchange(control_block, nullptr);
+  if (block == nullptr || !block->decrement_strong()) return;
+
+  block->~StrControlBlock();
+  ::operator delete(block);
+}
+
+inline void SharedStr::swap(SharedStr& oth) noexcept {
+  std::swap(control_block, oth.control_block);
+}
+
+//*   <--- constructors, (~)ro5, destructor (etc) --->
+
+inline SharedStr::SharedStr(std::string_view text) {
+  if (text.empty()) return;
+
+  void* memory = ::operator new(sizeof(StrControlBlock) + text.size() + 1);
+  control_block = ::new (memory) StrControlBlock{{1}, text.size()};
+  std::memcpy(control_block->chars(), text.data(), text.size());
+  control_block->chars()[text.size()] = '\0';
+}
+
+inline SharedStr::SharedStr(const std::string& text) : SharedStr(std::string_view(text)) {}
+
+inline SharedStr::SharedStr(const char* text) : SharedStr(std::string_view(text)) {}
+
+inline SharedStr::SharedStr(const SharedStr& oth) noexcept : control_block(oth.control_block) {
+  if (control_block != nullptr) {
+    control_block->increment_strong();
+  }
+}
+
+inline SharedStr::SharedStr(SharedStr&& oth) noexcept
+  : control_block(std::exchange(oth.control_block, nullptr)) {}
+
+inline SharedStr& SharedStr::operator=(const SharedStr& oth) noexcept {
+  if (control_block != oth.control_block) {
+    SharedStr copy(oth);
+    swap(copy);
+  }
+  return *this;
+}
+
+inline SharedStr& SharedStr::operator=(SharedStr&& oth) noexcept {
+  if (this != &oth) {
+    cleanup();
+    control_block = std::exchange(oth.control_block, nullptr);
+  }
+  return *this;
+}
+
+inline SharedStr::~SharedStr() {
+  cleanup();
+}
+
+//*   <--- observers --->
+
+inline const char* SharedStr::c_str() const noexcept {
+  return control_block != nullptr ? control_block->chars() : "";
+}
+
+inline std::string_view SharedStr::view() const noexcept {
+  return control_block != nullptr ? std::string_view(control_block->chars(), control_block->length) : std::string_view();
+}
+
+inline std::string SharedStr::str() const {
+  return std::string(view());
+}
+
+inline std::size_t SharedStr::size() const noexcept {
+  return control_block != nullptr ? control_block->length : 0;
+}
+
+inline bool SharedStr::empty() const noexcept {
+  return control_block == nullptr;
+}
+
+inline std::size_t SharedStr::counter_value() const noexcept {
+  return control_block != nullptr ? control_block->ref_count.load(std::memory_order_acquire) : 0;
+}
+
+inline bool SharedStr::operator==(const SharedStr& oth) const noexcept {
+  return control_block == oth.control_block || view() == oth.view();
+}
+
+} // namespace tmn;
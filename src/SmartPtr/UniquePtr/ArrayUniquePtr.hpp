@@ -43,7 +43,8 @@ public: //* methods:
   bool operator!=(std::nullptr_t) const noexcept;
 
   // Observers:
-  Result<T, err::EmptyArrErr> at(std::size_t index) const noexcept;
+  // Returns a reference to the element (no copy) or an error:
+  Result<T&, err::EmptyArrErr> at(std::size_t index) const noexcept;
 
   T& operator[](std::size_t index) &;
   const T& operator[](std::size_t index) const&;
@@ -3,6 +3,7 @@
 #endif
 
 #include "../../../include/SmartPtr/UniquePtr.hpp"
+#include "../../../include/Panic/Panic.hpp" // for: fail_runtime;
 
 namespace tmn {
 
@@ -43,8 +44,8 @@ Option<T*> UniquePtr<T[], std::default_delete<T[]>>::try_get_and_free() noexcept
 
 template <typename T>
 T* UniquePtr<T[], std::default_delete<T[]>>::get_and_free() {
-  if (!array_ptr) {
-    throw std::runtime_error("UniquePtr: no array to get");
+  if (!array_ptr) [[unlikely]] {
+    detail::fail_runtime("UniquePtr: no array to get");
   }
   return std::exchange(array_ptr, nullptr);
 }
@@ -75,8 +76,8 @@ Option<T*> UniquePtr<T[], std::default_delete<T[]>>::try_get() noexcept {
 
 template <typename T>
 T* UniquePtr<T[], std::default_delete<T[]>>::get() {
-  if (!array_ptr) {
-    throw std::runtime_error("UniquePtr: no array to get");
+  if (!array_ptr) [[unlikely]] {
+    detail::fail_runtime("UniquePtr: no array to get");
   }
 
   return array_ptr;
@@ -105,10 +106,10 @@ bool UniquePtr<T[], std::default_delete<T[]>>::operator!=(std::nullptr_t) const
 // <--- array-specific methods --->
 template <typename T>
 auto UniquePtr<T[], std::default_delete<T[]>>::at(std::size_t index) const noexcept
-  -> Result<T, err::EmptyArrErr>
+  -> Result<T&, err::EmptyArrErr>
 {
   if (!has_resource()) {
-    return Result<T, err::EmptyArrErr>::Err();
+    return Result<T&, err::EmptyArrErr>::Err();
   }
 
   // No bounds checking. User must use valid index.
@@ -118,13 +119,13 @@ auto UniquePtr<T[], std::default_delete<T[]>>::at(std::size_t index) const noexc
   // it is used for the proper operation of the idea of ownership in C++.
   // I think the most correct implementation in this case is to use a UniquePtr<T[]>
   // and size in the same container, for example, in an Array or Vector.
-  return Result<T, err::EmptyArrErr>::Ok(array_ptr[index]);
+  return Result<T&, err::EmptyArrErr>::Ok(array_ptr[index]);
 }
 
 template <typename T>
 T& UniquePtr<T[], std::default_delete<T[]>>::operator[](std::size_t index) & {
-  if (!has_resource()) {
-    throw std::runtime_error("UniquePtr: array is null");
+  if (!has_resource()) [[unlikely]] {
+    detail::fail_runtime("UniquePtr: array is null");
   }
 
   return array_ptr[index];
@@ -132,8 +133,8 @@ T& UniquePtr<T[], std::default_delete<T[]>>::operator[](std::size_t index) & {
 
 template <typename T>
 const T& UniquePtr<T[], std::default_delete<T[]>>::operator[](std::size_t index) const& {
-  if (!has_resource()) {
-    throw std::runtime_error("UniquePtr: array is null");
+  if (!has_resource()) [[unlikely]] {
+    detail::fail_runtime("UniquePtr: array is null");
   }
   return array_ptr[index];
 }
@@ -2,8 +2,12 @@
 #error "Include UniquePtr.hpp instead of MakeUniquePtr.tpp"
 #endif
 
+#include <new> // for: nothrow;
+#include <cstdint> // for: PTRDIFF_MAX;
+
 #include "../../../include/SmartPtr/UniquePtr.hpp"
 #include "../../../include/Result/Result.hpp"
+#include "../../../include/Panic/Panic.hpp" // for: fail_with;
 
 namespace tmn {
 
@@ -14,17 +18,15 @@ UniquePtr<T> make_unique_ptr(Args&&... args) {
 
 template <typename T>
 UniquePtr<T[]> make_unique_array_ptr(std::size_t size) {
-  if (size == 0){
-    throw err::InvalidArgErr("Array to be created must have a non-zero size");
+  if (size == 0) [[unlikely]] {
+    detail::fail_with<err::InvalidArgErr>(err::StaticMsg("Array to be created must have a non-zero size"));
   }
 
-  T* ptr = nullptr;
-
-  try {
-    ptr = new T[size];
-  }
-  catch(const std::bad_alloc& e){
-    throw err::BadAllocErr();
+  // the size is checked explicitly: `new (std::nothrow) T[size]` with an overflowing size
+  // still throws bad_array_new_length on some implementations;
+  T* ptr = size <= PTRDIFF_MAX / sizeof(T) ? new (std::nothrow) T[size] : nullptr;
+  if (ptr == nullptr) [[unlikely]] {
+    detail::fail_with<err::BadAllocErr>();
   }
 
   return UniquePtr<T[]>(ptr);
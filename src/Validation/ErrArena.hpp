@@ -0,0 +1,219 @@
+#ifndef TMN_THROWLESS_ERR_ARENA_HPP
+#define TMN_THROWLESS_ERR_ARENA_HPP
+
+#include <new> // for: operator new, operator delete, placement new, launder;
+#include <cstddef> // for: size_t, ptrdiff_t, byte, max_align_t;
+#include <utility> // for: move, forward;
+#include <iterator> // for: forward_iterator_tag;
+
+namespace tmn::detail {
+
+// Errors of a Validation in the order they were found. The first error is stored
+// inline (a failed field costs no allocation), the next ones in blocks allocated
+// with doubling capacity and linked in a list: the stored errors are never relocated,
+// and the blocks of an expiring list are spliced onto another one in O(1) (combining
+// the failures of many fields moves only their inline errors);
+template <typename E>
+class ErrArena {
+private: //* substructures:
+  struct Block {
+    Block* next = nullptr;
+    std::size_t capacity = 0;
+    std::size_t size = 0;
+
+    E* data() noexcept { return std::launder(reinterpret_cast<E*>(reinterpret_cast<std::byte*>(this) + header_size)); }
+    const E* data() const noexcept { return std::launder(reinterpret_cast<const E*>(reinterpret_cast<const std::byte*>(this) + header_size)); }
+  };
+
+  static_assert(alignof(E) <= alignof(std::max_align_t), "over-aligned error types are not supported");
+  static constexpr std::size_t header_size = (sizeof(Block) + alignof(E) - 1) / alignof(E) * alignof(E);
+  static constexpr std::size_t min_block_capacity = 4;
+
+private: //* fields:
+  alignas(E) std::byte inline_[sizeof(E)];
+  Block* head_ = nullptr;
+  Block* tail_ = nullptr;
+  std::size_t size_ = 0;
+
+private: //* methods:
+  E* inline_error() noexcept { return std::launder(reinterpret_cast<E*>(inline_)); }
+  const E* inline_error() const noexcept { return std::launder(reinterpret_cast<const E*>(inline_)); }
+
+  Block* allocate_block(std::size_t capacity) {
+    void* memory = ::operator new(header_size + capacity * sizeof(E));
+    Block* block = ::new (memory) Block{};
+    block->capacity = capacity;
+    return block;
+  }
+
+  // Leaves the list empty (the blocks are released);
+  void release() noexcept {
+    if (size_ != 0) inline_error()->~E();
+    for (Block* block = head_; block != nullptr;) {
+      Block* next = block->next;
+      for (std::size_t i = 0; i < block->size; ++i) block->data()[i].~E();
+      block->~Block();
+      ::operator delete(block);
+      block = next;
+    }
+    head_ = tail_ = nullptr;
+    size_ = 0;
+  }
+
+  // Takes over the state of `oth` (this list is empty);
+  void steal(ErrArena& oth) noexcept {
+    if (oth.size_ != 0) {
+      ::new (inline_) E(std::move(*oth.inline_error()));
+      oth.inline_error()->~E();
+    }
+    head_ = oth.head_;
+    tail_ = oth.tail_;
+    size_ = oth.size_;
+    oth.head_ = oth.tail_ = nullptr;
+    oth.size_ = 0;
+  }
+
+  template <typename... Args>
+  void emplace_back(Args&&... args) {
+    if (size_ == 0) {
+      ::new (inline_) E(std::forward<Args>(args)...);
+    }
+    else {
+      if (tail_ == nullptr || tail_->size == tail_->capacity) {
+        Block* block = allocate_block(size_ < min_block_capacity ? min_block_capacity : size_);
+        if (tail_ == nullptr) head_ = block;
+        else tail_->next = block;
+        tail_ = block;
+      }
+      ::new (tail_->data() + tail_->size) E(std::forward<Args>(args)...);
+      ++tail_->size;
+    }
+    ++size_;
+  }
+
+public: //* substructures:
+  class const_iterator {
+  private: //* fields:
+    // block_ == nullptr: the inline error (index_ == 0) or the end (index_ == 1);
+    const ErrArena* arena_ = nullptr;
+    const Block* block_ = nullptr;
+    std::size_t index_ = 1;
+
+  public: //* types:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = E;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const E*;
+    using reference = const E&;
+
+  public: //* methods:
+    const_iterator() = default;
+    const_iterator(const ErrArena* arena, const Block* block, std::size_t index) noexcept : arena_(arena), block_(block), index_(index) {}
+
+    const E& operator*() const noexcept { return block_ == nullptr ? *arena_->inline_error() : block_->data()[index_]; }
+    const E* operator->() const noexcept { return &**this; }
+
+    const_iterator& operator++() noexcept {
+      if (block_ == nullptr) block_ = arena_->head_;
+      else if (++index_ < block_->size) return *this;
+      else block_ = block_->next;
+
+      index_ = 0;
+      while (block_ != nullptr && block_->size == 0) block_ = block_->next;
+      if (block_ == nullptr) index_ = 1;
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+      return lhs.block_ == rhs.block_ && lhs.index_ == rhs.index_;
+    }
+  };
+
+public: //* methods:
+  ErrArena() noexcept {}
+  ~ErrArena() {
+    if (size_ != 0) release();
+  }
+
+  ErrArena(const ErrArena& oth) : ErrArena() {
+    for (const E& error : oth) emplace_back(error);
+  }
+
+  ErrArena(ErrArena&& oth) noexcept : ErrArena() { steal(oth); }
+
+  ErrArena& operator=(const ErrArena& oth) {
+    if (this != &oth) {
+      ErrArena copy(oth);
+      release();
+      steal(copy);
+    }
+    return *this;
+  }
+
+  ErrArena& operator=(ErrArena&& oth) noexcept {
+    if (this != &oth) {
+      release();
+      steal(oth);
+    }
+    return *this;
+  }
+
+  void push_back(const E& error) { emplace_back(error); }
+  void push_back(E&& error) { emplace_back(std::move(error)); }
+
+  // Errors of `oth` after the errors of this list; the blocks are spliced, not copied:
+  void append(ErrArena&& oth) {
+    if (oth.size_ == 0 || this == &oth) return;
+    if (size_ == 0) {
+      steal(oth);
+      return;
+    }
+
+    emplace_back(std::move(*oth.inline_error()));
+    oth.inline_error()->~E();
+    if (oth.head_ != nullptr) {
+      if (tail_ == nullptr) head_ = oth.head_;
+      else tail_->next = oth.head_;
+      tail_ = oth.tail_;
+    }
+    size_ += oth.size_ - 1;
+    oth.head_ = oth.tail_ = nullptr;
+    oth.size_ = 0;
+  }
+
+  void append(const ErrArena& oth) {
+    if (this == &oth) {
+      append(ErrArena(oth));
+      return;
+    }
+    for (const E& error : oth) emplace_back(error);
+  }
+
+  // Passes every error (as `E&&`) to `fn` and leaves the list empty:
+  template <typename Fn>
+  void drain(Fn&& fn) {
+    if (size_ != 0) fn(std::move(*inline_error()));
+    for (Block* block = head_; block != nullptr; block = block->next) {
+      for (std::size_t i = 0; i < block->size; ++i) fn(std::move(block->data()[i]));
+    }
+    release();
+  }
+
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const E& front() const noexcept { return *inline_error(); }
+
+  const_iterator begin() const noexcept { return size_ == 0 ? end() : const_iterator(this, nullptr, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, nullptr, 1); }
+};
+
+} // namespace tmn::detail;
+
+#endif // TMN_THROWLESS_ERR_ARENA_HPP
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <span>
+#include <vector>
+
+#include "../../include/Batch/Arithmetic.hpp"
+#include "../_TestUtils/RandomGenerator.hpp"
+
+namespace {
+
+// Random operands with None and zero values (about a quarter of each):
+template <typename T>
+std::vector<tmn::Option<T>> random_options(std::size_t count) {
+  std::vector<tmn::Option<T>> options(count);
+  for (auto& opt : options) {
+    const int kind = tmn::test_utils::generate_random_val(0, 3);
+    if (kind == 0) continue;
+    opt = tmn::Option<T>(kind == 1 ? T{0} : tmn::test_utils::generate_random_val<T>(T{1}, T{100}));
+  }
+  return options;
+}
+
+// Every supported SIMD level (the scalar fallback included):
+std::vector<tmn::batch::SimdLevel> simd_levels() {
+  std::vector<tmn::batch::SimdLevel> levels{tmn::batch::SimdLevel::Scalar};
+  if (tmn::batch::supported_simd_level() >= tmn::batch::SimdLevel::Avx2) levels.push_back(tmn::batch::SimdLevel::Avx2);
+  if (tmn::batch::supported_simd_level() >= tmn::batch::SimdLevel::Avx512) levels.push_back(tmn::batch::SimdLevel::Avx512);
+  return levels;
+}
+
+class BatchArithmeticFixture : public ::testing::Test {
+protected:
+  static constexpr std::size_t count = 1000; // not a multiple of the vector width or of 64
+
+  std::vector<tmn::Option<int>> int_lhs = random_options<int>(count);
+  std::vector<tmn::Option<int>> int_rhs = random_options<int>(count);
+  std::vector<tmn::Option<double>> double_lhs = random_options<double>(count);
+  std::vector<tmn::Option<double>> double_rhs = random_options<double>(count);
+
+  void TearDown() override { tmn::batch::set_simd_level(tmn::batch::supported_simd_level()); }
+};
+
+} // namespace;
+
+TEST_F(BatchArithmeticFixture, ArraysMatchScalarOperators) {
+  std::vector<tmn::Option<int>> out(count, tmn::Option<int>(-1));
+
+  EXPECT_EQ(tmn::batch::add(int_lhs, int_rhs, out), count);
+  for (std::size_t i = 0; i < count; ++i) EXPECT_EQ(out[i], int_lhs[i] + int_rhs[i]) << "index " << i;
+
+  tmn::batch::sub(int_lhs, int_rhs, out);
+  for (std::size_t i = 0; i < count; ++i) EXPECT_EQ(out[i], int_lhs[i] - int_rhs[i]) << "index " << i;
+
+  tmn::batch::mul(int_lhs, int_rhs, out);
+  for (std::size_t i = 0; i < count; ++i) EXPECT_EQ(out[i], int_lhs[i] * int_rhs[i]) << "index " << i;
+
+  tmn::batch::div(int_lhs, int_rhs, out);
+  for (std::size_t i = 0; i < count; ++i) EXPECT_EQ(out[i], int_lhs[i] / int_rhs[i]) << "index " << i;
+}
+
+TEST_F(BatchArithmeticFixture, IntegerDivisionByZeroIsNone) {
+  const std::vector<tmn::Option<int>> lhs{tmn::Option<int>(6), tmn::Option<int>(6), tmn::Option<int>()};
+  const std::vector<tmn::Option<int>> rhs{tmn::Option<int>(3), tmn::Option<int>(0), tmn::Option<int>(0)};
+  std::vector<tmn::Option<int>> out(3);
+
+  tmn::batch::div(std::span(lhs), std::span(rhs), std::span(out));
+  EXPECT_EQ(out[0], tmn::Option<int>(2));
+  EXPECT_FALSE(out[1].has_value());
+  EXPECT_FALSE(out[2].has_value());
+
+  // floating-point division by zero is not checked (as for the scalar operator):
+  const std::vector<tmn::Option<double>> one{tmn::Option<double>(1.0)};
+  const std::vector<tmn::Option<double>> zero{tmn::Option<double>(0.0)};
+  std::vector<tmn::Option<double>> inf(1);
+  tmn::batch::div(one, zero, inf);
+  EXPECT_TRUE(inf[0].has_value());
+}
+
+TEST_F(BatchArithmeticFixture, ArraysOfDifferentSizes) {
+  std::vector<tmn::Option<double>> out(count / 2);
+  EXPECT_EQ(tmn::batch::add(double_lhs, double_rhs, out), count / 2) << "Only the shortest array is processed";
+
+  std::vector<tmn::Option<double>> mixed(count);
+  std::vector<tmn::Option<int>> shorter(int_rhs.begin(), int_rhs.begin() + 10);
+  EXPECT_EQ(tmn::batch::mul(double_lhs, shorter, mixed), 10);
+  for (std::size_t i = 0; i < 10; ++i) EXPECT_EQ(mixed[i], double_lhs[i] * shorter[i]);
+}
+
+TEST_F(BatchArithmeticFixture, ColumnsMatchArraysOnEverySimdLevel) {
+  const tmn::OptionColumn<int> int_a(int_lhs), int_b(int_rhs);
+  const tmn::OptionColumn<double> double_a(double_lhs), double_b(double_rhs);
+
+  std::vector<tmn::Option<int>> int_expected(count);
+  std::vector<tmn::Option<double>> double_expected(count);
+
+  for (const auto level : simd_levels()) {
+    tmn::batch::set_simd_level(level);
+    SCOPED_TRACE(static_cast<int>(level));
+
+    tmn::batch::add(int_lhs, int_rhs, int_expected);
+    EXPECT_EQ(tmn::batch::add(int_a, int_b).to_options(), int_expected);
+
+    tmn::batch::div(int_lhs, int_rhs, int_expected);
+    EXPECT_EQ(tmn::batch::div(int_a, int_b).to_options(), int_expected);
+
+    tmn::batch::mul(double_lhs, double_rhs, double_expected);
+    EXPECT_EQ(tmn::batch::mul(double_a, double_b).to_options(), double_expected);
+
+    tmn::batch::sub(double_lhs, double_rhs, double_expected);
+    EXPECT_EQ(tmn::batch::sub(double_a, double_b).to_options(), double_expected);
+  }
+}
+
+TEST_F(BatchArithmeticFixture, ColumnsOfDifferentSizes) {
+  const tmn::OptionColumn<int> longer(int_lhs);
+  const tmn::OptionColumn<int> shorter(std::vector<tmn::Option<int>>(int_rhs.begin(), int_rhs.begin() + 70));
+
+  const auto sum = tmn::batch::add(longer, shorter);
+  ASSERT_EQ(sum.size(), 70);
+  std::size_t expected_some = 0;
+  for (std::size_t i = 0; i < 70; ++i) {
+    EXPECT_EQ(sum.get(i), int_lhs[i] + int_rhs[i]);
+    expected_some += (int_lhs[i] + int_rhs[i]).has_value() ? 1 : 0;
+  }
+  EXPECT_EQ(sum.count_some(), expected_some) << "Bits past the end of the result are cleared";
+}
+
+TEST_F(BatchArithmeticFixture, NoneSlotsOfTheResultHoldZero) {
+  const tmn::OptionColumn<int> none_lhs(std::vector<tmn::Option<int>>{tmn::Option<int>(), tmn::Option<int>(7)});
+  const tmn::OptionColumn<int> some_rhs(std::vector<tmn::Option<int>>{tmn::Option<int>(5), tmn::Option<int>(0)});
+
+  const auto sum = tmn::batch::add(none_lhs, some_rhs);
+  EXPECT_EQ(sum.count_some(), 1U);
+  EXPECT_EQ(sum.values()[0], 0) << "None + Some(5)";
+
+  const auto quotient = tmn::batch::div(some_rhs, none_lhs);
+  EXPECT_EQ(quotient.count_some(), 1U);
+  EXPECT_EQ(quotient.values()[0], 0) << "Some(5) / None";
+  EXPECT_EQ(quotient.values()[1], 0) << "Some(0) / Some(7) is Some(0)";
+
+  const tmn::OptionColumn<int> a(int_lhs), b(int_rhs);
+  const auto product = tmn::batch::mul(a, b);
+  for (std::size_t i = 0; i < product.size(); ++i) {
+    if (product.is_none(i)) {
+      EXPECT_EQ(product.values()[i], 0) << "index " << i;
+    }
+  }
+}
+
+TEST(BatchSimdLevel, LevelIsClampedToTheSupportedOne) {
+  const auto previous = tmn::batch::set_simd_level(tmn::batch::SimdLevel::Avx512);
+  EXPECT_LE(tmn::batch::simd_level(), tmn::batch::supported_simd_level());
+  tmn::batch::set_simd_level(previous);
+}
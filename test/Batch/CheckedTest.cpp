@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+#include "../../include/Batch/Checked.hpp"
+#include "../_TestUtils/RandomGenerator.hpp"
+
+namespace {
+
+// Random operands around the limits of T (a quarter of None), so every operation overflows now and then:
+template <typename T>
+std::vector<tmn::Option<T>> random_extreme_options(std::size_t count) {
+  // drawn as (unsigned) long long: uniform_int_distribution does not take the 8-bit types;
+  using Draw = std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>;
+  constexpr Draw min = std::numeric_limits<T>::min();
+  constexpr Draw max = std::numeric_limits<T>::max();
+
+  std::vector<tmn::Option<T>> options(count);
+  for (auto& opt : options) {
+    const int kind = tmn::test_utils::generate_random_val(0, 3);
+    if (kind == 0) continue;
+    if (kind == 1) opt = tmn::Option<T>(static_cast<T>(tmn::test_utils::generate_random_val<Draw>(min, max)));
+    else opt = tmn::Option<T>(static_cast<T>(tmn::test_utils::generate_random_val<Draw>(min / 16, max / 16)));
+  }
+  return options;
+}
+
+std::vector<tmn::batch::SimdLevel> simd_levels() {
+  std::vector<tmn::batch::SimdLevel> levels{tmn::batch::SimdLevel::Scalar};
+  if (tmn::batch::supported_simd_level() >= tmn::batch::SimdLevel::Avx2) levels.push_back(tmn::batch::SimdLevel::Avx2);
+  if (tmn::batch::supported_simd_level() >= tmn::batch::SimdLevel::Avx512) levels.push_back(tmn::batch::SimdLevel::Avx512);
+  return levels;
+}
+
+template <typename T>
+void expect_arrays_match_scalar(std::size_t count) {
+  const auto lhs = random_extreme_options<T>(count);
+  const auto rhs = random_extreme_options<T>(count);
+  std::vector<tmn::Option<T>> out(count);
+
+  EXPECT_EQ(tmn::batch::checked_add(lhs, rhs, out), count);
+  for (std::size_t i = 0; i < count; ++i) ASSERT_EQ(out[i], tmn::checked_add(lhs[i], rhs[i])) << "index " << i;
+
+  tmn::batch::checked_sub(lhs, rhs, out);
+  for (std::size_t i = 0; i < count; ++i) ASSERT_EQ(out[i], tmn::checked_sub(lhs[i], rhs[i])) << "index " << i;
+
+  tmn::batch::checked_mul(lhs, rhs, out);
+  for (std::size_t i = 0; i < count; ++i) ASSERT_EQ(out[i], tmn::checked_mul(lhs[i], rhs[i])) << "index " << i;
+
+  for (const auto level : simd_levels()) {
+    tmn::batch::set_simd_level(level);
+    const tmn::OptionColumn<T> lhs_column(lhs), rhs_column(rhs);
+
+    const auto sums = tmn::batch::checked_add(lhs_column, rhs_column);
+    const auto diffs = tmn::batch::checked_sub(lhs_column, rhs_column);
+    const auto products = tmn::batch::checked_mul(lhs_column, rhs_column);
+    for (std::size_t i = 0; i < count; ++i) {
+      ASSERT_EQ(sums.get(i), tmn::checked_add(lhs[i], rhs[i])) << "index " << i;
+      ASSERT_EQ(diffs.get(i), tmn::checked_sub(lhs[i], rhs[i])) << "index " << i;
+      ASSERT_EQ(products.get(i), tmn::checked_mul(lhs[i], rhs[i])) << "index " << i;
+    }
+  }
+  tmn::batch::set_simd_level(tmn::batch::supported_simd_level());
+}
+
+} // namespace;
+
+TEST(BatchCheckedTest, ArraysAndColumnsMatchScalarChecks) {
+  expect_arrays_match_scalar<std::int8_t>(1000);
+  expect_arrays_match_scalar<std::int32_t>(1000);
+  expect_arrays_match_scalar<std::uint32_t>(1000);
+  expect_arrays_match_scalar<std::int64_t>(1000);
+  expect_arrays_match_scalar<std::uint64_t>(1000);
+}
+
+TEST(BatchCheckedTest, SumIsTheExactSumWhenItFits) {
+  constexpr std::int64_t max = std::numeric_limits<std::int64_t>::max();
+
+  std::vector<tmn::Option<std::int64_t>> values(10000, tmn::Option<std::int64_t>(3));
+  EXPECT_EQ(tmn::batch::checked_sum(values), tmn::Option<std::int64_t>(30000));
+
+  // a partial sum leaves the range, the total does not (the block is summed in 128 bits):
+  values[10] = tmn::Option<std::int64_t>(max);
+  values[20] = tmn::Option<std::int64_t>(max);
+  values[5000] = tmn::Option<std::int64_t>(-max);
+  values[9000] = tmn::Option<std::int64_t>(-max);
+  EXPECT_EQ(tmn::batch::checked_sum(values), tmn::Option<std::int64_t>(30000 - 12));
+
+  values[9000] = tmn::Option<std::int64_t>(3);
+  EXPECT_FALSE(tmn::batch::checked_sum(values).has_value());
+
+  values[9000] = tmn::Option<std::int64_t>(-max);
+  values[7] = tmn::Option<std::int64_t>();
+  EXPECT_FALSE(tmn::batch::checked_sum(values).has_value());
+
+  // None and overflow in the last elements of a block (after the groups of 4):
+  std::vector<tmn::Option<std::int64_t>> tail(4099, tmn::Option<std::int64_t>(1));
+  EXPECT_EQ(tmn::batch::checked_sum(tail), tmn::Option<std::int64_t>(4099));
+  tail[4098] = tmn::Option<std::int64_t>(max);
+  tail[4097] = tmn::Option<std::int64_t>(max);
+  EXPECT_FALSE(tmn::batch::checked_sum(tail).has_value());
+  tail[4097] = tmn::Option<std::int64_t>(-max);
+  EXPECT_EQ(tmn::batch::checked_sum(tail), tmn::Option<std::int64_t>(4097));
+  tail[4098] = tmn::Option<std::int64_t>();
+  EXPECT_FALSE(tmn::batch::checked_sum(tail).has_value());
+
+  EXPECT_EQ(tmn::batch::checked_sum(std::vector<tmn::Option<std::int64_t>>{}), tmn::Option<std::int64_t>(0));
+}
+
+TEST(BatchCheckedTest, ColumnSumOnEverySimdLevel) {
+  tmn::OptionColumn<std::int32_t> column;
+  for (int i = 0; i < 5000; ++i) column.push_back(i % 2 == 0 ? 400000 : -1);
+
+  for (const auto level : simd_levels()) {
+    tmn::batch::set_simd_level(level);
+    EXPECT_EQ(tmn::batch::checked_sum(column), tmn::Option<std::int32_t>(2500 * 400000 - 2500)) << static_cast<int>(level);
+
+    auto overflowing = column;
+    overflowing.push_back(std::numeric_limits<std::int32_t>::max());
+    EXPECT_FALSE(tmn::batch::checked_sum(overflowing).has_value());
+
+    auto with_none = column;
+    with_none.set_none(3);
+    EXPECT_FALSE(tmn::batch::checked_sum(with_none).has_value());
+  }
+  tmn::batch::set_simd_level(tmn::batch::supported_simd_level());
+
+  tmn::OptionColumn<std::uint64_t> large;
+  for (int i = 0; i < 4; ++i) large.push_back(std::numeric_limits<std::uint64_t>::max() / 4);
+  EXPECT_EQ(tmn::batch::checked_sum(large), tmn::Option<std::uint64_t>(std::numeric_limits<std::uint64_t>::max() / 4 * 4));
+  large.push_back(std::uint64_t{4});
+  EXPECT_FALSE(tmn::batch::checked_sum(large).has_value());
+}
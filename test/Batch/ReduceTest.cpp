@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+#include <numeric>
+#include <functional>
+
+#include "../../include/Batch/Reduce.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../_TestUtils/RandomGenerator.hpp"
+
+namespace {
+
+struct IndexErr {
+  std::size_t index = 0;
+
+  std::string err_msg() const { return "Failed at " + std::to_string(index); }
+  const char* what() const noexcept { return "IndexErr"; }
+
+  bool operator==(const IndexErr& oth) const noexcept = default;
+};
+
+// Thread counts and chunk sizes: one chunk, more chunks than threads, more threads than chunks:
+const std::vector<tmn::batch::ParallelConfig> configs{
+  {.threads = 1, .grain = 1 << 20},
+  {.threads = 1, .grain = 100},
+  {.threads = 4, .grain = 100},
+  {.threads = 32, .grain = 1000},
+  {.threads = 0, .grain = 7},
+};
+
+class BatchReduceFixture : public ::testing::Test {
+protected:
+  static constexpr std::size_t count = 10007;
+
+  std::vector<tmn::Option<long>> longs = [] {
+    std::vector<tmn::Option<long>> result;
+    for (std::size_t i = 0; i < count; ++i) result.emplace_back(tmn::test_utils::generate_random_val(-1000L, 1000L));
+    return result;
+  }();
+
+  long expected_sum() const {
+    long sum = 0;
+    for (const auto& opt : longs) sum += opt.value();
+    return sum;
+  }
+};
+
+} // namespace;
+
+TEST_F(BatchReduceFixture, SumMatchesSequentialFold) {
+  for (const auto& config : configs) {
+    EXPECT_EQ(tmn::batch::parallel_reduce(longs, std::plus<>{}, config), tmn::Option<long>(expected_sum()));
+    EXPECT_EQ(tmn::batch::parallel_reduce(longs, 5L, std::plus<>{}, config), tmn::Option<long>(expected_sum() + 5));
+  }
+}
+
+TEST_F(BatchReduceFixture, NonePropagatesLikeTheMonoidOperators) {
+  longs[count - 1] = tmn::Option<long>();
+  for (const auto& config : configs) {
+    EXPECT_FALSE(tmn::batch::parallel_reduce(longs, std::plus<>{}, config).has_value());
+    EXPECT_FALSE(tmn::batch::parallel_reduce(longs, 0L, std::multiplies<>{}, config).has_value());
+  }
+
+  tmn::Option<long> folded(0L);
+  for (const auto& opt : longs) folded += opt;
+  EXPECT_FALSE(folded.has_value());
+}
+
+TEST_F(BatchReduceFixture, EmptyRange) {
+  const std::vector<tmn::Option<long>> empty;
+  EXPECT_FALSE(tmn::batch::parallel_reduce(empty, std::plus<>{}).has_value());
+  EXPECT_EQ(tmn::batch::parallel_reduce(empty, 42L, std::plus<>{}), tmn::Option<long>(42L));
+
+  const std::vector<tmn::Result<long, IndexErr>> no_results;
+  EXPECT_EQ(tmn::batch::try_reduce(no_results, 42L, std::plus<>{}).unwrap_value(), 42L);
+}
+
+TEST_F(BatchReduceFixture, FloatingPointResultDoesNotDependOnThreads) {
+  std::vector<tmn::Option<double>> doubles;
+  for (std::size_t i = 0; i < count; ++i) doubles.emplace_back(tmn::test_utils::generate_random_val(-1.0, 1.0) * 1e10);
+
+  const auto single = tmn::batch::parallel_reduce(doubles, std::plus<>{}, {.threads = 1, .grain = 64});
+  for (std::size_t threads : {2, 3, 8, 32}) {
+    EXPECT_EQ(tmn::batch::parallel_reduce(doubles, std::plus<>{}, {.threads = threads, .grain = 64}), single);
+  }
+}
+
+TEST_F(BatchReduceFixture, OrderIsKeptForNonCommutativeOp) {
+  std::vector<tmn::Option<std::string>> parts;
+  std::string expected;
+  for (std::size_t i = 0; i < 500; ++i) {
+    parts.emplace_back(std::to_string(i));
+    expected += std::to_string(i);
+  }
+
+  for (const auto& config : configs) {
+    EXPECT_EQ(tmn::batch::parallel_reduce(parts, std::plus<>{}, config), tmn::Option<std::string>(expected));
+  }
+}
+
+TEST_F(BatchReduceFixture, TryReduceReturnsTheFirstError) {
+  std::vector<tmn::Result<long, IndexErr>> results;
+  long sum = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    results.push_back(tmn::Result<long, IndexErr>::Ok(static_cast<long>(i)));
+    sum += static_cast<long>(i);
+  }
+
+  for (const auto& config : configs) {
+    EXPECT_EQ(tmn::batch::try_reduce(results, 0L, std::plus<>{}, config).unwrap_value(), sum);
+  }
+
+  // the later error is in an earlier-finishing position for most chunkings:
+  results[9000] = tmn::Result<long, IndexErr>::Err(IndexErr{9000});
+  results[150] = tmn::Result<long, IndexErr>::Err(IndexErr{150});
+  for (const auto& config : configs) {
+    const auto reduced = tmn::batch::try_reduce(results, 0L, std::plus<>{}, config);
+    ASSERT_TRUE(reduced.is_err());
+    EXPECT_EQ(reduced.unwrap_err(), IndexErr{150});
+  }
+}
+
+TEST_F(BatchReduceFixture, WorkersAreKeptBetweenCalls) {
+  const tmn::batch::ParallelConfig config{.threads = 4, .grain = 100};
+  EXPECT_EQ(tmn::batch::parallel_reduce(longs, std::plus<>{}, config), tmn::Option<long>(expected_sum()));
+  const std::size_t started = tmn::detail::ChunkWorkers::instance().size();
+  EXPECT_GE(started, 3U);
+
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(tmn::batch::parallel_reduce(longs, std::plus<>{}, config), tmn::Option<long>(expected_sum()));
+  }
+  EXPECT_EQ(tmn::detail::ChunkWorkers::instance().size(), started);
+}
+
+TEST_F(BatchReduceFixture, NestedCallsDoNotWaitForBusyWorkers) {
+  std::vector<tmn::Option<long>> sums(64);
+  tmn::detail::run_chunks(sums.size(), {.threads = 8, .grain = 1}, [&](std::size_t chunk, std::size_t, std::size_t) {
+    sums[chunk] = tmn::batch::parallel_reduce(longs, std::plus<>{}, {.threads = 8, .grain = 100});
+  });
+  for (const auto& sum : sums) EXPECT_EQ(sum, tmn::Option<long>(expected_sum()));
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "../../include/Batch/Select.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../_TestUtils/RandomGenerator.hpp"
+
+namespace {
+
+struct IntCodeErr {
+  int code = 0;
+
+  std::string err_msg() const { return "Error code: " + std::to_string(code); }
+  const char* what() const noexcept { return "IntCodeErr"; }
+
+  bool operator==(const IntCodeErr& oth) const noexcept = default;
+};
+
+// About a third of the elements are None:
+template <typename T>
+std::vector<tmn::Option<T>> random_options(std::size_t count) {
+  std::vector<tmn::Option<T>> options(count);
+  for (auto& opt : options) {
+    if (tmn::test_utils::generate_random_val(0, 2) == 0) continue;
+    opt = tmn::Option<T>(tmn::test_utils::generate_random_val<T>(T{-1000}, T{1000}));
+  }
+  return options;
+}
+
+template <typename T>
+std::vector<T> naive_compact(const std::vector<tmn::Option<T>>& options) {
+  std::vector<T> result;
+  for (const auto& opt : options) {
+    if (opt.has_value()) result.push_back(opt.value());
+  }
+  return result;
+}
+
+std::vector<tmn::batch::SimdLevel> simd_levels() {
+  std::vector<tmn::batch::SimdLevel> levels{tmn::batch::SimdLevel::Scalar};
+  if (tmn::batch::supported_simd_level() >= tmn::batch::SimdLevel::Avx2) levels.push_back(tmn::batch::SimdLevel::Avx2);
+  if (tmn::batch::supported_simd_level() >= tmn::batch::SimdLevel::Avx512) levels.push_back(tmn::batch::SimdLevel::Avx512);
+  return levels;
+}
+
+class BatchSelectFixture : public ::testing::Test {
+protected:
+  static constexpr std::size_t count = 1001; // not a multiple of the vector width or of 64
+
+  std::vector<tmn::Option<int>> ints = random_options<int>(count);
+  std::vector<tmn::Option<double>> doubles = random_options<double>(count);
+  std::vector<tmn::Option<std::int16_t>> shorts = random_options<std::int16_t>(count);
+
+  void TearDown() override { tmn::batch::set_simd_level(tmn::batch::supported_simd_level()); }
+};
+
+} // namespace;
+
+TEST_F(BatchSelectFixture, CompactSomeArraysKeepOrder) {
+  EXPECT_EQ(tmn::batch::compact_some(ints), naive_compact(ints));
+  EXPECT_EQ(tmn::batch::compact_some(doubles), naive_compact(doubles));
+  EXPECT_EQ(tmn::batch::compact_some(std::span<const tmn::Option<std::int16_t>>(shorts)), naive_compact(shorts));
+}
+
+TEST_F(BatchSelectFixture, CompactSomeEdgeCases) {
+  EXPECT_TRUE(tmn::batch::compact_some(std::vector<tmn::Option<int>>{}).empty());
+  EXPECT_TRUE(tmn::batch::compact_some(std::vector<tmn::Option<int>>(100)).empty());
+
+  std::vector<tmn::Option<int>> all_some(100, tmn::Option<int>(7));
+  EXPECT_EQ(tmn::batch::compact_some(all_some), std::vector<int>(100, 7));
+}
+
+TEST_F(BatchSelectFixture, CompactSomeNonTrivialPayload) {
+  std::vector<tmn::Option<std::string>> strings{
+    tmn::Option<std::string>("a"), tmn::Option<std::string>(), tmn::Option<std::string>("b"), tmn::Option<std::string>()
+  };
+  EXPECT_EQ(tmn::batch::compact_some(strings), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST_F(BatchSelectFixture, CompactSomeColumnOnEverySimdLevel) {
+  const tmn::OptionColumn<int> int_column(ints);
+  const tmn::OptionColumn<double> double_column(doubles);
+  const tmn::OptionColumn<std::int16_t> short_column(shorts);
+
+  for (const auto level : simd_levels()) {
+    tmn::batch::set_simd_level(level);
+    EXPECT_EQ(tmn::batch::compact_some(int_column), naive_compact(ints)) << "level " << static_cast<int>(level);
+    EXPECT_EQ(tmn::batch::compact_some(double_column), naive_compact(doubles)) << "level " << static_cast<int>(level);
+    EXPECT_EQ(tmn::batch::compact_some(short_column), naive_compact(shorts)) << "level " << static_cast<int>(level);
+  }
+}
+
+TEST_F(BatchSelectFixture, SelectMaskIgnoresBitsPastTheValues) {
+  const std::vector<long> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  const std::vector<std::uint64_t> mask{~std::uint64_t{0}}; // bits past 10 are set too
+
+  for (const auto level : simd_levels()) {
+    tmn::batch::set_simd_level(level);
+    EXPECT_EQ(tmn::batch::select_mask(values, mask), values);
+  }
+
+  // 70 values, only the first 64 are covered by one word:
+  const std::vector<long> longer(70, 1);
+  EXPECT_EQ(tmn::batch::select_mask(longer, mask).size(), 64U);
+}
+
+TEST_F(BatchSelectFixture, SelectMaskNonTrivialPayload) {
+  const std::vector<std::string> values{"a", "b", "c", "d"};
+  const std::vector<std::uint64_t> mask{0b1010};
+  EXPECT_EQ(tmn::batch::select_mask(values, mask), (std::vector<std::string>{"b", "d"}));
+}
+
+TEST_F(BatchSelectFixture, PartitionResultsKeepsOrder) {
+  std::vector<tmn::Result<int, IntCodeErr>> results;
+  std::vector<int> expected_oks;
+  std::vector<IntCodeErr> expected_errs;
+  for (std::size_t i = 0; i < count; ++i) {
+    const int value = tmn::test_utils::generate_random_val(-1000, 1000);
+    if (value % 5 == 0) {
+      results.push_back(tmn::Result<int, IntCodeErr>::Err(IntCodeErr{value}));
+      expected_errs.push_back(IntCodeErr{value});
+    }
+    else {
+      results.push_back(tmn::Result<int, IntCodeErr>::Ok(value));
+      expected_oks.push_back(value);
+    }
+  }
+
+  const auto parts = tmn::batch::partition_results(results);
+  EXPECT_EQ(parts.oks, expected_oks);
+  EXPECT_EQ(parts.errs, expected_errs);
+}
+
+TEST_F(BatchSelectFixture, PartitionResultsNonTrivialPayload) {
+  std::vector<tmn::Result<std::string, IntCodeErr>> results;
+  results.push_back(tmn::Result<std::string, IntCodeErr>::Ok("first"));
+  results.push_back(tmn::Result<std::string, IntCodeErr>::Err(IntCodeErr{1}));
+  results.push_back(tmn::Result<std::string, IntCodeErr>::Ok("second"));
+
+  const auto parts = tmn::batch::partition_results(results);
+  EXPECT_EQ(parts.oks, (std::vector<std::string>{"first", "second"}));
+  EXPECT_EQ(parts.errs, (std::vector<IntCodeErr>{IntCodeErr{1}}));
+}
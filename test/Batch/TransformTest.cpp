@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../../include/Batch/Transform.hpp"
+#include "../../include/Error/Error.hpp"
+
+namespace {
+
+struct ParseErr {
+  std::string input;
+
+  std::string err_msg() const { return "not a number: " + input; }
+  const char* what() const noexcept { return "ParseErr"; }
+
+  bool operator==(const ParseErr& oth) const noexcept = default;
+};
+
+tmn::Result<int, ParseErr> parse(const std::string& text) {
+  if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+    return tmn::Result<int, ParseErr>::Err(ParseErr{text});
+  }
+  return tmn::Result<int, ParseErr>::Ok(std::stoi(text));
+}
+
+const std::vector<tmn::batch::ParallelConfig> configs{
+  {.threads = 1, .grain = 1 << 20},
+  {.threads = 1, .grain = 64},
+  {.threads = 4, .grain = 64},
+  {.threads = 32, .grain = 500},
+  {.threads = 0, .grain = 3},
+};
+
+class BatchTransformFixture : public ::testing::Test {
+protected:
+  static constexpr std::size_t count = 5003;
+
+  std::vector<std::string> lines = [] {
+    std::vector<std::string> result;
+    for (std::size_t i = 0; i < count; ++i) result.push_back(std::to_string(i * 7));
+    return result;
+  }();
+};
+
+} // namespace;
+
+TEST_F(BatchTransformFixture, WritesEveryValue) {
+  for (const auto& config : configs) {
+    std::vector<int> numbers(count, -1);
+    ASSERT_TRUE(tmn::batch::try_transform(config, lines, numbers, parse).is_ok());
+    for (std::size_t i = 0; i < count; ++i) EXPECT_EQ(numbers[i], static_cast<int>(i * 7)) << "index " << i;
+  }
+}
+
+TEST_F(BatchTransformFixture, ReportsTheFirstErrorWithItsIndex) {
+  lines[4000] = "x";
+  lines[321] = "12a";
+
+  for (const auto& config : configs) {
+    std::vector<int> numbers(count, -1);
+    const auto status = tmn::batch::try_transform(config, lines, numbers, parse);
+    ASSERT_TRUE(status.is_err());
+    EXPECT_EQ(status.unwrap_err().index, 321U);
+    EXPECT_EQ(status.unwrap_err().error, ParseErr{"12a"});
+    EXPECT_EQ(status.unwrap_err().err_msg(), "element 321: not a number: 12a");
+    EXPECT_STREQ(status.unwrap_err().what(), "element 321: not a number: 12a");
+
+    // everything before the error is written:
+    for (std::size_t i = 0; i < 321; ++i) EXPECT_EQ(numbers[i], static_cast<int>(i * 7)) << "index " << i;
+  }
+}
+
+TEST_F(BatchTransformFixture, InPlaceForm) {
+  const auto parse_into = [](const std::string& text, long& out) -> tmn::Result<void, ParseErr> {
+    auto parsed = parse(text);
+    if (parsed.is_err()) return tmn::Result<void, ParseErr>::Err(parsed.unwrap_err());
+    out = parsed.unwrap_value() * 2L;
+    return tmn::Result<void, ParseErr>::Ok();
+  };
+
+  std::vector<long> numbers(count);
+  ASSERT_TRUE(tmn::batch::try_transform(lines, numbers, parse_into).is_ok());
+  for (std::size_t i = 0; i < count; ++i) EXPECT_EQ(numbers[i], static_cast<long>(i * 14));
+
+  lines[17] = "";
+  const auto status = tmn::batch::try_transform({.threads = 4, .grain = 8}, lines, numbers, parse_into);
+  ASSERT_TRUE(status.is_err());
+  EXPECT_EQ(status.unwrap_err().index, 17U);
+}
+
+TEST_F(BatchTransformFixture, ShorterOutputLimitsTheWork) {
+  lines[100] = "x";
+  std::vector<int> numbers(100);
+  EXPECT_TRUE(tmn::batch::try_transform(lines, numbers, parse).is_ok());
+  EXPECT_EQ(numbers[99], 99 * 7);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../../include/Error/Boxed.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Result/Result.hpp"
+
+static_assert(tmn::err::Error<tmn::err::Boxed<tmn::err::AnyErr>>, "Boxed<AnyErr> must satisfy Error concept");
+static_assert(sizeof(tmn::err::Boxed<tmn::err::AnyErr>) == sizeof(void*), "Boxed<E> must keep only a pointer inline");
+static_assert(sizeof(tmn::Result<int, tmn::err::Boxed<tmn::err::AnyErr>>) == 2 * sizeof(void*),
+  "Result<int, Boxed<AnyErr>> must fit in two machine words");
+
+TEST(BoxedErrTest, ForwardsErrorInterface) {
+  tmn::err::Boxed<tmn::err::OutOfRangeErr> boxed(tmn::err::OutOfRangeErr(5, 3));
+
+  EXPECT_EQ(boxed.err_msg(), "Index 5 out of range in [0, 3)");
+  EXPECT_STREQ(boxed.what(), "Index 5 out of range in [0, 3)");
+  EXPECT_EQ(boxed->index(), 5u);
+  EXPECT_EQ(boxed.get().size(), 3u);
+}
+
+TEST(BoxedErrTest, CopyIsDeepAndMoveStealsPointer) {
+  tmn::err::Boxed<tmn::err::StrErr> original("boxed message");
+  tmn::err::Boxed<tmn::err::StrErr> copied = original;
+
+  EXPECT_EQ(copied, original);
+  EXPECT_NE(&copied.get(), &original.get());
+
+  const tmn::err::StrErr* address = &original.get();
+  tmn::err::Boxed<tmn::err::StrErr> moved = std::move(original);
+  EXPECT_EQ(&moved.get(), address);
+  EXPECT_EQ(moved.err_msg(), "boxed message");
+}
+
+TEST(BoxedErrTest, ResultWithBoxedErr) {
+  using BoxedResult = tmn::Result<int, tmn::err::Boxed<tmn::err::AnyErr>>;
+
+  BoxedResult ok = BoxedResult::Ok(42);
+  ASSERT_TRUE(ok.is_ok());
+  EXPECT_EQ(ok.unwrap_value(), 42);
+
+  BoxedResult err = BoxedResult::Err("cold failure");
+  ASSERT_TRUE(err.is_err());
+  EXPECT_EQ(err.unwrap_err().err_msg(), "cold failure");
+
+  auto mapped = err.fmap([](int x) { return x + 1; });
+  ASSERT_TRUE(mapped.is_err());
+  EXPECT_EQ(mapped.unwrap_err(), err.unwrap_err());
+}
+
+TEST(BoxedErrTest, MovedFromHoldsNoError) {
+  tmn::err::Boxed<tmn::err::StrErr> original("boxed message");
+  const tmn::err::Boxed<tmn::err::StrErr> moved = std::move(original);
+
+  EXPECT_FALSE(moved.empty());
+  EXPECT_TRUE(original.empty());
+  EXPECT_EQ(original.err_msg(), "");
+  EXPECT_STREQ(original.what(), "");
+#ifndef NDEBUG
+  EXPECT_DEATH((void)original.get(), "access to the error of a moved-from object");
+  EXPECT_DEATH((void)*original, "access to the error of a moved-from object");
+#endif
+
+  original = moved;
+  EXPECT_EQ(original.get(), moved.get());
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+
+#include "../../include/Error/CodeErr.hpp"
+#include "../../include/Result/Result.hpp"
+
+enum class ParseCode { UnexpectedEof = 1, BadDigit, Overflow };
+
+enum class NetCode : std::uint16_t { Refused = 10, Timeout = 20, Reset = 40 };
+
+template <>
+struct tmn::err::ErrCodeCategory<ParseCode> {
+  static constexpr const char* name = "parse";
+  static constexpr auto messages = tmn::err::code_messages<ParseCode>({
+    {ParseCode::Overflow,      "Number does not fit into the type"},
+    {ParseCode::UnexpectedEof, "Unexpected end of input"},
+    {ParseCode::BadDigit,      "Invalid digit"},
+  });
+};
+
+template <>
+struct tmn::err::ErrCodeCategory<NetCode> {
+  static constexpr const char* name = "net";
+  static constexpr auto messages = tmn::err::code_messages<NetCode>({
+    {NetCode::Refused, "Connection refused"},
+    {NetCode::Timeout, "Timed out"},
+    {NetCode::Reset,   "Connection reset"},
+  });
+};
+
+using ParseErr = tmn::err::CodeErr<ParseCode>;
+using NetErr = tmn::err::CodeErr<NetCode>;
+
+static_assert(tmn::err::Error<ParseErr>);
+static_assert(std::is_trivially_copyable_v<ParseErr>);
+static_assert(sizeof(ParseErr) == 4);
+static_assert(sizeof(NetErr) == 2);
+static_assert(sizeof(tmn::Result<int, ParseErr>) == 8, "Result<int, CodeErr> must stay 8 bytes");
+
+// Messages are resolved at compile time:
+static_assert(std::string_view(ParseErr(ParseCode::BadDigit).what()) == "Invalid digit");
+static_assert(std::string_view(NetErr(NetCode::Reset).what()) == "Connection reset");
+static_assert(std::string_view(NetErr(static_cast<NetCode>(15)).what()) == "Unknown error code");
+
+TEST(CodeErrTest, MessagesAndComparison) {
+  ParseErr err = ParseCode::Overflow;
+  EXPECT_EQ(err.code(), ParseCode::Overflow);
+  EXPECT_EQ(err.value(), 3);
+  EXPECT_STREQ(ParseErr::category(), "parse");
+  EXPECT_EQ(std::string(err.err_msg()), "Number does not fit into the type");
+  EXPECT_STREQ(ParseErr(static_cast<ParseCode>(0)).what(), "Unknown error code");
+
+  EXPECT_EQ(err, ParseCode::Overflow);
+  EXPECT_NE(err, ParseErr(ParseCode::BadDigit));
+
+  char buffer[8];
+  EXPECT_EQ(err.write_msg(buffer), 33);
+  EXPECT_STREQ(buffer, "Number ");
+}
+
+TEST(CodeErrTest, InResult) {
+  auto parse_digit = [](char c) -> tmn::Result<int, ParseErr> {
+    if (c < '0' || c > '9') return tmn::Result<int, ParseErr>::Err(ParseCode::BadDigit);
+    return tmn::Result<int, ParseErr>::Ok(c - '0');
+  };
+
+  EXPECT_EQ(parse_digit('7').unwrap_value(), 7);
+  EXPECT_EQ(parse_digit('x').unwrap_err(), ParseCode::BadDigit);
+}
+
+TEST(CodeErrTest, ExplicitConversionToAnyErr) {
+  const tmn::err::AnyErr any = static_cast<tmn::err::AnyErr>(ParseErr(ParseCode::UnexpectedEof));
+  EXPECT_EQ(any.err_msg(), "Unexpected end of input");
+  EXPECT_EQ(any.what(), ParseErr(ParseCode::UnexpectedEof).what()) << "Message must point to the static table";
+
+  static_assert(!std::is_convertible_v<ParseErr, tmn::err::AnyErr>, "Conversion must be explicit");
+}
+
+TEST(CodeErrTest, FromErrno) {
+  errno = ENOENT;
+  const tmn::err::ErrnoErr err = tmn::err::last_errno();
+  EXPECT_EQ(err, std::errc::no_such_file_or_directory);
+  EXPECT_STREQ(err.what(), "No such file or directory");
+  EXPECT_STREQ(tmn::err::ErrnoErr::category(), "generic");
+
+  EXPECT_EQ(tmn::err::from_errno(EINVAL), std::errc::invalid_argument);
+  EXPECT_STREQ(tmn::err::from_errno(0).what(), "Unknown error code");
+}
+
+namespace {
+
+// Every enumerator of std::errc (C++20, [system.error.syn]):
+constexpr std::errc all_errc_codes[] = {
+  std::errc::address_family_not_supported,
+  std::errc::address_in_use,
+  std::errc::address_not_available,
+  std::errc::already_connected,
+  std::errc::argument_list_too_long,
+  std::errc::argument_out_of_domain,
+  std::errc::bad_address,
+  std::errc::bad_file_descriptor,
+  std::errc::bad_message,
+  std::errc::broken_pipe,
+  std::errc::connection_aborted,
+  std::errc::connection_already_in_progress,
+  std::errc::connection_refused,
+  std::errc::connection_reset,
+  std::errc::cross_device_link,
+  std::errc::destination_address_required,
+  std::errc::device_or_resource_busy,
+  std::errc::directory_not_empty,
+  std::errc::executable_format_error,
+  std::errc::file_exists,
+  std::errc::file_too_large,
+  std::errc::filename_too_long,
+  std::errc::function_not_supported,
+  std::errc::host_unreachable,
+  std::errc::identifier_removed,
+  std::errc::illegal_byte_sequence,
+  std::errc::inappropriate_io_control_operation,
+  std::errc::interrupted,
+  std::errc::invalid_argument,
+  std::errc::invalid_seek,
+  std::errc::io_error,
+  std::errc::is_a_directory,
+  std::errc::message_size,
+  std::errc::network_down,
+  std::errc::network_reset,
+  std::errc::network_unreachable,
+  std::errc::no_buffer_space,
+  std::errc::no_child_process,
+  std::errc::no_link,
+  std::errc::no_lock_available,
+  std::errc::no_message_available,
+  std::errc::no_message,
+  std::errc::no_protocol_option,
+  std::errc::no_space_on_device,
+  std::errc::no_stream_resources,
+  std::errc::no_such_device_or_address,
+  std::errc::no_such_device,
+  std::errc::no_such_file_or_directory,
+  std::errc::no_such_process,
+  std::errc::not_a_directory,
+  std::errc::not_a_socket,
+  std::errc::not_a_stream,
+  std::errc::not_connected,
+  std::errc::not_enough_memory,
+  std::errc::not_supported,
+  std::errc::operation_canceled,
+  std::errc::operation_in_progress,
+  std::errc::operation_not_permitted,
+  std::errc::operation_not_supported,
+  std::errc::operation_would_block,
+  std::errc::owner_dead,
+  std::errc::permission_denied,
+  std::errc::protocol_error,
+  std::errc::protocol_not_supported,
+  std::errc::read_only_file_system,
+  std::errc::resource_deadlock_would_occur,
+  std::errc::resource_unavailable_try_again,
+  std::errc::result_out_of_range,
+  std::errc::state_not_recoverable,
+  std::errc::stream_timeout,
+  std::errc::text_file_busy,
+  std::errc::timed_out,
+  std::errc::too_many_files_open_in_system,
+  std::errc::too_many_files_open,
+  std::errc::too_many_links,
+  std::errc::too_many_symbolic_link_levels,
+  std::errc::value_too_large,
+  std::errc::wrong_protocol_type
+};
+
+} // namespace;
+
+TEST(CodeErrTest, EveryErrcHasTheMessageOfTheGenericCategory) {
+  static_assert(std::size(all_errc_codes) == 78);
+  for (const std::errc code : all_errc_codes) {
+    const tmn::err::ErrnoErr err(code);
+    ASSERT_STRNE(err.what(), "Unknown error code") << "std::errc value " << err.value();
+#ifdef __GLIBC__
+    EXPECT_EQ(std::string(err.what()), std::generic_category().message(err.value())) << "std::errc value " << err.value();
+#endif
+  }
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+
+#include "../../include/Error/ErasedErr.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Result/Result.hpp"
+
+namespace {
+
+// Error larger than the inline buffer of ErasedErr:
+struct LargeErr {
+  std::array<char, 128> payload{};
+  int code = 0;
+
+  std::string err_msg() const { return "large error " + std::to_string(code); }
+  const char* what() const noexcept { return "large error"; }
+  bool operator==(const LargeErr& oth) const noexcept { return code == oth.code; }
+};
+
+} // namespace;
+
+static_assert(sizeof(tmn::err::ErasedErr) == tmn::err::ErasedErr::buffer_size + sizeof(void*));
+static_assert(tmn::err::ErasedErr::fits_inline<tmn::err::OutOfRangeErr>);
+static_assert(!tmn::err::ErasedErr::fits_inline<LargeErr>);
+
+TEST(ErasedErrTest, KeepsOriginalTypeInline) {
+  tmn::err::ErasedErr err = tmn::err::OutOfRangeErr(7, 3);
+
+  EXPECT_TRUE(err.is_inline());
+  EXPECT_TRUE(err.is<tmn::err::OutOfRangeErr>());
+  EXPECT_FALSE(err.is<tmn::err::AnyErr>()) << "Downcast is exact, not to the base classes";
+  EXPECT_EQ(err.err_msg(), "Index 7 out of range in [0, 3)");
+  EXPECT_STREQ(err.what(), "Index 7 out of range in [0, 3)");
+
+  auto range_err = err.downcast<tmn::err::OutOfRangeErr>();
+  ASSERT_TRUE(range_err.has_value());
+  EXPECT_EQ(range_err.value().index(), 7);
+  EXPECT_FALSE(err.downcast<tmn::err::StrErr>().has_value());
+}
+
+TEST(ErasedErrTest, LargeErrorsAreBoxed) {
+  LargeErr large;
+  large.code = 42;
+  tmn::err::ErasedErr err = large;
+
+  EXPECT_FALSE(err.is_inline());
+  EXPECT_EQ(err.err_msg(), "large error 42");
+
+  tmn::err::ErasedErr copy = err;
+  EXPECT_EQ(copy, err);
+  EXPECT_NE(&copy.downcast<LargeErr>().value(), &err.downcast<LargeErr>().value()) << "Copy must be deep";
+
+  tmn::err::ErasedErr moved = std::move(copy);
+  EXPECT_FALSE(copy.has_error());
+  EXPECT_EQ(moved.downcast<LargeErr>().value().code, 42);
+}
+
+TEST(ErasedErrTest, CopyMoveAndCompare) {
+  tmn::err::ErasedErr first = tmn::err::StrErr("first");
+  tmn::err::ErasedErr second = tmn::err::InvalidArgErr("first");
+
+  EXPECT_NE(first, second) << "Errors of different types are not equal";
+  EXPECT_EQ(first, tmn::err::ErasedErr(tmn::err::StrErr("first")));
+
+  second = first;
+  EXPECT_EQ(second, first);
+  EXPECT_TRUE(second.is<tmn::err::StrErr>());
+
+  second = tmn::err::ErasedErr(LargeErr{});
+  EXPECT_TRUE(second.is<LargeErr>());
+
+  tmn::err::ErasedErr moved = std::move(first);
+  EXPECT_FALSE(first.has_error());
+  EXPECT_STREQ(first.what(), "");
+  EXPECT_EQ(moved.err_msg(), "first");
+}
+
+TEST(ErasedErrTest, InResult) {
+  auto result = tmn::Result<int, tmn::err::ErasedErr>::Err(tmn::err::OutOfRangeErr(4, 2));
+  ASSERT_TRUE(result.is_err());
+  EXPECT_EQ(result.unwrap_err().downcast<tmn::err::OutOfRangeErr>().value().size(), 2);
+
+  char buffer[64];
+  EXPECT_EQ(result.unwrap_err().write_msg(buffer), 30);
+  EXPECT_STREQ(buffer, "Index 4 out of range in [0, 2)");
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <stdexcept>
+
+#include "../../include/Error/Error.hpp"
+#include "../../include/Error/ErasedErr.hpp"
+
+// A named namespace: compilers spell anonymous namespaces differently in type names;
+namespace type_info_test {
+
+// Custom hierarchy on top of the library errors:
+struct ConfigErr : tmn::err::StrErr {
+  using parent_error = tmn::err::StrErr;
+
+  ConfigErr() : tmn::err::StrErr(tmn::err::StaticMsg("config error")) {}
+
+  const tmn::err::ErrTypeInfo& type_info() const noexcept override { return tmn::err::err_type_info<ConfigErr>; }
+};
+
+} // namespace type_info_test;
+
+namespace {
+
+using type_info_test::ConfigErr;
+
+// Does not override `type_info()`: identified as its base StrErr;
+struct SilentErr : tmn::err::StrErr {
+  SilentErr() : tmn::err::StrErr(tmn::err::StaticMsg("silent error")) {}
+};
+
+} // namespace;
+
+static_assert(tmn::err::type_name<int>() == "int");
+static_assert(tmn::err::type_name<tmn::err::OutOfRangeErr>() == "tmn::err::OutOfRangeErr");
+static_assert(tmn::err::err_type_info<tmn::err::StrErr>.parent == &tmn::err::err_type_info<tmn::err::AnyErr>);
+static_assert(tmn::err::err_type_info<tmn::err::AnyErr>.parent == nullptr);
+
+TEST(ErrTypeInfoTest, TypeNameIsStaticAndTerminated) {
+  constexpr std::string_view name = tmn::err::type_name<tmn::err::NullPtrErr>();
+  EXPECT_EQ(name, "tmn::err::NullPtrErr");
+  EXPECT_EQ(name.data()[name.size()], '\0');
+}
+
+TEST(ErrTypeInfoTest, IsAndAsOnBaseReference) {
+  std::unique_ptr<tmn::err::AnyErr> err = std::make_unique<tmn::err::OutOfRangeErr>(7, 3);
+
+  EXPECT_TRUE(err->is<tmn::err::OutOfRangeErr>());
+  EXPECT_TRUE(err->is<tmn::err::AnyErr>());
+  EXPECT_FALSE(err->is<tmn::err::StrErr>());
+
+  const tmn::err::OutOfRangeErr* range_err = err->as<tmn::err::OutOfRangeErr>();
+  ASSERT_NE(range_err, nullptr);
+  EXPECT_EQ(range_err->index(), 7);
+  EXPECT_EQ(err->as<tmn::err::NullPtrErr>(), nullptr);
+}
+
+TEST(ErrTypeInfoTest, CustomHierarchy) {
+  ConfigErr config;
+  const tmn::err::AnyErr& as_base = config;
+
+  EXPECT_TRUE(as_base.is<ConfigErr>());
+  EXPECT_TRUE(as_base.is<tmn::err::StrErr>());
+  EXPECT_TRUE(as_base.is<tmn::err::AnyErr>());
+  EXPECT_EQ(as_base.as<ConfigErr>(), &config);
+  EXPECT_EQ(as_base.type_info().name, "type_info_test::ConfigErr");
+
+  SilentErr silent;
+  const tmn::err::AnyErr& silent_base = silent;
+  EXPECT_TRUE(silent_base.is<tmn::err::StrErr>());
+  EXPECT_FALSE(silent_base.is<SilentErr>()) << "Types without own record are never reported as themselves";
+}
+
+TEST(ErrTypeInfoTest, NamesWithoutTypeid) {
+  int* ptr = nullptr;
+  EXPECT_EQ(tmn::err::NullPtrErr(ptr).pointer_type(), "int");
+
+  // the exception caught by a reference to its base:
+  const std::out_of_range exc("bad index");
+  const std::exception& base = exc;
+  tmn::err::GeneralExceptionErr exc_err(base);
+#if defined(__cpp_rtti) || defined(__GXX_RTTI)
+  EXPECT_EQ(exc_err.exception_name(), typeid(std::out_of_range).name()) << "The dynamic type with RTTI";
+#else
+  EXPECT_EQ(exc_err.exception_name(), "std::exception") << "The static type without RTTI";
+  EXPECT_EQ(tmn::err::GeneralExceptionErr(exc).exception_name(), "std::out_of_range");
+#endif
+}
+
+TEST(ErrTypeInfoTest, ErasedErrExposesRecord) {
+  tmn::err::ErasedErr err = tmn::err::OutOfRangeErr(1, 0);
+
+  ASSERT_NE(err.type_info(), nullptr);
+  EXPECT_EQ(*err.type_info(), tmn::err::err_type_info<tmn::err::OutOfRangeErr>);
+  EXPECT_EQ(err.type_info()->name, "tmn::err::OutOfRangeErr");
+}
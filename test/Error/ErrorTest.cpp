@@ -34,3 +34,54 @@ TEST_F(ExceptionErrFixture, BasicFunctionality) {
   EXPECT_EQ(excerr1, excerr3) << "ExceptionErrors must be equal, because they are created from the same exceptions";
   EXPECT_NE(excerr1, excerr4) << "They should not be equal, because they are created from different exceptions";
 }
+
+TEST(ErrMsgTest, StaticMessageIsNotCopied) {
+  using namespace tmn::err::literals;
+
+  static constexpr const char* literal = "Port must be in range 1-65535";
+  tmn::err::ErrMsg msg = tmn::err::StaticMsg(literal);
+  EXPECT_TRUE(msg.is_static());
+  EXPECT_EQ(msg.c_str(), literal) << "Literal message must be stored as a pointer";
+
+  tmn::err::StrErr err("Port must be in range 1-65535"_msg);
+  EXPECT_EQ(err.err_msg(), "Port must be in range 1-65535");
+  EXPECT_EQ(err, tmn::err::StrErr("Port must be in range 1-65535")) << "Static and owned messages with equal text must be equal";
+}
+
+TEST(ErrMsgTest, OutOfRangeMessageIsRenderedLazily) {
+  tmn::err::OutOfRangeErr err(5, 3);
+  EXPECT_EQ(err.index(), 5);
+  EXPECT_EQ(err.size(), 3);
+  EXPECT_EQ(err.err_msg(), "Index 5 out of range in [0, 3)");
+  EXPECT_STREQ(err.what(), "Index 5 out of range in [0, 3)");
+
+  tmn::err::OutOfRangeErr closed(7, 4, false);
+  EXPECT_EQ(closed.err_msg(), "Index 7 out of range in [0, 4]");
+
+  // Formatter and fields are kept in the message, so the conversion to AnyErr keeps the text:
+  tmn::err::AnyErr sliced = tmn::err::OutOfRangeErr(10, 2);
+  EXPECT_EQ(sliced.err_msg(), "Index 10 out of range in [0, 2)");
+  EXPECT_STREQ(sliced.what(), "Index 10 out of range in [0, 2)");
+  EXPECT_EQ(sliced, tmn::err::AnyErr("Index 10 out of range in [0, 2)"));
+}
+
+TEST(ErrMsgTest, CopiesShareRuntimeMessage) {
+  tmn::err::StrErr err(std::string("Runtime message that does not fit into SSO"));
+  tmn::err::StrErr copy = err;
+  tmn::err::AnyErr sliced = copy;
+
+  EXPECT_EQ(copy.what(), err.what()) << "Copies of the error must share the message buffer";
+  EXPECT_EQ(sliced.what(), err.what());
+  EXPECT_EQ(sliced.err_msg(), "Runtime message that does not fit into SSO");
+}
+
+TEST(ErrMsgTest, ConcatenationUsesTheSizeOfTheView) {
+  // an empty Owned message keeps no buffer at all:
+  EXPECT_EQ(std::string("prefix: ") + tmn::err::ErrMsg(std::string("")), "prefix: ");
+  EXPECT_EQ(std::string("prefix: ") + tmn::err::ErrMsg(std::string("owned")), "prefix: owned");
+
+  // a view of static storage is not '\0'-terminated:
+  static constexpr char table[] = "firstsecond";
+  const auto first = tmn::err::ErrMsg::from_static_storage(std::string_view(table, 5));
+  EXPECT_EQ(std::string("prefix: ") + first, "prefix: first");
+}
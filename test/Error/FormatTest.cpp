@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <iterator>
+#include <version> // for: __cpp_lib_format;
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include "../../include/Format/Format.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Error/Boxed.hpp"
+
+namespace {
+
+// Error without `write_msg()`: rendered through `err_msg()`;
+struct LegacyErr {
+  std::string err_msg() const { return "legacy error"; }
+  const char* what() const noexcept { return "legacy error"; }
+  bool operator==(const LegacyErr&) const noexcept { return true; }
+};
+
+// Renders through the string overload and checks that an output iterator gets the same text:
+template <typename T>
+std::string render(const T& value) {
+  std::string out = "> ";
+  std::string chars;
+  if constexpr (tmn::err::Error<T>) {
+    tmn::err::format_to(out, value);
+    tmn::err::format_to(std::back_inserter(chars), value);
+  }
+  else {
+    tmn::format_to(out, value);
+    tmn::format_to(std::back_inserter(chars), value);
+  }
+  EXPECT_EQ(out, "> " + chars) << "The string overload appends the same text";
+  return chars;
+}
+
+} // namespace;
+
+static_assert(tmn::err::BufferWritableError<tmn::err::NullPtrErr>);
+static_assert(tmn::err::BufferWritableError<tmn::err::Boxed<tmn::err::StrErr>>);
+static_assert(tmn::err::Error<LegacyErr> && !tmn::err::BufferWritableError<LegacyErr>);
+
+TEST(ErrFormatTest, WriteMsgMatchesErrMsg) {
+  const tmn::err::NullPtrErr null_err("Deleter");
+  const tmn::err::OutOfRangeErr range_err(5, 3);
+  const tmn::err::GeneralExceptionErr exc_err;
+
+  char buffer[128];
+  EXPECT_EQ(null_err.write_msg(buffer), null_err.err_msg().size());
+  EXPECT_EQ(std::string(buffer), null_err.err_msg());
+
+  EXPECT_EQ(range_err.write_msg(buffer), range_err.err_msg().size());
+  EXPECT_EQ(std::string(buffer), "Index 5 out of range in [0, 3)");
+
+  EXPECT_EQ(exc_err.write_msg(buffer), exc_err.err_msg().size());
+  EXPECT_EQ(std::string(buffer), "[Unknown type]: Unknown General Exception Error");
+
+  EXPECT_EQ(tmn::err::write_msg(LegacyErr{}, buffer), 12);
+  EXPECT_EQ(std::string(buffer), "legacy error");
+}
+
+TEST(ErrFormatTest, WriteMsgTruncates) {
+  const tmn::err::StrErr err(std::string("Message longer than the buffer"));
+
+  char small[8];
+  EXPECT_EQ(err.write_msg(small), 30) << "Full length must be returned";
+  EXPECT_EQ(std::string(small), "Message");
+
+  char lazy_small[6];
+  EXPECT_EQ(tmn::err::OutOfRangeErr(5, 3).write_msg(lazy_small), 30);
+  EXPECT_EQ(std::string(lazy_small), "Index");
+
+  EXPECT_EQ(err.write_msg(std::span<char>()), 30);
+}
+
+TEST(ErrFormatTest, FormatToErrors) {
+  EXPECT_EQ(render(tmn::err::NullPtrErr("Deleter")), tmn::err::NullPtrErr("Deleter").err_msg());
+  EXPECT_EQ(render(tmn::err::Boxed<tmn::err::OutOfRangeErr>(5, 3)), "Index 5 out of range in [0, 3)");
+  EXPECT_EQ(render(LegacyErr{}), "legacy error");
+
+  const std::string long_text(1000, 'x');
+  EXPECT_EQ(render(tmn::err::StrErr(long_text)), long_text);
+}
+
+TEST(ErrFormatTest, FormatToOptionAndResult) {
+  int referred = 7;
+
+  EXPECT_EQ(render(tmn::Option<int>(42)), "Some(42)");
+  EXPECT_EQ(render(tmn::Option<int>()), "None");
+  EXPECT_EQ(render(tmn::Option<double>(1.5)), "Some(1.5)");
+  EXPECT_EQ(render(tmn::Option<std::string>(std::string("text"))), "Some(text)");
+  EXPECT_EQ(render(tmn::Option<int&>(referred)), "Some(7)");
+
+  EXPECT_EQ(render(tmn::Result<int, tmn::err::StrErr>::Ok(42)), "Ok(42)");
+  EXPECT_EQ(render(tmn::Result<int, tmn::err::StrErr>::Err("failure")), "Err(failure)");
+  EXPECT_EQ(render(tmn::Result<bool, tmn::err::OutOfRangeErr>::Err(std::size_t{5}, std::size_t{3})), "Err(Index 5 out of range in [0, 3))");
+  EXPECT_EQ(render(tmn::Result<void, tmn::err::StrErr>::Ok()), "Ok()");
+  EXPECT_EQ(render(tmn::Result<int&, tmn::err::StrErr>::Ok(referred)), "Ok(7)");
+}
+
+#if defined(__cpp_lib_format)
+TEST(ErrFormatTest, StdFormatterMatchesFormatTo) {
+  int referred = 7;
+
+  EXPECT_EQ(std::format("{}", tmn::err::NullPtrErr("Deleter")), render(tmn::err::NullPtrErr("Deleter")));
+  EXPECT_EQ(std::format("{}", tmn::err::Boxed<tmn::err::OutOfRangeErr>(5, 3)), "Index 5 out of range in [0, 3)");
+  EXPECT_EQ(std::format("{}", LegacyErr{}), "legacy error");
+
+  tmn::err::ErrList<tmn::err::StrErr> errors;
+  errors.push_back(tmn::err::StrErr("first"));
+  errors.push_back(tmn::err::StrErr("second"));
+  EXPECT_EQ(std::format("{}", errors), render(errors));
+
+  EXPECT_EQ(std::format("[{}] [{}]", tmn::Option<int>(42), tmn::Option<int>()), "[Some(42)] [None]");
+  EXPECT_EQ(std::format("{}", tmn::Option<int&>(referred)), "Some(7)");
+  EXPECT_EQ(std::format("{}", tmn::Result<int, tmn::err::StrErr>::Err("failure")), "Err(failure)");
+  EXPECT_EQ(std::format("{}", tmn::Result<void, tmn::err::StrErr>::Ok()), "Ok()");
+
+  // the output of the context is written in place, a long message included:
+  const std::string long_text(1000, 'x');
+  EXPECT_EQ(std::format("{}", tmn::Result<int, tmn::err::StrErr>::Err(long_text)), "Err(" + long_text + ")");
+}
+#endif
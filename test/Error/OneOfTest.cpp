@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../../include/Error/OneOf.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Error/CodeErr.hpp"
+#include "../../include/Result/Result.hpp"
+
+using tmn::err::OneOf;
+using tmn::err::StrErr;
+using tmn::err::OutOfRangeErr;
+using tmn::err::ErrnoErr;
+
+static_assert(std::same_as<tmn::err::widen_t<StrErr, StrErr>, StrErr>);
+static_assert(std::same_as<tmn::err::widen_t<StrErr, ErrnoErr>, OneOf<StrErr, ErrnoErr>>);
+static_assert(std::same_as<tmn::err::widen_t<OneOf<StrErr, ErrnoErr>, ErrnoErr>, OneOf<StrErr, ErrnoErr>>);
+static_assert(std::same_as<tmn::err::widen_t<OneOf<StrErr, ErrnoErr>, OneOf<OutOfRangeErr, StrErr>>,
+                           OneOf<StrErr, ErrnoErr, OutOfRangeErr>>);
+static_assert(tmn::err::Error<OneOf<StrErr, ErrnoErr>>);
+
+namespace {
+
+tmn::Result<int, ErrnoErr> open_port(int port) {
+  if (port <= 0) return tmn::Result<int, ErrnoErr>::Err(std::errc::invalid_argument);
+  return tmn::Result<int, ErrnoErr>::Ok(port);
+}
+
+tmn::Result<std::string, StrErr> describe(int fd) {
+  if (fd > 1000) return tmn::Result<std::string, StrErr>::Err("descriptor is too large");
+  return tmn::Result<std::string, StrErr>::Ok("fd=" + std::to_string(fd));
+}
+
+tmn::Result<std::size_t, OutOfRangeErr> check_length(const std::string& text) {
+  if (text.size() > 6) return tmn::Result<std::size_t, OutOfRangeErr>::Err(text.size(), std::size_t{6});
+  return tmn::Result<std::size_t, OutOfRangeErr>::Ok(text.size());
+}
+
+} // namespace;
+
+TEST(OneOfTest, HoldsOneAlternative) {
+  OneOf<StrErr, ErrnoErr> err = ErrnoErr(std::errc::timed_out);
+
+  EXPECT_EQ(err.index(), 1);
+  EXPECT_TRUE(err.is<ErrnoErr>());
+  EXPECT_FALSE(err.is<StrErr>());
+  EXPECT_EQ(err.err_msg(), "Connection timed out");
+  EXPECT_STREQ(err.what(), "Connection timed out");
+  EXPECT_EQ(err.downcast<ErrnoErr>().value(), std::errc::timed_out);
+  EXPECT_FALSE(err.downcast<StrErr>().has_value());
+
+  char buffer[16];
+  EXPECT_EQ(err.write_msg(buffer), 20);
+  EXPECT_STREQ(buffer, "Connection time");
+
+  const auto kind = err.visit([](const auto& alternative) -> std::string {
+    if constexpr (std::same_as<std::remove_cvref_t<decltype(alternative)>, StrErr>) return "str";
+    else return "code";
+  });
+  EXPECT_EQ(kind, "code");
+}
+
+TEST(OneOfTest, ComparisonAndWidening) {
+  const OneOf<StrErr, ErrnoErr> str_err = StrErr("failure");
+
+  EXPECT_EQ(str_err, (OneOf<StrErr, ErrnoErr>(StrErr("failure"))));
+  EXPECT_NE(str_err, (OneOf<StrErr, ErrnoErr>(StrErr("other"))));
+  EXPECT_NE(str_err, (OneOf<StrErr, ErrnoErr>(ErrnoErr(std::errc::io_error))));
+
+  const OneOf<OutOfRangeErr, ErrnoErr, StrErr> wide = str_err;
+  EXPECT_TRUE(wide.is<StrErr>());
+  EXPECT_EQ(wide.err_msg(), "failure");
+}
+
+TEST(OneOfTest, AndThenWidensErrorSet) {
+  auto ok = open_port(80).and_then(describe);
+  static_assert(std::same_as<decltype(ok), tmn::Result<std::string, OneOf<ErrnoErr, StrErr>>>);
+  ASSERT_TRUE(ok.is_ok());
+  EXPECT_EQ(ok.unwrap_value(), "fd=80");
+
+  auto first_failed = open_port(-1).and_then(describe);
+  ASSERT_TRUE(first_failed.is_err());
+  EXPECT_TRUE(first_failed.unwrap_err().is<ErrnoErr>());
+
+  auto second_failed = open_port(2000).and_then(describe);
+  ASSERT_TRUE(second_failed.is_err());
+  EXPECT_EQ(second_failed.unwrap_err().err_msg(), "descriptor is too large");
+
+  auto third_failed = open_port(1000).and_then(describe).and_then(check_length);
+  static_assert(std::same_as<decltype(third_failed), tmn::Result<std::size_t, OneOf<ErrnoErr, StrErr, OutOfRangeErr>>>);
+  ASSERT_TRUE(third_failed.is_err());
+  EXPECT_EQ(third_failed.unwrap_err().downcast<OutOfRangeErr>().value().index(), 7);
+}
+
+TEST(OneOfTest, AndThenWithSameErrorFlattens) {
+  auto chained = describe(1).and_then([](const std::string& text) {
+    return tmn::Result<std::size_t, StrErr>::Ok(text.size());
+  });
+  static_assert(std::same_as<decltype(chained), tmn::Result<std::size_t, StrErr>>);
+  EXPECT_EQ(chained.unwrap_value(), 4);
+}
@@ -6,6 +6,9 @@
 #include "../../include/Error/TryOrConvert.hpp"
 #include "../../include/Error/Error.hpp"
 
+// user code throws: only with exceptions support;
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+
 TEST(TryOrConvertTest, BasicFunctionality) {
   auto success_fn = [](int x) -> int { return x*42; };
   auto success_result = tmn::try_or_convert(success_fn, 2);
@@ -23,3 +26,5 @@ TEST(TryOrConvertTest, BasicFunctionality) {
   EXPECT_TRUE(unknown_error_result.is_err());
   EXPECT_EQ(unknown_error_result.unwrap_err().err_msg(), "[Unknown type]: Unknown General Exception Error");
 }
+
+#endif // TMN_THROWLESS_HAS_EXCEPTIONS
@@ -0,0 +1,39 @@
+# Compiles SOURCE to assembly with COMPILER (-O2 -S) and fails if a probe function
+# (a symbol containing "probe_match") contains an indirect call or jump (x86-64, AT&T syntax):
+#   cmake -DCOMPILER=... -DSOURCE=... -DOUTPUT=... -P CheckNoIndirectBranches.cmake
+
+execute_process(
+    COMMAND ${COMPILER} -std=c++20 -O2 -S -o ${OUTPUT} ${SOURCE}
+    RESULT_VARIABLE compile_result
+    ERROR_VARIABLE compile_errors
+)
+if(NOT compile_result EQUAL 0)
+    message(FATAL_ERROR "Compilation of the probe failed:\n${compile_errors}")
+endif()
+
+file(STRINGS ${OUTPUT} lines)
+set(current_function "")
+set(probe_count 0)
+set(violations "")
+foreach(line IN LISTS lines)
+    if(line MATCHES "^([A-Za-z_.$][A-Za-z0-9_.$]*):")
+        set(label ${CMAKE_MATCH_1})
+        # local labels (.L...) belong to the current function:
+        if(NOT label MATCHES "^\\.L")
+            set(current_function ${label})
+            if(label MATCHES "probe_match" AND NOT label MATCHES "\\.cold$")
+                math(EXPR probe_count "${probe_count} + 1")
+            endif()
+        endif()
+    elseif(current_function MATCHES "probe_match" AND line MATCHES "^[ \t]+(call|jmp)[a-z]*[ \t]+\\*")
+        string(APPEND violations "  ${current_function}: ${line}\n")
+    endif()
+endforeach()
+
+if(probe_count EQUAL 0)
+    message(FATAL_ERROR "No probe functions found in ${OUTPUT}")
+endif()
+if(NOT violations STREQUAL "")
+    message(FATAL_ERROR "Indirect branches in match():\n${violations}")
+endif()
+message(STATUS "${probe_count} probe functions without indirect branches")
@@ -0,0 +1,49 @@
+// Compiled to assembly only (-O2 -S) by the MatchCodegenTests test (CheckNoIndirectBranches.cmake):
+// match over Option, Result and errors outside of the AnyErr hierarchy must compile to the
+// same branch on the state as a hand-written `if`, without indirect calls or jumps;
+// the arms call functions that are only declared, so every probe stays a separate function;
+
+#include <string>
+
+#include "../../include/Match/Match.hpp"
+#include "../../include/Option/Option.hpp"
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+
+namespace probe {
+
+// Error outside of the AnyErr hierarchy (no virtual functions): its arm is selected at compile time;
+struct PlainErr {
+  int code = 0;
+
+  std::string err_msg() const { return "plain error"; }
+  const char* what() const noexcept { return "plain error"; }
+  bool operator==(const PlainErr&) const = default;
+};
+
+int on_value(int value);
+int on_none();
+int on_err(const tmn::err::StrErr& err);
+int on_plain(const PlainErr& err);
+int on_other();
+
+} // namespace probe;
+
+int probe_match_option(const tmn::Option<int>& opt) {
+  return tmn::match(opt, [](int value) { return probe::on_value(value); }, [] { return probe::on_none(); });
+}
+
+int probe_match_result(const tmn::Result<int, tmn::err::StrErr>& res) {
+  return tmn::match(res, [](int value) { return probe::on_value(value); },
+                         [](const tmn::err::StrErr& err) { return probe::on_err(err); });
+}
+
+int probe_match_void_result(const tmn::Result<void, probe::PlainErr>& res) {
+  return tmn::match(res, [] { return probe::on_none(); }, [](const probe::PlainErr& err) { return probe::on_plain(err); });
+}
+
+int probe_match_plain_error(const probe::PlainErr& err) {
+  return tmn::match(err, tmn::handler<tmn::err::StrErr>([] { return probe::on_other(); }),
+                         tmn::handler<probe::PlainErr>([](const probe::PlainErr& plain) { return probe::on_plain(plain); }),
+                         tmn::otherwise([] { return probe::on_other(); }));
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "../../include/Match/Match.hpp"
+
+namespace {
+
+// Counts copies and moves of the payload:
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  int value = 0;
+
+  Tracked(int v) : value(v) {}
+  Tracked(const Tracked& oth) : value(oth.value) { ++copies; }
+  Tracked(Tracked&& oth) noexcept : value(oth.value) { ++moves; }
+  Tracked& operator=(const Tracked& oth) { value = oth.value; ++copies; return *this; }
+  Tracked& operator=(Tracked&& oth) noexcept { value = oth.value; ++moves; return *this; }
+
+  static void reset() { copies = 0; moves = 0; }
+};
+
+// Error without AnyErr base (dispatched at compile time):
+struct ParseErr {
+  int line = 0;
+
+  std::string err_msg() const { return "parse error"; }
+  const char* what() const noexcept { return "parse error"; }
+  bool operator==(const ParseErr&) const = default;
+};
+
+} // namespace;
+
+TEST(MatchTest, OptionArms) {
+  tmn::Option<int> some(5);
+  tmn::Option<int> none;
+
+  auto twice = [](int v) { return v * 2; };
+  auto zero = [] { return 0; };
+
+  EXPECT_EQ(tmn::match(some, twice, zero), 10);
+  EXPECT_EQ(tmn::match(none, twice, zero), 0);
+  EXPECT_EQ(tmn::match(some, [](int v) { return v; }, [] { return 1.5; }), 5.0) << "Common type of the arms";
+}
+
+TEST(MatchTest, OptionPayloadIsNotCopied) {
+  tmn::Option<Tracked> opt(Tracked(3));
+  Tracked::reset();
+
+  int seen = tmn::match(opt, [](const Tracked& t) { return t.value; }, [] { return -1; });
+  EXPECT_EQ(seen, 3);
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 0);
+
+  Tracked taken = tmn::match(std::move(opt), [](Tracked&& t) { return std::move(t); }, [] { return Tracked(-1); });
+  EXPECT_EQ(taken.value, 3);
+  EXPECT_EQ(Tracked::copies, 0) << "Payload of an rvalue Option is moved";
+}
+
+TEST(MatchTest, OptionArmsReturningReferences) {
+  int fallback = 0;
+  tmn::Option<int> opt(7);
+
+  int& ref = tmn::match(opt, [](int& v) -> int& { return v; }, [&]() -> int& { return fallback; });
+  ref = 8;
+  EXPECT_EQ(opt.value(), 8) << "Arms agree on int&, so the reference is kept";
+}
+
+TEST(MatchTest, ResultArms) {
+  using Res = tmn::Result<int, tmn::err::StrErr>;
+
+  auto on_ok = [](int v) { return std::to_string(v); };
+  auto on_err = [](const tmn::err::StrErr& e) { return e.err_msg(); };
+
+  EXPECT_EQ(tmn::match(Res::Ok(4), on_ok, on_err), "4");
+  EXPECT_EQ(tmn::match(Res::Err("bad"), on_ok, on_err), "bad");
+
+  auto done = tmn::Result<void, tmn::err::StrErr>::Ok();
+  EXPECT_TRUE(tmn::match(done, [] { return true; }, [](const tmn::err::StrErr&) { return false; }));
+}
+
+TEST(MatchTest, ResultPayloadIsMoved) {
+  auto res = tmn::Result<Tracked, tmn::err::StrErr>::Ok(Tracked(9));
+  Tracked::reset();
+
+  Tracked value = tmn::match(std::move(res), [](Tracked&& t) { return std::move(t); }, [](tmn::err::StrErr&&) { return Tracked(0); });
+  EXPECT_EQ(value.value, 9);
+  EXPECT_EQ(Tracked::copies, 0);
+}
+
+TEST(MatchTest, OneOfSelectsArmsAtCompileTime) {
+  using Err = tmn::err::OneOf<tmn::err::OutOfRangeErr, tmn::err::NullPtrErr, ParseErr>;
+
+  auto describe = [](const Err& err) {
+    return tmn::match(err,
+      tmn::handler<tmn::err::OutOfRangeErr>([](const tmn::err::OutOfRangeErr& e) { return static_cast<int>(e.index()); }),
+      tmn::handler<tmn::err::AnyErr>([](const tmn::err::AnyErr&) { return -1; }),
+      tmn::otherwise([] { return -2; }));
+  };
+
+  EXPECT_EQ(describe(tmn::err::OutOfRangeErr(4, 2)), 4);
+  EXPECT_EQ(describe(tmn::err::NullPtrErr("int")), -1) << "Handler of the base accepts derived alternatives";
+  EXPECT_EQ(describe(ParseErr{}), -2);
+}
+
+TEST(MatchTest, ConcreteErrorWithoutBranches) {
+  ParseErr err{12};
+  EXPECT_EQ(tmn::match(err,
+    tmn::handler<tmn::err::StrErr>([](const tmn::err::StrErr&) { return 0; }),
+    tmn::handler<ParseErr>([](ParseErr& e) { return e.line; })), 12);
+}
+
+TEST(MatchTest, BaseReferenceDispatch) {
+  std::unique_ptr<tmn::err::AnyErr> err = std::make_unique<tmn::err::NullPtrErr>("Deleter");
+
+  auto which = [](const tmn::err::AnyErr& e) {
+    return tmn::match(e,
+      tmn::handler<tmn::err::OutOfRangeErr>([] { return std::string("range"); }),
+      tmn::handler<tmn::err::NullPtrErr>([](const tmn::err::NullPtrErr& null_err) { return null_err.pointer_type(); }),
+      tmn::otherwise([](const tmn::err::AnyErr& any) { return any.err_msg(); }));
+  };
+
+  EXPECT_EQ(which(*err), "Deleter");
+  EXPECT_EQ(which(tmn::err::OutOfRangeErr(1, 0)), "range");
+  EXPECT_EQ(which(tmn::err::StrErr("other")), "other");
+
+  // handler of the static type ends the chain, `otherwise` is not needed:
+  EXPECT_EQ(tmn::match(*err,
+    tmn::handler<tmn::err::OutOfRangeErr>([] { return 1; }),
+    tmn::handler<tmn::err::AnyErr>([] { return 2; })), 2);
+}
+
+TEST(MatchTest, ErasedErrDispatch) {
+  tmn::err::ErasedErr err = tmn::err::OutOfRangeErr(5, 1);
+
+  auto index = tmn::match(std::move(err),
+    tmn::handler<tmn::err::NullPtrErr>([] { return std::size_t{0}; }),
+    tmn::handler<tmn::err::OutOfRangeErr>([](tmn::err::OutOfRangeErr&& e) { return e.index(); }),
+    tmn::otherwise([] { return std::size_t{1}; }));
+  EXPECT_EQ(index, 5);
+
+  tmn::err::ErasedErr other = ParseErr{};
+  EXPECT_EQ(tmn::match(other,
+    tmn::handler<tmn::err::OutOfRangeErr>([] { return 0; }),
+    tmn::otherwise([](const tmn::err::ErasedErr& e) { return static_cast<int>(e.err_msg().size()); })), 11);
+}
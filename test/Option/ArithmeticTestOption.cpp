@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
 
 #include "../../include/Option/Option.hpp"
+#include "../../src/Option/Overflow.hpp"
 #include "../_TestUtils/RandomGenerator.hpp"
 
 class OptionArithmeticTestFixture : public ::testing::Test {
@@ -167,3 +172,91 @@ TEST_F(OptionArithmeticTestFixture, ChainedOperations) {
   ASSERT_TRUE(d.has_value());
   EXPECT_EQ(d.value(), (value1 + value2) * value3);
 }
+
+TEST(OptionCheckedArithmetic, OverflowGivesNone) {
+  using limits = std::numeric_limits<std::int64_t>;
+  const tmn::Option<std::int64_t> max(limits::max());
+  const tmn::Option<std::int64_t> min(limits::min());
+  const tmn::Option<std::int64_t> one(1);
+
+  EXPECT_EQ(tmn::checked_add(tmn::Option<std::int64_t>(40), tmn::Option<std::int64_t>(2)), tmn::Option<std::int64_t>(42));
+  EXPECT_FALSE(tmn::checked_add(max, one).has_value());
+  EXPECT_FALSE(tmn::checked_sub(min, one).has_value());
+  EXPECT_FALSE(tmn::checked_mul(max, tmn::Option<std::int64_t>(2)).has_value());
+  EXPECT_EQ(tmn::checked_mul(tmn::Option<std::int64_t>(-3), tmn::Option<std::int64_t>(7)), tmn::Option<std::int64_t>(-21));
+  EXPECT_FALSE(tmn::checked_add(max, tmn::Option<std::int64_t>()).has_value());
+
+  // division: zero divisor and MIN / -1;
+  EXPECT_FALSE(tmn::checked_div(one, tmn::Option<std::int64_t>(0)).has_value());
+  EXPECT_FALSE(tmn::checked_div(min, tmn::Option<std::int64_t>(-1)).has_value());
+  EXPECT_EQ(tmn::checked_div(max, tmn::Option<std::int64_t>(-1)), tmn::Option<std::int64_t>(-limits::max()));
+  EXPECT_EQ(tmn::checked_div(tmn::Option<std::int64_t>(-7), tmn::Option<std::int64_t>(2)), tmn::Option<std::int64_t>(-3));
+}
+
+TEST(OptionCheckedArithmetic, ResultIsTheCommonTypeWithoutPromotion) {
+  const auto sum = tmn::checked_add(tmn::Option<std::int8_t>(100), tmn::Option<std::int8_t>(27));
+  static_assert(std::is_same_v<std::remove_cvref_t<decltype(sum)>, tmn::Option<std::int8_t>>);
+  EXPECT_EQ(sum, tmn::Option<std::int8_t>(127));
+  EXPECT_FALSE(tmn::checked_add(tmn::Option<std::int8_t>(100), tmn::Option<std::int8_t>(28)).has_value());
+
+  // the exact result is checked, not the converted operands:
+  EXPECT_EQ(tmn::checked_add(tmn::Option<unsigned>(5), tmn::Option<int>(-1)), tmn::Option<unsigned>(4));
+  EXPECT_FALSE(tmn::checked_sub(tmn::Option<unsigned>(1), tmn::Option<unsigned>(2)).has_value());
+
+  // mixed small types: the wider one (unsigned for the same width), not int:
+  const auto mixed = tmn::checked_add(tmn::Option<std::int8_t>(-1), tmn::Option<std::int16_t>(32767));
+  static_assert(std::is_same_v<std::remove_cvref_t<decltype(mixed)>, tmn::Option<std::int16_t>>);
+  EXPECT_EQ(mixed, tmn::Option<std::int16_t>(32766));
+  EXPECT_FALSE(tmn::checked_add(tmn::Option<std::int8_t>(1), tmn::Option<std::int16_t>(32767)).has_value());
+  EXPECT_FALSE(tmn::checked_mul(tmn::Option<std::uint8_t>(2), tmn::Option<std::int16_t>(-20000)).has_value());
+
+  const auto same_width = tmn::checked_sub(tmn::Option<std::uint8_t>(200), tmn::Option<std::int8_t>(-55));
+  static_assert(std::is_same_v<std::remove_cvref_t<decltype(same_width)>, tmn::Option<std::uint8_t>>);
+  EXPECT_EQ(same_width, tmn::Option<std::uint8_t>(255));
+  EXPECT_FALSE(tmn::checked_sub(tmn::Option<std::uint8_t>(200), tmn::Option<std::int8_t>(-56)).has_value());
+  EXPECT_FALSE(tmn::checked_div(tmn::Option<std::int8_t>(-4), tmn::Option<std::uint8_t>(2)).has_value());
+
+  // a small type and int: int, as before:
+  static_assert(std::is_same_v<decltype(tmn::checked_add(tmn::Option<std::int8_t>(), tmn::Option<int>())), tmn::Option<int>>);
+}
+
+namespace {
+
+// Values around zero and the limits of T:
+template <typename T>
+std::vector<T> edge_values() {
+  using limits = std::numeric_limits<T>;
+  std::vector<T> values = {T{0}, T{1}, T{2}, limits::max(), static_cast<T>(limits::max() - 1), static_cast<T>(limits::max() / 2),
+                           limits::min(), static_cast<T>(limits::min() + 1), static_cast<T>(limits::min() / 2)};
+  if constexpr (std::is_signed_v<T>) values.push_back(T{-1});
+  return values;
+}
+
+// The portable checks (compilers without __builtin_*_overflow) against the intrinsics:
+template <typename T, typename U, typename R>
+void expect_portable_checks_match() {
+  for (const T lhs : edge_values<T>()) {
+    for (const U rhs : edge_values<U>()) {
+      R expected{};
+      R actual{};
+      EXPECT_EQ(tmn::detail::portable_add_overflow(lhs, rhs, &actual), __builtin_add_overflow(lhs, rhs, &expected));
+      EXPECT_EQ(actual, expected);
+      EXPECT_EQ(tmn::detail::portable_sub_overflow(lhs, rhs, &actual), __builtin_sub_overflow(lhs, rhs, &expected));
+      EXPECT_EQ(actual, expected);
+      EXPECT_EQ(tmn::detail::portable_mul_overflow(lhs, rhs, &actual), __builtin_mul_overflow(lhs, rhs, &expected));
+      EXPECT_EQ(actual, expected);
+    }
+  }
+}
+
+} // namespace;
+
+TEST(OptionCheckedArithmetic, PortableChecksMatchTheIntrinsics) {
+  expect_portable_checks_match<std::int64_t, std::int64_t, std::int64_t>();
+  expect_portable_checks_match<std::uint64_t, std::uint64_t, std::uint64_t>();
+  expect_portable_checks_match<std::int64_t, std::uint64_t, std::uint64_t>();
+  expect_portable_checks_match<std::int64_t, std::uint64_t, std::int64_t>();
+  expect_portable_checks_match<std::int32_t, std::int8_t, std::int32_t>();
+  expect_portable_checks_match<std::uint8_t, std::int16_t, std::int8_t>();
+  expect_portable_checks_match<unsigned, int, unsigned>();
+}
@@ -5,6 +5,7 @@
 #include "../../include/Option/Option.hpp"
 #include "../../include/Error/Error.hpp"
 #include "../_TestUtils/RandomGenerator.hpp"
+#include "../_TestUtils/Failure.hpp"
 
 class OptionDefaultConstructorFixture : public ::testing::Test {
 protected:
@@ -134,7 +135,7 @@ TEST_F(OptionValueOrExceptionFixture, ValueAccessWithRandomValue) {
 }
 
 TEST_F(OptionValueOrExceptionFixture, ValueAccessThrowsOnEmpty) {
-  EXPECT_THROW(empty_opt.value(), std::bad_optional_access);
+  TMN_EXPECT_FAILURE(empty_opt.value(), std::bad_optional_access);
 }
 
 class OptionDestroyValueFixture : public ::testing::Test {
@@ -285,3 +286,30 @@ TEST_F(OptionConversionFixture, ToResultWithEmpty) {
   ASSERT_TRUE(r.is_err());
   EXPECT_EQ(r.unwrap_err().err_msg(), error_message);
 }
+
+class OptionUncheckedAccessFixture : public ::testing::Test {
+protected:
+  tmn::test_utils::RandomTestData test_data;
+  tmn::Option<std::string> filled_opt{"value_" + std::to_string(test_data.random_int_1)};
+  tmn::Option<std::string> empty_opt;
+};
+
+TEST_F(OptionUncheckedAccessFixture, AccessToValue) {
+  ASSERT_TRUE(filled_opt.has_value());
+  EXPECT_EQ(filled_opt.value_unchecked(), filled_opt.value());
+  EXPECT_EQ(&*filled_opt, &filled_opt.value());
+  EXPECT_EQ(filled_opt->size(), filled_opt.value().size());
+
+  *filled_opt = "changed";
+  EXPECT_EQ(filled_opt.value(), "changed");
+
+  const auto& const_opt = filled_opt;
+  EXPECT_EQ(const_opt->c_str(), filled_opt.value().c_str());
+}
+
+#ifndef NDEBUG
+TEST_F(OptionUncheckedAccessFixture, NoneIsCheckedInDebugBuilds) {
+  EXPECT_DEATH((void)empty_opt.value_unchecked(), "unchecked access to the value of None");
+  EXPECT_DEATH((void)empty_opt->size(), "unchecked access to the value of None");
+}
+#endif
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+
+#include "../../include/Option/OptionColumn.hpp"
+#include "../_TestUtils/RandomGenerator.hpp"
+
+class OptionColumnFixture : public ::testing::Test {
+protected:
+  tmn::test_utils::RandomTestData test_data;
+
+  // Every third element is None; crosses several bitmap words:
+  std::vector<tmn::Option<int>> make_options(std::size_t count) const {
+    std::vector<tmn::Option<int>> options;
+    for (std::size_t i = 0; i < count; ++i) {
+      if (i % 3 == 0) options.emplace_back();
+      else options.emplace_back(test_data.random_int_1 + static_cast<int>(i));
+    }
+    return options;
+  }
+};
+
+TEST_F(OptionColumnFixture, PushAndGet) {
+  tmn::OptionColumn<int> column;
+  EXPECT_TRUE(column.empty());
+
+  column.push_back(test_data.random_int_1);
+  column.push_none();
+  column.push_back(tmn::Option<int>(test_data.random_int_2));
+  column.push_back(tmn::Option<int>());
+
+  ASSERT_EQ(column.size(), 4);
+  EXPECT_EQ(column.get(0), tmn::Option<int>(test_data.random_int_1));
+  EXPECT_FALSE(column.get(1).has_value());
+  EXPECT_EQ(column.get(2), tmn::Option<int>(test_data.random_int_2));
+  EXPECT_TRUE(column.is_none(3));
+  EXPECT_FALSE(column.get(4).has_value()) << "Index out of range is None";
+
+  EXPECT_EQ(column.count_some(), 2);
+  EXPECT_EQ(column.count_none(), 2);
+  EXPECT_EQ(column.validity().size(), 1);
+}
+
+TEST_F(OptionColumnFixture, BulkAppendMatchesPushBack) {
+  const auto options = make_options(200);
+
+  tmn::OptionColumn<int> pushed;
+  pushed.push_back(tmn::Option<int>(test_data.random_int_2)); // unaligned start of the bulk append
+  for (const auto& opt : options) pushed.push_back(opt);
+
+  tmn::OptionColumn<int> appended;
+  appended.push_back(tmn::Option<int>(test_data.random_int_2));
+  appended.append(options);
+
+  EXPECT_EQ(appended, pushed);
+  EXPECT_EQ(appended.size(), 201);
+  EXPECT_EQ(appended.validity().size(), 4);
+  EXPECT_EQ(appended.count_some(), 1 + 200 - 67);
+
+  const auto round_trip = tmn::OptionColumn<int>(options).to_options();
+  EXPECT_EQ(round_trip, options);
+}
+
+TEST_F(OptionColumnFixture, ReferenceViewsAndSet) {
+  tmn::OptionColumn<std::string> column(std::vector<tmn::Option<std::string>>{
+    tmn::Option<std::string>(test_data.random_string), tmn::Option<std::string>()});
+
+  tmn::Option<std::string&> ref = column.get_ref(0);
+  ASSERT_TRUE(ref.has_value());
+  ref.value() += "!";
+  EXPECT_EQ(column.get(0).value(), test_data.random_string + "!");
+  EXPECT_FALSE(column.get_ref(1).has_value());
+
+  column.set(1, std::string("set"));
+  EXPECT_EQ(column.get(1), tmn::Option<std::string>("set"));
+
+  column.set_none(0);
+  EXPECT_FALSE(column.get(0).has_value());
+  EXPECT_EQ(column.values()[0], "") << "None slots hold a default value";
+  EXPECT_EQ(column.count_some(), 1);
+}
+
+TEST_F(OptionColumnFixture, ColumnIsSmallerThanOptionArray) {
+  tmn::OptionColumn<double> column;
+  column.append(std::vector<tmn::Option<double>>(1024, tmn::Option<double>(1.5)));
+
+  const std::size_t column_bytes = column.values().size_bytes() + column.validity().size_bytes();
+  EXPECT_LT(column_bytes * 3, sizeof(tmn::Option<double>) * 1024 * 2) << "At least 1.5x smaller";
+}
+
+namespace {
+
+// Counts the copies of the value (moves are free):
+struct CopyCounter {
+  static inline int copies = 0;
+
+  int value = 0;
+
+  CopyCounter() = default;
+  explicit CopyCounter(int val) : value(val) {}
+  CopyCounter(const CopyCounter& oth) : value(oth.value) { ++copies; }
+  CopyCounter(CopyCounter&&) noexcept = default;
+  CopyCounter& operator=(const CopyCounter& oth) { value = oth.value; ++copies; return *this; }
+  CopyCounter& operator=(CopyCounter&&) noexcept = default;
+};
+
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+// Copies throw once the budget of copies is spent (moves never throw):
+struct ThrowingCopy {
+  static inline int copies_left = 0;
+
+  int value = 0;
+
+  ThrowingCopy() = default;
+  explicit ThrowingCopy(int val) : value(val) {}
+  ThrowingCopy(const ThrowingCopy& oth) : value(oth.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+  }
+  ThrowingCopy(ThrowingCopy&&) noexcept = default;
+  ThrowingCopy& operator=(const ThrowingCopy& oth) = default;
+  ThrowingCopy& operator=(ThrowingCopy&&) noexcept = default;
+};
+
+// The bitmap has one word per 64 values, and every value is readable:
+void expect_consistent(const tmn::OptionColumn<ThrowingCopy>& column, std::size_t size, std::size_t some) {
+  EXPECT_EQ(column.size(), size);
+  EXPECT_EQ(column.validity().size(), (size + 63) / 64);
+  EXPECT_EQ(column.count_some(), some);
+  for (std::size_t i = 0; i < column.size(); ++i) EXPECT_TRUE(column.is_some(i) || column.values()[i].value == 0);
+}
+#endif
+
+template <typename T>
+concept ColumnOf = requires { typename tmn::OptionColumn<T>; };
+
+} // namespace;
+
+TEST(OptionColumnTest, BoolIsNotAColumnType) {
+  static_assert(ColumnOf<int>);
+  static_assert(!ColumnOf<bool>);
+}
+
+TEST(OptionColumnTest, AppendMovesFromOwningRvalueRanges) {
+  std::vector<tmn::Option<CopyCounter>> options(100, tmn::Option<CopyCounter>(CopyCounter(7)));
+  options[3] = tmn::Option<CopyCounter>();
+
+  tmn::OptionColumn<CopyCounter> column;
+  column.reserve(300);
+
+  CopyCounter::copies = 0;
+  column.append(options);
+  EXPECT_EQ(CopyCounter::copies, 99) << "An lvalue range is copied from";
+
+  CopyCounter::copies = 0;
+  column.append(std::span(options));
+  EXPECT_EQ(CopyCounter::copies, 99) << "A view refers to elements of another range: copied from";
+
+  CopyCounter::copies = 0;
+  column.append(std::move(options));
+  EXPECT_EQ(CopyCounter::copies, 0) << "An rvalue vector is moved from";
+
+  EXPECT_EQ(column.size(), 300);
+  EXPECT_EQ(column.count_some(), 297);
+  EXPECT_EQ(column.get(299).value().value, 7);
+}
+
+TEST(OptionColumnTest, FromPartsChecksTheBitmapSize) {
+  std::vector<int> values(65);
+  EXPECT_DEATH(tmn::OptionColumn<int>::from_parts(values, std::vector<std::uint64_t>(1)), "throwless panic");
+  EXPECT_EQ(tmn::OptionColumn<int>::from_parts(values, std::vector<std::uint64_t>(2)).size(), 65);
+}
+
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+TEST(OptionColumnTest, ThrowingCopyKeepsTheBitmapInStep) {
+  const ThrowingCopy value(7);
+  tmn::OptionColumn<ThrowingCopy> column;
+
+  ThrowingCopy::copies_left = 64;
+  for (int i = 0; i < 64; ++i) column.push_back(value);
+  EXPECT_THROW(column.push_back(value), std::runtime_error) << "The first value of a new word";
+  expect_consistent(column, 64, 64);
+
+  std::vector<tmn::Option<ThrowingCopy>> options(100);
+  for (std::size_t i = 0; i < options.size(); i += 2) options[i] = tmn::Option<ThrowingCopy>(ThrowingCopy(3));
+  column.push_none();
+
+  // 41 copies succeed: the elements 0..81 are appended (41 Some), the copy of element 82 throws:
+  ThrowingCopy::copies_left = 41;
+  EXPECT_THROW(column.append(options), std::runtime_error) << "In the middle of the second word";
+  expect_consistent(column, 65 + 82, 64 + 41);
+  EXPECT_TRUE(column.is_some(65 + 80));
+  EXPECT_TRUE(column.is_none(65 + 81));
+
+  ThrowingCopy::copies_left = 1000;
+  column.append(options);
+  expect_consistent(column, 65 + 82 + 100, 64 + 41 + 50);
+}
+#endif
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+#include "../../include/Option/Option.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../_TestUtils/RandomGenerator.hpp"
+#include "../_TestUtils/Failure.hpp"
+
+static_assert(sizeof(tmn::Option<int&>) == sizeof(int*), "None of Option<T&> must be the null pointer");
+static_assert(sizeof(tmn::Option<const std::string&>) == sizeof(void*), "None of Option<T&> must be the null pointer");
+
+class OptionRefFixture : public ::testing::Test {
+protected:
+  tmn::test_utils::RandomTestData test_data;
+};
+
+TEST_F(OptionRefFixture, NoneAndSome) {
+  tmn::Option<std::string&> none;
+  EXPECT_FALSE(none.has_value());
+  EXPECT_FALSE(static_cast<bool>(none));
+  TMN_EXPECT_FAILURE(none.value(), std::bad_optional_access);
+
+  tmn::Option<std::string&> some(test_data.random_string);
+  ASSERT_TRUE(some.has_value());
+  EXPECT_EQ(&some.value(), &test_data.random_string);
+}
+
+TEST_F(OptionRefFixture, RefersWithoutCopy) {
+  std::string original = test_data.random_string;
+  tmn::Option<std::string&> ref(original);
+
+  ref.value() += "_changed";
+  EXPECT_EQ(original, test_data.random_string + "_changed");
+
+  tmn::Option<std::string> copy = ref.cloned();
+  ASSERT_TRUE(copy.has_value());
+  EXPECT_EQ(copy.value(), original);
+}
+
+TEST_F(OptionRefFixture, ValueOrAndDestroy) {
+  int value = test_data.random_int_1;
+  int fallback = test_data.random_int_2;
+
+  tmn::Option<int&> ref(value);
+  EXPECT_EQ(&ref.value_or(fallback), &value);
+
+  EXPECT_TRUE(ref.destroy_value());
+  EXPECT_FALSE(ref.has_value());
+  EXPECT_EQ(value, test_data.random_int_1);
+  EXPECT_EQ(&ref.value_or(fallback), &fallback);
+}
+
+TEST_F(OptionRefFixture, EqualityComparesReferredValues) {
+  int a = test_data.random_int_1;
+  int b = test_data.random_int_1;
+
+  EXPECT_EQ(tmn::Option<int&>(a), tmn::Option<int&>(b));
+  EXPECT_EQ(tmn::Option<int&>(), tmn::Option<int&>());
+  EXPECT_FALSE(tmn::Option<int&>(a) == tmn::Option<int&>());
+}
+
+TEST_F(OptionRefFixture, FmapAndToResult) {
+  const std::string text = test_data.random_string;
+  tmn::Option<const std::string&> ref(text);
+
+  auto size = ref.fmap([](const std::string& s) { return s.size(); });
+  ASSERT_TRUE(size.has_value());
+  EXPECT_EQ(size.value(), text.size());
+
+  auto result = ref.to_result(tmn::err::StrErr("missing"));
+  ASSERT_TRUE(result.is_ok());
+  EXPECT_EQ(&result.unwrap_value(), &text);
+
+  auto missing = tmn::Option<const std::string&>().to_result(tmn::err::StrErr("missing"));
+  ASSERT_TRUE(missing.is_err());
+  EXPECT_EQ(missing.unwrap_err(), "missing");
+}
+
+TEST_F(OptionRefFixture, UncheckedAccess) {
+  std::string text = test_data.random_string;
+  tmn::Option<std::string&> ref(text);
+
+  EXPECT_EQ(&ref.value_unchecked(), &text);
+  EXPECT_EQ(&*ref, &text);
+  EXPECT_EQ(ref->size(), text.size());
+
+#ifndef NDEBUG
+  EXPECT_DEATH((void)tmn::Option<std::string&>().value_unchecked(), "unchecked access to the value of None");
+#endif
+}
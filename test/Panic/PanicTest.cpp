@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "../../include/Panic/Panic.hpp"
+#include "../../include/Option/Option.hpp"
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+
+namespace {
+
+// User handler: reports the message and ends the program with its own exit code;
+void exiting_handler(const char* message) {
+  std::fprintf(stderr, "user handler: %s\n", message);
+  std::exit(3);
+}
+
+void returning_handler(const char*) {}
+
+// Restores the default handler after the test:
+class PanicHandlerFixture : public ::testing::Test {
+protected:
+  void TearDown() override { tmn::set_panic_handler(nullptr); }
+};
+
+} // namespace;
+
+TEST_F(PanicHandlerFixture, DefaultHandlerAbortsWithMessage) {
+  EXPECT_EQ(tmn::get_panic_handler(), &tmn::panic_abort);
+  EXPECT_DEATH(tmn::panic("something broke"), "throwless panic: something broke");
+}
+
+TEST_F(PanicHandlerFixture, HandlerIsReplaceable) {
+  const tmn::PanicHandler previous = tmn::set_panic_handler(&exiting_handler);
+  EXPECT_EQ(previous, &tmn::panic_abort);
+  EXPECT_EQ(tmn::get_panic_handler(), &exiting_handler);
+
+  EXPECT_EXIT(tmn::panic("custom"), ::testing::ExitedWithCode(3), "user handler: custom");
+
+  tmn::set_panic_handler(nullptr);
+  EXPECT_EQ(tmn::get_panic_handler(), &tmn::panic_abort) << "nullptr restores the default handler";
+}
+
+TEST_F(PanicHandlerFixture, ReturningHandlerStillAborts) {
+  EXPECT_DEATH({
+    tmn::set_panic_handler(&returning_handler);
+    tmn::panic("returned");
+  }, "");
+}
+
+TEST_F(PanicHandlerFixture, TrapHandler) {
+  EXPECT_DEATH({
+    tmn::set_panic_handler(&tmn::panic_trap);
+    tmn::panic("trap");
+  }, "");
+}
+
+#ifdef TMN_THROWLESS_NO_EXCEPTIONS
+// Failures of the library reach the user handler instead of `throw`:
+TEST_F(PanicHandlerFixture, LibraryFailuresPanic) {
+  tmn::set_panic_handler(&exiting_handler);
+
+  tmn::Option<int> none;
+  EXPECT_EXIT((void)none.value(), ::testing::ExitedWithCode(3), "user handler: Option: access to the value of None");
+
+  auto failed = tmn::Result<int, tmn::err::StrErr>::Err("connection lost");
+  EXPECT_EXIT((void)failed.unwrap_value(), ::testing::ExitedWithCode(3), "user handler: connection lost");
+}
+#endif
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "../../include/Pipe/Pipe.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Error/OneOf.hpp"
+
+using tmn::pipe::fmap;
+using tmn::pipe::and_then;
+using tmn::pipe::eval;
+
+namespace {
+
+struct ParseErr {
+  std::string input;
+
+  std::string err_msg() const { return "not a number: " + input; }
+  const char* what() const noexcept { return "ParseErr"; }
+
+  bool operator==(const ParseErr& oth) const noexcept = default;
+};
+
+tmn::Result<int, ParseErr> parse(const std::string& text) {
+  if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+    return tmn::Result<int, ParseErr>::Err(ParseErr{text});
+  }
+  return tmn::Result<int, ParseErr>::Ok(std::stoi(text));
+}
+
+struct RangeErr {
+  int value = 0;
+
+  std::string err_msg() const { return "out of range: " + std::to_string(value); }
+  const char* what() const noexcept { return "RangeErr"; }
+
+  bool operator==(const RangeErr& oth) const noexcept = default;
+};
+
+tmn::Result<int, RangeErr> below_100(int x) {
+  if (x >= 100) return tmn::Result<int, RangeErr>::Err(RangeErr{x});
+  return tmn::Result<int, RangeErr>::Ok(x);
+}
+
+tmn::Option<int> positive(int x) { return x > 0 ? tmn::Option<int>(x) : tmn::Option<int>(); }
+
+// Counts the copies of the payload (the moves are free):
+struct Tracked {
+  static inline int copies = 0;
+  std::string text;
+
+  Tracked() = default;
+  explicit Tracked(std::string t) : text(std::move(t)) {}
+  Tracked(const Tracked& oth) : text(oth.text) { ++copies; }
+  Tracked(Tracked&&) noexcept = default;
+  Tracked& operator=(const Tracked& oth) { text = oth.text; ++copies; return *this; }
+  Tracked& operator=(Tracked&&) noexcept = default;
+};
+
+} // namespace;
+
+TEST(PipeTest, FmapChainMatchesTheEagerChain) {
+  const auto twice = [](int x) { return x * 2; };
+  const auto show = [](int x) { return std::to_string(x); };
+  const auto exclaim = [](const std::string& s) { return s + "!"; };
+
+  tmn::Option<int> some(21);
+  const tmn::Option<std::string> fused = some | fmap(twice) | fmap(show) | fmap(exclaim) | eval();
+  EXPECT_EQ(fused, some.fmap(twice).fmap(show).fmap(exclaim));
+  EXPECT_EQ(fused.value(), "42!");
+
+  tmn::Option<int> none;
+  EXPECT_FALSE((none | fmap(twice) | fmap(show) | eval()).has_value());
+}
+
+TEST(PipeTest, AndThenFlattensAndStopsTheChain) {
+  int calls = 0;
+  const auto counted = [&](int x) { ++calls; return x - 1; };
+
+  const tmn::Option<int> one(1);
+  EXPECT_EQ((one | fmap(counted) | and_then(positive) | fmap(counted) | eval()), tmn::Option<int>());
+  EXPECT_EQ(calls, 1); // the stages after the None are not run
+
+  const tmn::Option<int> five(5);
+  EXPECT_EQ((five | and_then(positive) | fmap(counted) | and_then(positive) | eval()), tmn::Option<int>(4));
+
+  // a plain value returned by and_then works as fmap:
+  EXPECT_EQ((five | and_then([](int x) { return x + 1; }) | eval()), tmn::Option<int>(6));
+}
+
+TEST(PipeTest, ResultChainsPropagateTheFirstError) {
+  const auto length = [](const std::string& s) { return static_cast<int>(s.size()); };
+  const auto as_text = [](int x) { return std::to_string(x); };
+
+  const tmn::Result<std::string, ParseErr> text = tmn::Result<std::string, ParseErr>::Ok("12345");
+  const auto ok = text | fmap(length) | fmap(as_text) | and_then(parse) | fmap([](int x) { return x * 10; }) | eval();
+  static_assert(std::is_same_v<std::remove_cvref_t<decltype(ok)>, tmn::Result<int, ParseErr>>);
+  EXPECT_EQ(ok.unwrap_value(), 50);
+
+  const auto failed = text | and_then(parse) | fmap(as_text) | fmap([](const std::string& s) { return s + "x"; }) | and_then(parse) | eval();
+  EXPECT_EQ(failed.unwrap_err(), ParseErr{"12345x"});
+
+  const auto source_err = tmn::Result<std::string, ParseErr>::Err(ParseErr{"src"});
+  EXPECT_EQ((source_err | fmap(length) | eval()).unwrap_err(), ParseErr{"src"});
+}
+
+TEST(PipeTest, DifferentErrorsAreWidenedLikeTheEagerChain) {
+  using Widened = tmn::err::OneOf<ParseErr, RangeErr>;
+  const auto text = tmn::Result<std::string, ParseErr>::Ok("42");
+
+  auto eager = text.and_then(parse).and_then(below_100);
+  const auto piped = text | and_then(parse) | and_then(below_100) | eval();
+  static_assert(std::is_same_v<decltype(eager), tmn::Result<int, Widened>>);
+  static_assert(std::is_same_v<std::remove_cvref_t<decltype(piped)>, decltype(eager)>);
+  EXPECT_EQ(piped.unwrap_value(), 42);
+
+  const auto too_large = tmn::Result<std::string, ParseErr>::Ok("420") | and_then(parse) | and_then(below_100) | eval();
+  EXPECT_TRUE(too_large.unwrap_err().is<RangeErr>());
+
+  const auto not_a_number = tmn::Result<std::string, ParseErr>::Ok("4x") | and_then(parse) | and_then(below_100) | eval();
+  EXPECT_TRUE(not_a_number.unwrap_err().is<ParseErr>());
+
+  const auto source_err = tmn::Result<std::string, ParseErr>::Err(ParseErr{"src"}) | and_then(parse) | and_then(below_100) | eval();
+  EXPECT_TRUE(source_err.unwrap_err().is<ParseErr>());
+}
+
+TEST(PipeTest, OptionAndThenFlattensUnlikeTheEagerChain) {
+  const tmn::Option<int> five(5);
+
+  // the eager Option::and_then keeps the Option returned by fn:
+  const auto eager = five.and_then(positive);
+  static_assert(std::is_same_v<std::remove_cvref_t<decltype(eager)>, tmn::Option<tmn::Option<int>>>);
+
+  const auto piped = five | and_then(positive) | eval();
+  static_assert(std::is_same_v<std::remove_cvref_t<decltype(piped)>, tmn::Option<int>>);
+  EXPECT_EQ(piped, eager.value());
+
+  const tmn::Option<int> zero(0);
+  EXPECT_TRUE(zero.and_then(positive).has_value()) << "Some(None) in the eager chain";
+  EXPECT_FALSE((zero | and_then(positive) | eval()).has_value()) << "None in the pipeline";
+}
+
+TEST(PipeTest, SourceIsReadInPlace) {
+  tmn::Option<Tracked> source(Tracked("payload"));
+
+  Tracked::copies = 0;
+  const auto size = source | fmap([](const Tracked& t) { return t.text.size(); }) | eval();
+  EXPECT_EQ(size.value(), 7U);
+  EXPECT_EQ(Tracked::copies, 0);
+
+  // the payload of an expiring source is moved through the chain:
+  const auto moved = std::move(source) | fmap([](Tracked&& t) { return std::move(t); })
+                                       | fmap([](Tracked&& t) { t.text += "!"; return std::move(t); }) | eval();
+  EXPECT_EQ(moved.value().text, "payload!");
+  EXPECT_EQ(Tracked::copies, 0);
+}
+
+TEST(PipeTest, PipelineCanBeStoredAndEvaluatedLater) {
+  const std::vector<int> data{1, 2, 3};
+  auto pipeline = tmn::Option<std::vector<int>>(data) | fmap([](const std::vector<int>& v) { return v.size(); });
+  auto extended = std::move(pipeline) | fmap([](std::size_t n) { return n * 2; });
+  EXPECT_EQ(std::move(extended).eval(), tmn::Option<std::size_t>(6));
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <stdexcept>
+
+#include "../../include/Propagation/Coroutine.hpp"
+#include "../../include/Error/Error.hpp"
+
+namespace {
+
+tmn::Result<int, tmn::err::StrErr> parse_digit(char c) {
+  if (c < '0' || c > '9') return tmn::Result<int, tmn::err::StrErr>::Err("not a digit");
+  return tmn::Result<int, tmn::err::StrErr>::Ok(c - '0');
+}
+
+tmn::Result<int, tmn::err::StrErr> parse_two_digits(std::string s) {
+  int high = co_await parse_digit(s[0]);
+  int low = co_await parse_digit(s[1]);
+  co_return high * 10 + low;
+}
+
+tmn::Result<std::string, tmn::err::AnyErr> describe(std::string s) {
+  int value = co_await parse_two_digits(s);
+  co_return "value=" + std::to_string(value);
+}
+
+tmn::Result<int, tmn::err::StrErr> explicit_err(int x) {
+  int value = co_await parse_digit(static_cast<char>('0' + x));
+  if (value > 5) co_return tmn::Result<int, tmn::err::StrErr>::Err("too big");
+  co_return value;
+}
+
+tmn::Option<int> half(int x) {
+  if (x % 2 != 0) return tmn::Option<int>();
+  return tmn::Option<int>(x / 2);
+}
+
+tmn::Option<int> quarter(int x) {
+  int h = co_await half(x);
+  co_return co_await half(h);
+}
+
+tmn::Result<void, tmn::err::StrErr> check_digits(std::string s) {
+  for (char c : s) {
+    co_await parse_digit(c);
+  }
+}
+
+tmn::Result<int, tmn::err::StrErr> sum_digits(std::string s, std::size_t pos) {
+  if (pos == s.size()) co_return 0;
+  int digit = co_await parse_digit(s[pos]);
+  int rest = co_await sum_digits(s, pos + 1);
+  co_return digit + rest;
+}
+
+tmn::Result<int&, tmn::err::StrErr> element(int* data, std::size_t size, std::size_t i) {
+  if (i >= size) co_return tmn::Result<int&, tmn::err::StrErr>::Err("out of range");
+  co_return data[i];
+}
+
+tmn::Result<int*, tmn::err::StrErr> element_address(int* data, std::size_t size, std::size_t i) {
+  int& ref = co_await element(data, size, i);
+  co_return &ref;
+}
+
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+tmn::Result<int, tmn::err::StrErr> throwing_digit(char c) {
+  int digit = co_await parse_digit(c);
+  if (digit == 0) throw std::runtime_error("zero");
+  co_return digit;
+}
+#endif
+
+} // namespace;
+
+TEST(CoroutinePropagationTest, ResultPropagation) {
+  auto ok = parse_two_digits("42");
+  ASSERT_TRUE(ok.is_ok());
+  EXPECT_EQ(ok.unwrap_value(), 42);
+
+  auto err = parse_two_digits("x2");
+  ASSERT_TRUE(err.is_err());
+  EXPECT_EQ(err.unwrap_err(), "not a digit");
+}
+
+TEST(CoroutinePropagationTest, ErrorConversion) {
+  auto ok = describe("17");
+  ASSERT_TRUE(ok.is_ok());
+  EXPECT_EQ(ok.unwrap_value(), "value=17");
+
+  auto err = describe("1y");
+  ASSERT_TRUE(err.is_err());
+  EXPECT_EQ(err.unwrap_err().err_msg(), "not a digit");
+}
+
+TEST(CoroutinePropagationTest, CoReturnResult) {
+  EXPECT_EQ(explicit_err(3).unwrap_value(), 3);
+  ASSERT_TRUE(explicit_err(8).is_err());
+  EXPECT_EQ(explicit_err(8).unwrap_err(), "too big");
+}
+
+TEST(CoroutinePropagationTest, OptionPropagation) {
+  EXPECT_EQ(quarter(12).value(), 3);
+  EXPECT_FALSE(quarter(6).has_value());
+  EXPECT_FALSE(quarter(7).has_value());
+}
+
+TEST(CoroutinePropagationTest, VoidResult) {
+  EXPECT_TRUE(check_digits("123").is_ok());
+  EXPECT_TRUE(check_digits("1a3").is_err());
+}
+
+TEST(CoroutinePropagationTest, NestedCoroutines) {
+  EXPECT_EQ(sum_digits("12345", 0).unwrap_value(), 15);
+  EXPECT_EQ(sum_digits("123z5", 0).unwrap_err(), "not a digit");
+}
+
+TEST(CoroutinePropagationTest, ReferencesAreNotCopied) {
+  int data[3] = {1, 2, 3};
+
+  auto address = element_address(data, 3, 1);
+  ASSERT_TRUE(address.is_ok());
+  EXPECT_EQ(address.unwrap_value(), &data[1]);
+  EXPECT_TRUE(element_address(data, 3, 5).is_err());
+}
+
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+TEST(CoroutinePropagationTest, ExceptionReachesTheCaller) {
+  // the frame is destroyed before the rethrow (a rethrow from unhandled_exception would leave
+  // it suspended: a leaked frame per call);
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_THROW(throwing_digit('0'), std::runtime_error);
+  }
+  EXPECT_EQ(throwing_digit('7').unwrap_value(), 7);
+  EXPECT_EQ(sum_digits("12345", 0).unwrap_value(), 15);
+}
+#endif
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../../include/Propagation/Try.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../_TestUtils/Utils.hpp"
+
+namespace {
+
+tmn::Result<int, tmn::err::StrErr> parse_digit(char c) {
+  if (c < '0' || c > '9') return tmn::Result<int, tmn::err::StrErr>::Err("not a digit");
+  return tmn::Result<int, tmn::err::StrErr>::Ok(c - '0');
+}
+
+tmn::Result<int, tmn::err::StrErr> parse_two_digits(const std::string& s) {
+  int high = TMN_TRY(parse_digit(s[0]));
+  int low = TMN_TRY(parse_digit(s[1]));
+  return tmn::Result<int, tmn::err::StrErr>::Ok(high * 10 + low);
+}
+
+// Error type of the caller may differ from the error type of the callee:
+tmn::Result<std::string, tmn::err::AnyErr> describe(const std::string& s) {
+  int value = TMN_TRY(parse_two_digits(s));
+  return tmn::Result<std::string, tmn::err::AnyErr>::Ok("value=" + std::to_string(value));
+}
+
+tmn::Option<int> half(int x) {
+  if (x % 2 != 0) return tmn::Option<int>();
+  return tmn::Option<int>(x / 2);
+}
+
+tmn::Option<int> quarter(int x) {
+  int h = TMN_TRY(half(x));
+  return half(h);
+}
+
+tmn::Result<void, tmn::err::StrErr> check_digit(char c) {
+  TMN_TRY(parse_digit(c));
+  return tmn::Result<void, tmn::err::StrErr>::Ok();
+}
+
+} // namespace;
+
+TEST(TryMacroTest, ResultPropagation) {
+  auto ok = parse_two_digits("42");
+  ASSERT_TRUE(ok.is_ok());
+  EXPECT_EQ(ok.unwrap_value(), 42);
+
+  auto err = parse_two_digits("4x");
+  ASSERT_TRUE(err.is_err());
+  EXPECT_EQ(err.unwrap_err(), "not a digit");
+}
+
+TEST(TryMacroTest, ErrorConversion) {
+  auto ok = describe("17");
+  ASSERT_TRUE(ok.is_ok());
+  EXPECT_EQ(ok.unwrap_value(), "value=17");
+
+  auto err = describe("x7");
+  ASSERT_TRUE(err.is_err());
+  EXPECT_EQ(err.unwrap_err().err_msg(), "not a digit");
+}
+
+TEST(TryMacroTest, OptionPropagation) {
+  EXPECT_EQ(quarter(12).value(), 3);
+  EXPECT_FALSE(quarter(6).has_value());
+  EXPECT_FALSE(quarter(7).has_value());
+}
+
+TEST(TryMacroTest, VoidResult) {
+  EXPECT_TRUE(check_digit('1').is_ok());
+  EXPECT_TRUE(check_digit('a').is_err());
+}
+
+TEST(TryMacroTest, MovesOutOfRvalues) {
+  tmn::test_utils::TestObject::reset_counts();
+
+  auto make = []() {
+    return tmn::Result<tmn::test_utils::TestObject, tmn::err::StrErr>::Ok(tmn::test_utils::TestObject(7));
+  };
+  auto use = [&]() -> tmn::Result<int, tmn::err::StrErr> {
+    const int copies_before = tmn::test_utils::TestObject::copy_count;
+    tmn::test_utils::TestObject obj = TMN_TRY(make());
+    EXPECT_EQ(tmn::test_utils::TestObject::copy_count, copies_before);
+    return tmn::Result<int, tmn::err::StrErr>::Ok(obj.value);
+  };
+
+  EXPECT_EQ(use().unwrap_value(), 7);
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <list>
+#include <string>
+#include <vector>
+#include <ranges>
+#include <memory>
+
+#include "../../include/Ranges/Collect.hpp"
+#include "../../include/Error/Error.hpp"
+
+namespace {
+
+struct ParseErr {
+  std::string input;
+
+  std::string err_msg() const { return "not a number: " + input; }
+  const char* what() const noexcept { return "ParseErr"; }
+
+  bool operator==(const ParseErr& oth) const noexcept = default;
+};
+
+tmn::Result<int, ParseErr> parse(const std::string& text) {
+  if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+    return tmn::Result<int, ParseErr>::Err(ParseErr{text});
+  }
+  return tmn::Result<int, ParseErr>::Ok(std::stoi(text));
+}
+
+// Counts the copies of the payload (the moves are free):
+struct Tracked {
+  static inline int copies = 0;
+  std::string text;
+
+  Tracked() = default;
+  explicit Tracked(std::string t) : text(std::move(t)) {}
+  Tracked(const Tracked& oth) : text(oth.text) { ++copies; }
+  Tracked(Tracked&&) noexcept = default;
+  Tracked& operator=(const Tracked& oth) { text = oth.text; ++copies; return *this; }
+  Tracked& operator=(Tracked&&) noexcept = default;
+};
+
+} // namespace;
+
+TEST(CollectTest, OptionsIntoVector) {
+  const std::vector<tmn::Option<int>> options{tmn::Option<int>(1), tmn::Option<int>(2), tmn::Option<int>(3)};
+  EXPECT_EQ(tmn::collect<std::vector>(options), tmn::Option<std::vector<int>>(std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(tmn::collect<std::list<int>>(options).value(), (std::list<int>{1, 2, 3}));
+
+  const std::vector<tmn::Option<int>> with_none{tmn::Option<int>(1), tmn::Option<int>(), tmn::Option<int>(3)};
+  EXPECT_FALSE(tmn::collect<std::vector>(with_none).has_value());
+
+  EXPECT_EQ(tmn::collect<std::vector>(std::vector<tmn::Option<int>>{}).value(), std::vector<int>{});
+}
+
+TEST(CollectTest, ResultsStopAtTheFirstError) {
+  const std::vector<std::string> lines{"10", "x", "30", "y"};
+  int calls = 0;
+  auto parsed = lines | std::views::transform([&](const std::string& line) {
+    ++calls;
+    return parse(line);
+  });
+
+  const auto numbers = tmn::collect<std::vector>(parsed);
+  ASSERT_TRUE(numbers.is_err());
+  EXPECT_EQ(numbers.unwrap_err(), ParseErr{"x"});
+  EXPECT_EQ(calls, 2); // the lazy view is not read past the failure
+
+  const std::vector<std::string> valid{"10", "20", "20"};
+  EXPECT_EQ(tmn::collect<std::vector>(valid | std::views::transform(parse)).unwrap_value(), (std::vector<int>{10, 20, 20}));
+  EXPECT_EQ(tmn::collect<std::set<int>>(valid | std::views::transform(parse)).unwrap_value(), (std::set<int>{10, 20}));
+}
+
+TEST(CollectTest, AllErrorsAreCollected) {
+  const std::vector<std::string> lines{"10", "x", "30", "y"};
+  const auto numbers = tmn::collect_all_errors<std::vector>(lines | std::views::transform(parse));
+  ASSERT_TRUE(numbers.is_err());
+  ASSERT_EQ(numbers.unwrap_err().size(), 2U);
+  EXPECT_EQ(numbers.unwrap_err()[0], ParseErr{"x"});
+  EXPECT_EQ(numbers.unwrap_err()[1], ParseErr{"y"});
+  EXPECT_EQ(numbers.unwrap_err().err_msg(), "not a number: x; not a number: y");
+
+  const std::vector<std::string> valid{"1", "2"};
+  EXPECT_EQ(tmn::collect_all_errors<std::vector>(valid | std::views::transform(parse)).unwrap_value(), (std::vector<int>{1, 2}));
+}
+
+TEST(CollectTest, PayloadsAreMovedFromExpiringRanges) {
+  std::vector<tmn::Option<Tracked>> options;
+  for (int i = 0; i < 10; ++i) options.emplace_back(Tracked(std::to_string(i)));
+
+  Tracked::copies = 0;
+  const auto copied = tmn::collect<std::vector>(options); // lvalue container: copies
+  EXPECT_EQ(Tracked::copies, 10);
+
+  Tracked::copies = 0;
+  const auto moved = tmn::collect<std::vector>(std::move(options)); // expiring container: moves
+  EXPECT_EQ(Tracked::copies, 0);
+  ASSERT_TRUE(moved.has_value());
+  EXPECT_EQ(moved.value()[9].text, "9");
+
+  // temporaries produced by a view are moved as well:
+  Tracked::copies = 0;
+  const auto from_view = tmn::collect<std::vector>(std::views::iota(0, 10) | std::views::transform([](int i) {
+    return tmn::Option<Tracked>(Tracked(std::to_string(i)));
+  }));
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(from_view.value().size(), 10U);
+}
+
+TEST(CollectTest, MoveOnlyContainerElements) {
+  std::vector<tmn::Option<std::shared_ptr<int>>> options;
+  options.emplace_back(std::make_shared<int>(5));
+  const auto collected = tmn::collect<std::vector>(std::move(options));
+  ASSERT_TRUE(collected.has_value());
+  EXPECT_EQ(*collected.value()[0], 5);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <vector>
+#include <ranges>
+#include <iterator>
+
+#include "../../include/Ranges/Views.hpp"
+#include "../../include/Ranges/Collect.hpp"
+#include "../../include/Error/Error.hpp"
+
+namespace {
+
+struct ParseErr {
+  std::string input;
+
+  std::string err_msg() const { return "not a number: " + input; }
+  const char* what() const noexcept { return "ParseErr"; }
+
+  bool operator==(const ParseErr& oth) const noexcept = default;
+};
+
+tmn::Result<int, ParseErr> parse(const std::string& text) {
+  if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+    return tmn::Result<int, ParseErr>::Err(ParseErr{text});
+  }
+  return tmn::Result<int, ParseErr>::Ok(std::stoi(text));
+}
+
+tmn::Option<int> parse_opt(const std::string& text) {
+  auto res = parse(text);
+  return res.is_ok() ? tmn::Option<int>(res.unwrap_value()) : tmn::Option<int>();
+}
+
+template <typename R>
+auto to_vector(R&& range) {
+  std::vector<std::remove_cvref_t<std::ranges::range_reference_t<R>>> result;
+  for (auto&& elem : range) result.push_back(elem);
+  return result;
+}
+
+} // namespace;
+
+TEST(ViewsTest, SomeYieldsReferencesIntoTheElements) {
+  std::vector<tmn::Option<int>> options{tmn::Option<int>(1), tmn::Option<int>(), tmn::Option<int>(3), tmn::Option<int>()};
+  auto values = options | tmn::views::some;
+  static_assert(std::ranges::forward_range<decltype(values)>);
+  static_assert(std::same_as<std::ranges::range_reference_t<decltype(values)>, int&>);
+
+  EXPECT_EQ(to_vector(values), (std::vector<int>{1, 3}));
+
+  for (int& value : values) value *= 10;
+  EXPECT_EQ(options[0], tmn::Option<int>(10));
+  EXPECT_EQ(options[2], tmn::Option<int>(30));
+
+  const std::list<tmn::Option<int>> none(3);
+  EXPECT_TRUE(to_vector(tmn::views::some(none)).empty());
+}
+
+TEST(ViewsTest, OkAndErrsSplitResults) {
+  const std::vector<tmn::Result<int, ParseErr>> results{parse("1"), parse("x"), parse("3"), parse("")};
+  EXPECT_EQ(to_vector(results | tmn::views::ok), (std::vector<int>{1, 3}));
+  EXPECT_EQ(to_vector(results | tmn::views::errs), (std::vector<ParseErr>{ParseErr{"x"}, ParseErr{""}}));
+  static_assert(std::same_as<std::ranges::range_reference_t<decltype(results | tmn::views::ok)>, const int&>);
+}
+
+TEST(ViewsTest, ElementsProducedByValueAreComputedOnce) {
+  const std::vector<std::string> lines{"1", "x", "3", "4", "y"};
+  int calls = 0;
+  auto parsed = lines | std::views::transform([&](const std::string& line) {
+    ++calls;
+    return parse(line);
+  });
+
+  EXPECT_EQ(to_vector(parsed | tmn::views::ok), (std::vector<int>{1, 3, 4}));
+  EXPECT_EQ(calls, 5);
+}
+
+TEST(ViewsTest, AndThenFlattensOptionReturningFunctions) {
+  const std::vector<std::string> lines{"10", "x", "30"};
+  int calls = 0;
+  auto numbers = lines | tmn::views::and_then([&](const std::string& line) {
+    ++calls;
+    return parse_opt(line);
+  });
+  EXPECT_EQ(to_vector(numbers), (std::vector<int>{10, 30}));
+  EXPECT_EQ(calls, 3);
+
+  // over Options: fn sees only the present values;
+  const std::vector<tmn::Option<int>> options{tmn::Option<int>(4), tmn::Option<int>(), tmn::Option<int>(-1), tmn::Option<int>(9)};
+  const auto positive_half = [](int x) { return x > 0 ? tmn::Option<double>(x / 2.0) : tmn::Option<double>(); };
+  EXPECT_EQ(to_vector(options | tmn::views::and_then(positive_half)), (std::vector<double>{2.0, 4.5}));
+}
+
+TEST(ViewsTest, TransformOkMapsValuesAndKeepsErrors) {
+  const std::vector<tmn::Result<int, ParseErr>> results{parse("2"), parse("x"), parse("5")};
+  auto doubled = results | tmn::views::transform_ok([](int x) { return std::to_string(x * 2); });
+
+  const auto out = to_vector(doubled);
+  ASSERT_EQ(out.size(), 3U);
+  EXPECT_EQ(out[0].unwrap_value(), "4");
+  EXPECT_EQ(out[1].unwrap_err(), ParseErr{"x"});
+  EXPECT_EQ(out[2].unwrap_value(), "10");
+
+  EXPECT_EQ(to_vector(doubled | tmn::views::ok), (std::vector<std::string>{"4", "10"}));
+}
+
+TEST(ViewsTest, ComposesWithCollectAndStandardViews) {
+  const std::vector<std::string> lines{"1", "2", "x", "4"};
+  auto firsts = lines | std::views::transform(parse) | tmn::views::ok | std::views::take(2);
+  EXPECT_EQ(to_vector(firsts), (std::vector<int>{1, 2}));
+
+  const auto collected = tmn::collect<std::vector>(lines | std::views::transform(parse) | tmn::views::transform_ok([](int x) { return x + 1; }));
+  EXPECT_EQ(collected.unwrap_err(), ParseErr{"x"});
+}
@@ -7,6 +7,7 @@
 #include "../../include/Error/Error.hpp"
 #include "../../include/Error/ErrorConcept.hpp"
 #include "../_TestUtils/RandomGenerator.hpp"
+#include "../_TestUtils/Failure.hpp"
 
 namespace tmn::test_utils {
 
@@ -195,7 +196,7 @@ TEST_F(ResultValueAccessFixture, ValueAccessOk) {
 }
 
 TEST_F(ResultValueAccessFixture, ValueAccessErrThrows) {
-  EXPECT_THROW(err_result.unwrap_value(), std::runtime_error);
+  TMN_EXPECT_FAILURE(err_result.unwrap_value(), std::runtime_error);
 }
 
 TEST_F(ResultValueAccessFixture, ValueOrWithOk) {
@@ -219,7 +220,7 @@ protected:
 };
 
 TEST_F(ResultErrAccessFixture, ErrAccessOkThrows) {
-  EXPECT_THROW(ok_result.unwrap_err(), std::runtime_error);
+  TMN_EXPECT_FAILURE(ok_result.unwrap_err(), std::runtime_error);
 }
 
 TEST_F(ResultErrAccessFixture, ErrAccessErr) {
@@ -330,3 +331,33 @@ TEST_F(ResultSwapFixture, SwapResults) {
   ASSERT_TRUE(result2.is_ok());
   EXPECT_EQ(result2.unwrap_value(), test_data.random_int_1);
 }
+
+class ResultUncheckedAccessFixture : public ::testing::Test {
+protected:
+  tmn::test_utils::RandomTestData test_data;
+  tmn::Result<int, tmn::err::StrErr> ok_result = tmn::Result<int, tmn::err::StrErr>::Ok(test_data.random_int_1);
+  tmn::Result<int, tmn::err::StrErr> err_result = tmn::Result<int, tmn::err::StrErr>::Err(test_data.random_string);
+};
+
+TEST_F(ResultUncheckedAccessFixture, AccessAfterCheck) {
+  ASSERT_TRUE(ok_result.is_ok());
+  EXPECT_EQ(ok_result.unwrap_unchecked(), test_data.random_int_1);
+  EXPECT_EQ(&ok_result.unwrap_unchecked(), &ok_result.unwrap_value());
+
+  ASSERT_TRUE(err_result.is_err());
+  EXPECT_EQ(err_result.unwrap_err_unchecked(), test_data.random_string);
+
+  auto done = tmn::Result<void, tmn::err::StrErr>::Ok();
+  done.unwrap_unchecked();
+
+  int value = test_data.random_int_2;
+  auto ref = tmn::Result<int&, tmn::err::StrErr>::Ok(value);
+  EXPECT_EQ(&ref.unwrap_unchecked(), &value);
+}
+
+#ifndef NDEBUG
+TEST_F(ResultUncheckedAccessFixture, WrongStateIsCheckedInDebugBuilds) {
+  EXPECT_DEATH((void)err_result.unwrap_unchecked(), "unchecked access to the value of Err");
+  EXPECT_DEATH((void)ok_result.unwrap_err_unchecked(), "unchecked access to the error of Ok");
+}
+#endif
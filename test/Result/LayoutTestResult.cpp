@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+
+namespace tmn::test_utils {
+
+struct SmallCodeErr {
+  std::uint8_t code = 0;
+
+  std::string err_msg() const { return "Error code: " + std::to_string(code); }
+  const char* what() const noexcept { return "SmallCodeErr"; }
+
+  bool operator==(const SmallCodeErr& oth) const noexcept = default;
+};
+
+struct IntCodeErr {
+  int code = 0;
+
+  std::string err_msg() const { return "Error code: " + std::to_string(code); }
+  const char* what() const noexcept { return "IntCodeErr"; }
+
+  bool operator==(const IntCodeErr& oth) const noexcept = default;
+};
+
+struct LayoutRow {
+  const char* name;
+  std::size_t actual;
+  std::size_t expected;
+};
+
+} // namespace tmn::test_utils;
+
+TEST(ResultLayoutTest, SizeofTable) {
+  using namespace tmn::test_utils;
+  using tmn::Result;
+
+  const LayoutRow table[] = {
+    {"Result<uint8_t, SmallCodeErr>", sizeof(Result<std::uint8_t, SmallCodeErr>), 2},
+    {"Result<int16_t, SmallCodeErr>", sizeof(Result<std::int16_t, SmallCodeErr>), 4},
+    {"Result<int, IntCodeErr>", sizeof(Result<int, IntCodeErr>), 8},
+    {"Result<double, IntCodeErr>", sizeof(Result<double, IntCodeErr>), 16},
+    // a union of 7 bytes: 8 with the one-byte state, an int-sized one would make it 12:
+    {"Result<std::array<char, 7>, SmallCodeErr>", sizeof(Result<std::array<char, 7>, SmallCodeErr>), 8},
+#if UINTPTR_MAX == UINT64_MAX
+    // the errors of the library are 56 bytes with 64-bit pointers (vtable pointer and ErrMsg),
+    // the state takes the next 8-byte slot:
+    {"Result<int, StrErr>", sizeof(Result<int, tmn::err::StrErr>), 64},
+    {"Result<std::string, AnyErr>", sizeof(Result<std::string, tmn::err::AnyErr>), 64},
+    {"Result<std::string, OutOfRangeErr>", sizeof(Result<std::string, tmn::err::OutOfRangeErr>), 64},
+#endif
+  };
+
+  for (const auto& row : table) {
+    EXPECT_EQ(row.actual, row.expected) << "Unexpected sizeof(" << row.name << ")";
+  }
+}
+
+TEST(ResultLayoutTest, MovedFromResultKeepsState) {
+  auto ok_source = tmn::Result<std::string, tmn::err::StrErr>::Ok("payload");
+  auto ok_target = std::move(ok_source);
+
+  ASSERT_TRUE(ok_target.is_ok());
+  EXPECT_EQ(ok_target.unwrap_value(), "payload");
+  // moved-from value is valid but unspecified, the state is kept:
+  EXPECT_TRUE(ok_source.is_ok());
+
+  auto err_source = tmn::Result<std::string, tmn::err::StrErr>::Err("failure");
+  auto err_target = std::move(err_source);
+
+  ASSERT_TRUE(err_target.is_err());
+  EXPECT_EQ(err_target.unwrap_err(), "failure");
+  EXPECT_TRUE(err_source.is_err());
+
+  // moved-from Result can be reassigned:
+  err_source = tmn::Result<std::string, tmn::err::StrErr>::Ok("again");
+  ASSERT_TRUE(err_source.is_ok());
+  EXPECT_EQ(err_source.unwrap_value(), "again");
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../_TestUtils/RandomGenerator.hpp"
+#include "../_TestUtils/Failure.hpp"
+
+class ResultRefFixture : public ::testing::Test {
+protected:
+  tmn::test_utils::RandomTestData test_data;
+};
+
+TEST_F(ResultRefFixture, OkRefersWithoutCopy) {
+  std::string value = test_data.random_string;
+  auto result = tmn::Result<std::string&, tmn::err::StrErr>::Ok(value);
+
+  ASSERT_TRUE(result.is_ok());
+  EXPECT_EQ(&result.unwrap_value(), &value);
+
+  result.unwrap_value() += "_changed";
+  EXPECT_EQ(value, test_data.random_string + "_changed");
+
+  auto option = result.to_option();
+  ASSERT_TRUE(option.has_value());
+  EXPECT_EQ(&option.value(), &value);
+}
+
+TEST_F(ResultRefFixture, ErrAccess) {
+  std::string fallback = test_data.random_string;
+  auto result = tmn::Result<std::string&, tmn::err::StrErr>::Err("failure");
+
+  ASSERT_TRUE(result.is_err());
+  EXPECT_EQ(result.unwrap_err(), "failure");
+  TMN_EXPECT_FAILURE(result.unwrap_value(), std::runtime_error);
+  EXPECT_EQ(&result.unwrap_value_or(fallback), &fallback);
+  EXPECT_FALSE(result.to_option().has_value());
+}
+
+TEST_F(ResultRefFixture, CopyAndAssignment) {
+  int a = test_data.random_int_1;
+  int b = test_data.random_int_2;
+
+  auto first = tmn::Result<int&, tmn::err::StrErr>::Ok(a);
+  auto second = tmn::Result<int&, tmn::err::StrErr>::Ok(b);
+  auto copied = first;
+  EXPECT_EQ(&copied.unwrap_value(), &a);
+
+  // assignment rebinds the reference instead of assigning through it:
+  copied = second;
+  EXPECT_EQ(&copied.unwrap_value(), &b);
+  EXPECT_EQ(a, test_data.random_int_1);
+
+  copied = tmn::Result<int&, tmn::err::StrErr>::Err("error");
+  EXPECT_TRUE(copied.is_err());
+}
+
+TEST_F(ResultRefFixture, FmapOverReference) {
+  int value = test_data.random_int_1;
+  auto result = tmn::Result<int&, tmn::err::StrErr>::Ok(value);
+
+  auto doubled = result.fmap([](int& x) { return x * 2; });
+  ASSERT_TRUE(doubled.is_ok());
+  EXPECT_EQ(doubled.unwrap_value(), test_data.random_int_1 * 2);
+
+  auto err = tmn::Result<int&, tmn::err::StrErr>::Err("error").fmap([](int& x) { return x * 2; });
+  ASSERT_TRUE(err.is_err());
+  EXPECT_EQ(err.unwrap_err(), "error");
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "../../include/Result/Result.hpp"
+#include "../../include/Error/Error.hpp"
+#include "../../include/Error/TryOrConvert.hpp"
+#include "../_TestUtils/Failure.hpp"
+
+namespace tmn::test_utils {
+
+struct StatusErr {
+  int code = 0;
+
+  std::string err_msg() const { return "Status code: " + std::to_string(code); }
+  const char* what() const noexcept { return "StatusErr"; }
+
+  bool operator==(const StatusErr& oth) const noexcept = default;
+};
+
+} // namespace tmn::test_utils;
+
+// Success case stores nothing: only the error and the discriminant remain:
+static_assert(sizeof(tmn::Result<void, tmn::test_utils::StatusErr>) == 2 * sizeof(int));
+static_assert(sizeof(tmn::Result<void, tmn::err::StrErr>) == sizeof(tmn::err::StrErr) + alignof(tmn::err::StrErr));
+
+using StatusResult = tmn::Result<void, tmn::test_utils::StatusErr>;
+
+TEST(VoidResultTest, OkAndErr) {
+  StatusResult ok = StatusResult::Ok();
+  ASSERT_TRUE(ok.is_ok());
+  EXPECT_FALSE(ok.is_err());
+  EXPECT_TRUE(static_cast<bool>(ok));
+  TMN_EXPECT_NO_FAILURE(ok.unwrap_value());
+  TMN_EXPECT_FAILURE(ok.unwrap_err(), std::runtime_error);
+
+  StatusResult err = StatusResult::Err(7);
+  ASSERT_TRUE(err.is_err());
+  EXPECT_EQ(err.unwrap_err().code, 7);
+  TMN_EXPECT_FAILURE(err.unwrap_value(), std::runtime_error);
+  EXPECT_FALSE(err.unwrap_err_to_optional().value() != tmn::test_utils::StatusErr{7});
+}
+
+TEST(VoidResultTest, CopyMoveAndSwap) {
+  StatusResult ok = StatusResult::Ok();
+  StatusResult err = StatusResult::Err(3);
+
+  StatusResult copied = err;
+  ASSERT_TRUE(copied.is_err());
+  EXPECT_EQ(copied.unwrap_err().code, 3);
+
+  copied = ok;
+  EXPECT_TRUE(copied.is_ok());
+
+  StatusResult moved = std::move(err);
+  ASSERT_TRUE(moved.is_err());
+
+  std::swap(ok, moved);
+  EXPECT_TRUE(ok.is_err());
+  EXPECT_TRUE(moved.is_ok());
+}
+
+TEST(VoidResultTest, FmapAndThenOverVoid) {
+  int calls = 0;
+
+  auto ok_mapped = StatusResult::Ok().fmap([&calls]() { ++calls; return 42; });
+  ASSERT_TRUE(ok_mapped.is_ok());
+  EXPECT_EQ(ok_mapped.unwrap_value(), 42);
+
+  auto err_mapped = StatusResult::Err(1).fmap([&calls]() { ++calls; return 42; });
+  ASSERT_TRUE(err_mapped.is_err());
+  EXPECT_EQ(err_mapped.unwrap_err().code, 1);
+
+  auto chained = StatusResult::Ok().and_then([&calls]() { ++calls; });
+  EXPECT_TRUE(chained.is_ok());
+  EXPECT_EQ(calls, 2);
+
+  auto err_converted = StatusResult::Err(5).fmap_err([](const tmn::test_utils::StatusErr& e) {
+    return tmn::err::StrErr(e.err_msg());
+  });
+  ASSERT_TRUE(err_converted.is_err());
+  EXPECT_EQ(err_converted.unwrap_err().err_msg(), "Status code: 5");
+}
+
+TEST(VoidResultTest, ValueResultToVoid) {
+  auto value = tmn::Result<int, tmn::test_utils::StatusErr>::Ok(10);
+  int sink = 0;
+
+  tmn::Result<void, tmn::test_utils::StatusErr> status = value.fmap([&sink](int x) { sink = x; });
+  EXPECT_TRUE(status.is_ok());
+  EXPECT_EQ(sink, 10);
+
+  auto failed = tmn::Result<int, tmn::test_utils::StatusErr>::Err(9).fmap([&sink](int x) { sink = -x; });
+  ASSERT_TRUE(failed.is_err());
+  EXPECT_EQ(failed.unwrap_err().code, 9);
+  EXPECT_EQ(sink, 10);
+}
+
+// user code throws: only with exceptions support;
+#ifdef TMN_THROWLESS_HAS_EXCEPTIONS
+TEST(VoidResultTest, TryOrConvertVoid) {
+  auto ok = tmn::try_or_convert([]() {});
+  EXPECT_TRUE(ok.is_ok());
+
+  auto err = tmn::try_or_convert([]() { throw std::runtime_error("void failure"); });
+  ASSERT_TRUE(err.is_err());
+  EXPECT_NE(err.unwrap_err().err_msg().find("void failure"), std::string::npos);
+}
+#endif
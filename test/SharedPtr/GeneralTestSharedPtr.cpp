@@ -2,6 +2,7 @@
 
 #include "../../include/SmartPtr/SharedPtr.hpp"
 #include "../_TestUtils/Utils.hpp"
+#include "../_TestUtils/Failure.hpp"
 
 class SharedPtrFixture : public ::testing::Test {
 protected:
@@ -206,11 +207,11 @@ TEST_F(SharedPtrFixture, FriendSwap) {
 TEST_F(SharedPtrFixture, EmptySharedPtrOperations) {
   tmn::SharedPtr<tmn::test_utils::SharedTestObject> ptr;
 
-  ASSERT_NO_THROW(ptr.reset());
-  ASSERT_NO_THROW(ptr.get());
-  ASSERT_NO_THROW(ptr.counter_value());
-  ASSERT_NO_THROW(ptr.is_unique());
-  ASSERT_NO_THROW(ptr.try_get());
+  TMN_EXPECT_NO_FAILURE(ptr.reset());
+  TMN_EXPECT_NO_FAILURE(ptr.get());
+  TMN_EXPECT_NO_FAILURE(ptr.counter_value());
+  TMN_EXPECT_NO_FAILURE(ptr.is_unique());
+  TMN_EXPECT_NO_FAILURE(ptr.try_get());
 
   auto ptr2 = ptr;
   auto ptr3 = std::move(ptr);
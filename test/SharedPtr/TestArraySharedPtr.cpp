@@ -131,15 +131,35 @@ TEST_F(SharedPtrArrayTest, AtMethodSuccess) {
   EXPECT_EQ(result2.unwrap_value().value, 20);
 }
 
+TEST_F(SharedPtrArrayTest, AtMethodReturnsReference) {
+  tmn::SharedPtr<tmn::test_utils::SharedTestObject[]> ptr(new tmn::test_utils::SharedTestObject[2]{10, 20}, 2);
+  const int copies_before = tmn::test_utils::SharedTestObject::copy_count;
+
+  auto result = ptr.at(1);
+  ASSERT_TRUE(result.is_ok());
+  EXPECT_EQ(&result.unwrap_value(), &ptr[1]);
+
+  result.unwrap_value().value = 25;
+  EXPECT_EQ(ptr[1].value, 25);
+  EXPECT_EQ(tmn::test_utils::SharedTestObject::copy_count, copies_before);
+}
+
 TEST_F(SharedPtrArrayTest, AtMethodErrorCases) {
   tmn::SharedPtr<tmn::test_utils::SharedTestObject[]> ptr(new tmn::test_utils::SharedTestObject[2]{30, 40}, 2);
 
   auto result1 = ptr.at(2);
   EXPECT_TRUE(result1.is_err());
 
+  // The error keeps its original type (no slicing):
+  auto range_err = result1.unwrap_err().downcast<tmn::err::OutOfRangeErr>();
+  ASSERT_TRUE(range_err.has_value());
+  EXPECT_EQ(range_err.value().index(), 2);
+  EXPECT_EQ(range_err.value().size(), 2);
+
   tmn::SharedPtr<tmn::test_utils::SharedTestObject[]> empty_ptr;
   auto result2 = empty_ptr.at(0);
   EXPECT_TRUE(result2.is_err());
+  EXPECT_TRUE(result2.unwrap_err().is<tmn::err::EmptyArrErr>());
 }
 
 TEST_F(SharedPtrArrayTest, GetAndTryGet) {
@@ -38,6 +38,8 @@ TEST_F(SharedPtrMakerFixture, MakeSharedPtrWithWeakPtr) {
 TEST_F(SharedPtrMakerFixture, MakeUniquePtrArrayZeroSize) {
   auto t = tmn::make_shared_array<int>(0);
   ASSERT_TRUE(t.is_err());
+  EXPECT_TRUE(t.unwrap_err().is<tmn::err::InvalidArgErr>());
+  EXPECT_EQ(t.unwrap_err().err_msg(), "Array to be created must have a non-zero size");
 }
 
 TEST_F(SharedPtrMakerFixture, MakeSharedArraySharedOwnership) {
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../../include/SmartPtr/SharedStr.hpp"
+
+TEST(SharedStrTest, EmptyStringDoesNotAllocate) {
+  tmn::SharedStr str;
+  EXPECT_TRUE(str.empty());
+  EXPECT_EQ(str.size(), 0);
+  EXPECT_STREQ(str.c_str(), "");
+  EXPECT_EQ(str.counter_value(), 0);
+
+  tmn::SharedStr from_empty("");
+  EXPECT_TRUE(from_empty.empty());
+  EXPECT_EQ(from_empty, str);
+}
+
+TEST(SharedStrTest, CopiesShareTheBuffer) {
+  tmn::SharedStr str(std::string("Refcounted error message"));
+  EXPECT_EQ(str.counter_value(), 1);
+  EXPECT_EQ(str.size(), 24);
+  EXPECT_EQ(str.view(), "Refcounted error message");
+
+  {
+    tmn::SharedStr copy = str;
+    tmn::SharedStr second_copy(copy);
+    EXPECT_EQ(str.counter_value(), 3);
+    EXPECT_EQ(copy.c_str(), str.c_str()) << "Copies must point to the same characters";
+    EXPECT_EQ(second_copy, str);
+  }
+  EXPECT_EQ(str.counter_value(), 1);
+
+  tmn::SharedStr moved = std::move(str);
+  EXPECT_EQ(moved.counter_value(), 1);
+  EXPECT_TRUE(str.empty());
+}
+
+TEST(SharedStrTest, Assignment) {
+  tmn::SharedStr first("first");
+  tmn::SharedStr second("second");
+
+  second = first;
+  EXPECT_EQ(first.counter_value(), 2);
+  EXPECT_EQ(second.view(), "first");
+
+  second = second;
+  EXPECT_EQ(first.counter_value(), 2);
+
+  second = tmn::SharedStr("third");
+  EXPECT_EQ(first.counter_value(), 1);
+  EXPECT_EQ(second.str(), "third");
+  EXPECT_NE(first, second);
+}
@@ -2,6 +2,7 @@
 
 #include "../../include/SmartPtr/UniquePtr.hpp"
 #include "../_TestUtils/Utils.hpp"
+#include "../_TestUtils/Failure.hpp"
 
 class UniquePtrArrayFixture : public ::testing::Test {
 protected:
@@ -52,7 +53,7 @@ TEST_F(UniquePtrArrayFixture, ArrayIndexOperator) {
 TEST_F(UniquePtrArrayFixture, ArrayIndexOperatorThrowsWhenEmpty) {
   tmn::UniquePtr<tmn::test_utils::UniqueTestObject[]> ptr;
 
-  EXPECT_THROW(
+  TMN_EXPECT_FAILURE(
     { ptr[0]; },
     std::runtime_error
   );
@@ -71,6 +72,20 @@ TEST_F(UniquePtrArrayFixture, ArrayTryGetValAt) {
   EXPECT_EQ(result2.unwrap_value().value, 20);
 }
 
+TEST_F(UniquePtrArrayFixture, ArrayAtReturnsReference) {
+  auto* raw_array = new tmn::test_utils::UniqueTestObject[2]{tmn::test_utils::UniqueTestObject(10), tmn::test_utils::UniqueTestObject(20)};
+  tmn::UniquePtr<tmn::test_utils::UniqueTestObject[]> ptr(raw_array);
+  const int copies_before = tmn::test_utils::UniqueTestObject::copy_count;
+
+  auto result = ptr.at(1);
+  ASSERT_TRUE(result.is_ok());
+  EXPECT_EQ(&result.unwrap_value(), &raw_array[1]);
+  EXPECT_EQ(tmn::test_utils::UniqueTestObject::copy_count, copies_before);
+
+  tmn::UniquePtr<tmn::test_utils::UniqueTestObject[]> empty;
+  EXPECT_TRUE(empty.at(0).is_err());
+}
+
 TEST_F(UniquePtrArrayFixture, ArrayReset) {
 auto* raw_array1 = new tmn::test_utils::UniqueTestObject[2]{tmn::test_utils::UniqueTestObject(1), tmn::test_utils::UniqueTestObject(2)};
 auto* raw_array2 = new tmn::test_utils::UniqueTestObject[1]{tmn::test_utils::UniqueTestObject(3)};
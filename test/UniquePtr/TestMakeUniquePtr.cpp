@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "../../include/SmartPtr/UniquePtr.hpp"
+#include "../_TestUtils/Failure.hpp"
 
 class UniquePtrMakerFixture : public ::testing::Test {
 protected:
@@ -40,9 +41,9 @@ TEST_F(UniquePtrMakerFixture, MakeUniquePtrArraySuccess) {
 }
 
 TEST_F(UniquePtrMakerFixture, MakeUniquePtrArrayZeroSize) {
-  ASSERT_THROW(auto t = tmn::make_unique_array_ptr<int>(0), tmn::err::InvalidArgErr);
+  TMN_EXPECT_FAILURE(auto t = tmn::make_unique_array_ptr<int>(0), tmn::err::InvalidArgErr);
 }
 
 TEST_F(UniquePtrMakerFixture, MakeUniquePtrArrayLargeSize) {
-  ASSERT_THROW(auto t = tmn::make_unique_array_ptr<int>(SIZE_MAX / sizeof(int) + 1), tmn::err::BadAllocErr);
+  TMN_EXPECT_FAILURE(auto t = tmn::make_unique_array_ptr<int>(SIZE_MAX / sizeof(int) + 1), tmn::err::BadAllocErr);
 }
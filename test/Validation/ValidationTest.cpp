@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "../../include/Validation/Validation.hpp"
+#include "../../include/Error/Error.hpp"
+
+namespace {
+
+struct FieldErr {
+  std::string field;
+
+  std::string err_msg() const { return "invalid field: " + field; }
+  const char* what() const noexcept { return "FieldErr"; }
+
+  bool operator==(const FieldErr& oth) const noexcept = default;
+};
+
+using IntV = tmn::Validation<int, FieldErr>;
+
+struct User {
+  std::string name;
+  int age = 0;
+  int level = 0;
+
+  bool operator==(const User& oth) const = default;
+};
+
+IntV check_positive(const std::string& field, int value) {
+  return value > 0 ? IntV::Valid(value) : IntV::Invalid(FieldErr{field});
+}
+
+tmn::Validation<std::string, FieldErr> check_name(std::string name) {
+  if (name.empty()) return tmn::Validation<std::string, FieldErr>::Invalid(FieldErr{"name"});
+  return tmn::Validation<std::string, FieldErr>::Valid(std::move(name));
+}
+
+const auto make_user = [](std::string name, int age, int level) { return User{std::move(name), age, level}; };
+
+std::vector<std::string> fields_of(const IntV& v) {
+  std::vector<std::string> fields;
+  for (const FieldErr& err : v.errors()) fields.push_back(err.field);
+  return fields;
+}
+
+} // namespace;
+
+TEST(ValidationTest, CombineOfValidValuesCallsTheFunction) {
+  const auto user = combine(make_user, check_name("ann"), check_positive("age", 30), check_positive("level", 2));
+  ASSERT_TRUE(user.is_valid());
+  EXPECT_EQ(user.value_unchecked(), (User{"ann", 30, 2}));
+  EXPECT_EQ(user.error_count(), 0U);
+  EXPECT_EQ(user.errors().begin(), user.errors().end());
+}
+
+TEST(ValidationTest, CombineKeepsEveryErrorInArgumentOrder) {
+  int calls = 0;
+  const auto user = combine([&](std::string name, int age, int level) { ++calls; return make_user(std::move(name), age, level); },
+                            check_name(""), check_positive("age", 30), check_positive("level", -1));
+  ASSERT_TRUE(user.is_invalid());
+  EXPECT_EQ(calls, 0);
+  ASSERT_EQ(user.error_count(), 2U);
+
+  std::vector<FieldErr> errors(user.errors().begin(), user.errors().end());
+  EXPECT_EQ(errors, (std::vector<FieldErr>{FieldErr{"name"}, FieldErr{"level"}}));
+}
+
+TEST(ValidationTest, NestedCombinesSpliceTheirErrors) {
+  const auto sum = [](auto... xs) { return (xs + ...); };
+
+  // more errors than the inline slot and the first block hold:
+  std::vector<IntV> parts;
+  for (int i = 0; i < 6; ++i) parts.push_back(combine(sum, check_positive("a" + std::to_string(i), -i),
+                                                       check_positive("b" + std::to_string(i), i - 3)));
+  auto left = combine(sum, std::move(parts[0]), std::move(parts[1]), std::move(parts[2]));
+  auto right = combine(sum, std::move(parts[3]), std::move(parts[4]), std::move(parts[5]));
+  const auto all = combine(sum, std::move(left), check_positive("c", 1), std::move(right));
+
+  EXPECT_EQ(fields_of(all), (std::vector<std::string>{"a0", "b0", "a1", "b1", "a2", "b2", "a3", "b3", "a4", "a5"}));
+}
+
+TEST(ValidationTest, LvalueArgumentsAreCopied) {
+  const IntV bad = IntV::Invalid(FieldErr{"x"});
+  const IntV good = IntV::Valid(5);
+
+  const auto twice = combine([](int a, int b) { return a + b; }, bad, bad);
+  EXPECT_EQ(fields_of(twice), (std::vector<std::string>{"x", "x"}));
+  EXPECT_EQ(fields_of(bad), (std::vector<std::string>{"x"}));
+
+  EXPECT_EQ(combine([](int a, int b) { return a * b; }, good, good).value_unchecked(), 25);
+
+  IntV copy = twice;
+  copy = combine([](int a, int b) { return a + b; }, copy, twice);
+  EXPECT_EQ(copy.error_count(), 4U);
+}
+
+TEST(ValidationTest, ConvertsToAndFromResult) {
+  using Res = tmn::Result<int, FieldErr>;
+
+  auto valid = IntV::from_result(Res::Ok(7)).fmap([](int x) { return x * 2; });
+  EXPECT_EQ(std::move(valid).to_result().unwrap_value(), 14);
+
+  const auto invalid = combine([](int a, int b) { return a + b; }, IntV::from_result(Res::Err(FieldErr{"p"})), check_positive("q", 0));
+  const auto res = invalid.to_result();
+  ASSERT_TRUE(res.is_err());
+  EXPECT_EQ(res.unwrap_err().size(), 2U);
+  EXPECT_EQ(res.unwrap_err().err_msg(), "invalid field: p; invalid field: q");
+  EXPECT_EQ(invalid.error_count(), 2U); // the const& conversion leaves the source as it was
+}
+
+#ifndef NDEBUG
+TEST(ValidationTest, InvalidIsCheckedInDebugBuilds) {
+  const auto invalid = check_positive("age", -1);
+  EXPECT_DEATH((void)invalid.value_unchecked(), "unchecked access to the value of Invalid");
+}
+#endif
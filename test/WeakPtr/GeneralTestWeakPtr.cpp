@@ -2,6 +2,7 @@
 
 #include "../../include/SmartPtr/WeakPtr.hpp"
 #include "../_TestUtils/Utils.hpp"
+#include "../_TestUtils/Failure.hpp"
 
 #include <gtest/gtest.h>
 
@@ -250,10 +251,10 @@ TEST_F(WeakPtrFixture, FriendSwap) {
 TEST_F(WeakPtrFixture, EmptyWeakPtrOperations) {
   tmn::WeakPtr<tmn::test_utils::WeakTestObject> weak_ptr;
 
-  ASSERT_NO_THROW(weak_ptr.reset());
-  ASSERT_NO_THROW(weak_ptr.is_expired());
-  ASSERT_NO_THROW(weak_ptr.counter_value());
-  ASSERT_NO_THROW(weak_ptr.promote());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.reset());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.is_expired());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.counter_value());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.promote());
 
   auto weak2 = weak_ptr;
   auto weak3 = std::move(weak_ptr);
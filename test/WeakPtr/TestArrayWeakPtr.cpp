@@ -3,6 +3,7 @@
 #include "../../include/SmartPtr/WeakPtr.hpp"
 #include "../../include/SmartPtr/SharedPtr.hpp"
 #include "../_TestUtils/Utils.hpp"
+#include "../_TestUtils/Failure.hpp"
 
 class WeakPtrArrayTest : public ::testing::Test {
 protected:
@@ -327,11 +328,11 @@ TEST_F(WeakPtrArrayTest, FriendSwap) {
 TEST_F(WeakPtrArrayTest, EmptyWeakPtrArrayOperations) {
   tmn::WeakPtr<tmn::test_utils::SharedTestObject[]> weak_ptr;
 
-  ASSERT_NO_THROW(weak_ptr.reset());
-  ASSERT_NO_THROW(weak_ptr.is_expired());
-  ASSERT_NO_THROW(weak_ptr.counter_value());
-  ASSERT_NO_THROW(weak_ptr.size());
-  ASSERT_NO_THROW(weak_ptr.promote());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.reset());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.is_expired());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.counter_value());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.size());
+  TMN_EXPECT_NO_FAILURE(weak_ptr.promote());
 
   auto weak2 = weak_ptr;
   auto weak3 = std::move(weak_ptr);
@@ -0,0 +1,18 @@
+#ifndef TMN_THROWLESS_TEST_FAILURE_HPP
+#define TMN_THROWLESS_TEST_FAILURE_HPP
+
+#include <gtest/gtest.h>
+
+#include "../../include/Panic/Panic.hpp"
+
+// Failure of the library: the exception in the default mode,
+// the panic (death of the process with the message of the default handler) without exceptions:
+#ifdef TMN_THROWLESS_NO_EXCEPTIONS
+#define TMN_EXPECT_FAILURE(statement, exception) EXPECT_DEATH(statement, "throwless panic")
+#define TMN_EXPECT_NO_FAILURE(statement) statement
+#else
+#define TMN_EXPECT_FAILURE(statement, exception) EXPECT_THROW(statement, exception)
+#define TMN_EXPECT_NO_FAILURE(statement) EXPECT_NO_THROW(statement)
+#endif
+
+#endif // TMN_THROWLESS_TEST_FAILURE_HPP